@@ -638,6 +638,11 @@ int ChipLinuxAppInit(int argc, char * const argv[], OptionSet * customOptions,
     err = DeviceLayer::PlatformMgr().InitChipStack();
     SuccessOrExit(err);
 
+    // Starts the background tasks when CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING is set, so that CASE crypto can run
+    // outside of the CHIP event loop; does nothing otherwise.
+    err = DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask();
+    SuccessOrExit(err);
+
     // Init the commissionable data provider based on command line options
     // to handle custom verifiers, discriminators, etc.
     err = chip::examples::InitCommissionableDataProvider(gCommissionableDataProvider, LinuxDeviceOptions::GetInstance());
@@ -73,6 +73,22 @@ bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Priv
     return false;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+uint8_t GetGrantedPrivileges(Privilege entryPrivilege)
+{
+    uint8_t grantedPrivileges = 0;
+    for (Privilege requestPrivilege :
+         { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage, Privilege::kAdminister })
+    {
+        if (CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, entryPrivilege))
+        {
+            grantedPrivileges = static_cast<uint8_t>(grantedPrivileges | to_underlying(requestPrivilege));
+        }
+    }
+    return grantedPrivileges;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -225,6 +241,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        InvalidateCompiledEntries();
     }
 
     return retval;
@@ -236,6 +253,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    InvalidateCompiledEntries();
 
     if (IsGroupAuxiliaryDelegateRegistered())
     {
@@ -259,6 +277,7 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
 
     size_t i = 0;
+    InvalidateCompiledEntries(fabric);
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
 
     if (index)
@@ -275,6 +294,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
+    InvalidateCompiledEntries(fabric);
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
@@ -289,6 +309,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
     {
         p = &entry;
     }
+    InvalidateCompiledEntries(fabric);
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
     if (p && p->HasDefaultDelegate())
     {
@@ -362,7 +383,14 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidPrivilege(requestPrivilege), CHIP_ERROR_INVALID_ARGUMENT);
 
-    CHIP_ERROR result = CheckACL(subjectDescriptor, requestPath, requestPrivilege);
+    CHIP_ERROR aclResult = CheckACL(subjectDescriptor, requestPath, requestPrivilege);
+    return CheckAfterACL(subjectDescriptor, requestPath, requestPrivilege, aclResult);
+}
+
+CHIP_ERROR AccessControl::CheckAfterACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                        Privilege requestPrivilege, CHIP_ERROR aclResult)
+{
+    CHIP_ERROR result = aclResult;
 
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     if (result == CHIP_NO_ERROR)
@@ -389,6 +417,46 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     return result;
 }
 
+CHIP_ERROR AccessControl::BatchCheck::Check(const RequestPath & requestPath, Privilege requestPrivilege)
+{
+    VerifyOrReturnError(mAccessControl.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(IsValidPrivilege(requestPrivilege), CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (requestPath.endpoint != mEndpoint || requestPath.cluster != mCluster)
+    {
+        mEndpoint          = requestPath.endpoint;
+        mCluster           = requestPath.cluster;
+        mAllowedPrivileges = 0;
+        mDeniedPrivileges  = 0;
+    }
+
+    const uint8_t privilege = to_underlying(requestPrivilege);
+    CHIP_ERROR aclResult;
+    if (mAllowedPrivileges & privilege)
+    {
+        aclResult = CHIP_NO_ERROR;
+    }
+    else if (mDeniedPrivileges & privilege)
+    {
+        aclResult = CHIP_ERROR_ACCESS_DENIED;
+    }
+    else
+    {
+        aclResult = mAccessControl.CheckACL(mSubjectDescriptor, requestPath, requestPrivilege);
+        // Other errors are not kept, so that the next request path is checked again.
+        if (aclResult == CHIP_NO_ERROR)
+        {
+            mAllowedPrivileges = static_cast<uint8_t>(mAllowedPrivileges | privilege);
+        }
+        else if (aclResult == CHIP_ERROR_ACCESS_DENIED)
+        {
+            mDeniedPrivileges = static_cast<uint8_t>(mDeniedPrivileges | privilege);
+        }
+    }
+
+    return mAccessControl.CheckAfterACL(mSubjectDescriptor, requestPath, requestPrivilege, aclResult);
+}
+
 CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
 {
@@ -438,6 +506,13 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    if (const CompiledFabric * compiled = GetCompiledFabric(subjectDescriptor.fabricIndex))
+    {
+        return CheckCompiledEntries(*compiled, subjectDescriptor, requestPath, requestPrivilege);
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -552,6 +627,325 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+void AccessControl::InvalidateCompiledEntries(FabricIndex fabric)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    for (auto & compiled : mCompiledFabrics)
+    {
+        if (compiled.valid && compiled.fabricIndex == fabric)
+        {
+            compiled.Clear();
+        }
+    }
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & decision : mDecisionCache)
+    {
+        if (decision.lastUse != 0 && decision.fabricIndex == fabric)
+        {
+            decision.lastUse = 0;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+}
+
+void AccessControl::InvalidateCompiledEntries()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    for (auto & compiled : mCompiledFabrics)
+    {
+        compiled.Clear();
+    }
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & decision : mDecisionCache)
+    {
+        decision.lastUse = 0;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+AccessControl::CompiledFabric * AccessControl::GetCompiledFabric(FabricIndex fabric)
+{
+    for (auto & compiled : mCompiledFabrics)
+    {
+        if (compiled.valid && compiled.fabricIndex == fabric)
+        {
+            return &compiled;
+        }
+    }
+
+    CompiledFabric & compiled = mCompiledFabrics[mNextCompiledFabric];
+    mNextCompiledFabric       = (mNextCompiledFabric + 1) % MATTER_ARRAY_SIZE(mCompiledFabrics);
+    if (compiled.valid)
+    {
+        InvalidateCompiledEntries(compiled.fabricIndex);
+    }
+
+    CHIP_ERROR err = CompileEntries(fabric, compiled);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Entries that cannot be compiled, e.g. because they are not valid, are checked through the delegate so that the
+        // outcome of the check does not change.
+        ChipLogDetail(DataManagement, "AccessControl: cannot compile entries of fabric %u: %" CHIP_ERROR_FORMAT,
+                      static_cast<unsigned>(fabric), err.Format());
+        compiled.Clear();
+        return nullptr;
+    }
+
+    compiled.valid       = true;
+    compiled.fabricIndex = fabric;
+    return &compiled;
+}
+
+CHIP_ERROR AccessControl::CompileEntries(FabricIndex fabric, CompiledFabric & compiled)
+{
+    size_t entryCount   = 0;
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+
+    // First pass counts what needs to be allocated, second pass copies the entries.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        if (pass == 1)
+        {
+            if (entryCount > 0)
+            {
+                VerifyOrReturnError(compiled.entries.Alloc(entryCount).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            }
+            if (subjectCount > 0)
+            {
+                VerifyOrReturnError(compiled.subjects.Alloc(subjectCount).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            }
+            if (targetCount > 0)
+            {
+                VerifyOrReturnError(compiled.targets.Alloc(targetCount).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+            }
+        }
+
+        size_t entryIndex   = 0;
+        size_t subjectIndex = 0;
+        size_t targetIndex  = 0;
+
+        EntryIterator iterator;
+        ReturnErrorOnFailure(Entries(iterator, &fabric));
+
+        Entry entry;
+        while (iterator.Next(entry) == CHIP_NO_ERROR)
+        {
+            AuthMode authMode = AuthMode::kNone;
+            ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+            // Operational PASE not supported for v1.0.
+            VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+
+            Privilege privilege = Privilege::kView;
+            ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+
+            size_t entrySubjectCount = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(entrySubjectCount));
+            size_t entryTargetCount = 0;
+            ReturnErrorOnFailure(entry.GetTargetCount(entryTargetCount));
+
+            if (pass == 0)
+            {
+                entryCount++;
+                subjectCount += entrySubjectCount;
+                targetCount += entryTargetCount;
+                continue;
+            }
+
+            VerifyOrReturnError(entryIndex < entryCount && entrySubjectCount <= subjectCount - subjectIndex &&
+                                    entryTargetCount <= targetCount - targetIndex,
+                                CHIP_ERROR_INCORRECT_STATE);
+
+            for (size_t i = 0; i < entrySubjectCount; ++i)
+            {
+                NodeId subject = kUndefinedNodeId;
+                ReturnErrorOnFailure(entry.GetSubject(i, subject));
+                if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+                {
+                    VerifyOrReturnError(authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+                }
+                else if (IsGroupId(subject))
+                {
+                    VerifyOrReturnError(authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+                }
+                else
+                {
+                    // Operational PASE not supported for v1.0.
+                    return CHIP_ERROR_INCORRECT_STATE;
+                }
+                compiled.subjects[subjectIndex++] = subject;
+            }
+
+            for (size_t i = 0; i < entryTargetCount; ++i)
+            {
+                Entry::Target & target = compiled.targets[targetIndex++];
+                ReturnErrorOnFailure(entry.GetTarget(i, target));
+                if (target.flags & Entry::Target::kDeviceType)
+                {
+                    compiled.hasDeviceTypeTargets = true;
+                }
+            }
+
+            CompiledEntry & compiledEntry   = compiled.entries[entryIndex++];
+            compiledEntry.authMode          = authMode;
+            compiledEntry.grantedPrivileges = GetGrantedPrivileges(privilege);
+            compiledEntry.subjectCount      = entrySubjectCount;
+            compiledEntry.targetCount       = entryTargetCount;
+        }
+
+        if (pass == 1)
+        {
+            // The entries must not have changed between both passes.
+            VerifyOrReturnError(entryIndex == entryCount && subjectIndex == subjectCount && targetIndex == targetCount,
+                                CHIP_ERROR_INCORRECT_STATE);
+        }
+    }
+
+    compiled.entryCount = entryCount;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AccessControl::CheckCompiledEntries(const CompiledFabric & compiled, const SubjectDescriptor & subjectDescriptor,
+                                               const RequestPath & requestPath, Privilege requestPrivilege)
+{
+    bool allowed = false;
+
+    // Whether a device type is on an endpoint can change without the entries changing, so such checks are not cached.
+    const CachedDecision * decision =
+        compiled.hasDeviceTypeTargets ? nullptr : FindCachedDecision(subjectDescriptor, requestPath, requestPrivilege);
+    if (decision != nullptr)
+    {
+        mDecisionCacheHits++;
+        allowed = decision->allowed;
+    }
+    else
+    {
+        mDecisionCacheMisses++;
+
+        const NodeId * subjects       = compiled.subjects.Get();
+        const Entry::Target * targets = compiled.targets.Get();
+        for (size_t i = 0; i < compiled.entryCount && !allowed; ++i)
+        {
+            const CompiledEntry & entry = compiled.entries[i];
+            allowed = MatchesCompiledEntry(entry, subjects, targets, subjectDescriptor, requestPath, requestPrivilege);
+            subjects += entry.subjectCount;
+            targets += entry.targetCount;
+        }
+
+        if (!compiled.hasDeviceTypeTargets)
+        {
+            CacheDecision(subjectDescriptor, requestPath, requestPrivilege, allowed);
+        }
+    }
+
+    if (allowed)
+    {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+        ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogProgress(DataManagement, "AccessControl: denied");
+    return CHIP_ERROR_ACCESS_DENIED;
+}
+
+bool AccessControl::MatchesCompiledEntry(const CompiledEntry & entry, const NodeId * subjects, const Entry::Target * targets,
+                                         const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                         Privilege requestPrivilege) const
+{
+    if (entry.authMode != subjectDescriptor.authMode || (entry.grantedPrivileges & to_underlying(requestPrivilege)) == 0)
+    {
+        return false;
+    }
+
+    if (entry.subjectCount > 0)
+    {
+        bool subjectMatched = false;
+        for (size_t i = 0; i < entry.subjectCount && !subjectMatched; ++i)
+        {
+            subjectMatched = IsCASEAuthTag(subjects[i]) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subjects[i])
+                                                        : subjects[i] == subjectDescriptor.subject;
+        }
+        VerifyOrReturnValue(subjectMatched, false);
+    }
+
+    if (entry.targetCount > 0)
+    {
+        for (size_t i = 0; i < entry.targetCount; ++i)
+        {
+            const Entry::Target & target = targets[i];
+            if ((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+            {
+                continue;
+            }
+            if ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+            {
+                continue;
+            }
+            if (target.flags & Entry::Target::kDeviceType &&
+                !mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+            {
+                continue;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    return true;
+}
+
+AccessControl::CachedDecision * AccessControl::FindCachedDecision(const SubjectDescriptor & subjectDescriptor,
+                                                                  const RequestPath & requestPath, Privilege requestPrivilege)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    for (auto & decision : mDecisionCache)
+    {
+        if (decision.lastUse != 0 && decision.fabricIndex == subjectDescriptor.fabricIndex &&
+            decision.authMode == subjectDescriptor.authMode && decision.subject == subjectDescriptor.subject &&
+            decision.cats.values == subjectDescriptor.cats.values && decision.endpoint == requestPath.endpoint &&
+            decision.cluster == requestPath.cluster && decision.privilege == requestPrivilege)
+        {
+            decision.lastUse = ++mDecisionCacheUseCounter;
+            return &decision;
+        }
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    return nullptr;
+}
+
+void AccessControl::CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  Privilege requestPrivilege, bool allowed)
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    // Replace an unused decision if there is one, otherwise the least recently used one.
+    CachedDecision * leastRecentlyUsed = &mDecisionCache[0];
+    for (auto & decision : mDecisionCache)
+    {
+        if (decision.lastUse < leastRecentlyUsed->lastUse)
+        {
+            leastRecentlyUsed = &decision;
+        }
+    }
+
+    leastRecentlyUsed->lastUse     = ++mDecisionCacheUseCounter;
+    leastRecentlyUsed->fabricIndex = subjectDescriptor.fabricIndex;
+    leastRecentlyUsed->authMode    = subjectDescriptor.authMode;
+    leastRecentlyUsed->privilege   = requestPrivilege;
+    leastRecentlyUsed->allowed     = allowed;
+    leastRecentlyUsed->subject     = subjectDescriptor.subject;
+    leastRecentlyUsed->cats        = subjectDescriptor.cats;
+    leastRecentlyUsed->endpoint    = requestPath.endpoint;
+    leastRecentlyUsed->cluster     = requestPath.cluster;
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
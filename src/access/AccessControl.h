@@ -32,6 +32,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -414,6 +415,10 @@ public:
         // Return CHIP_NO_ERROR if allowed, CHIP_ERROR_ACCESS_DENIED if denied,
         // CHIP_ERROR_NOT_IMPLEMENTED to use the default check algorithm (against entries),
         // or any other CHIP_ERROR if another error occurred.
+        //
+        // An allowed or denied result must only depend on the subject descriptor, the endpoint
+        // and cluster of the request path, and the privilege: not on the request type or entity
+        // of the request path. BatchCheck reuses it for every path of the same cluster.
         virtual CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                  Privilege requestPrivilege)
         {
@@ -421,6 +426,41 @@ public:
         }
     };
 
+    /**
+     * Checks access to many request paths for the same subject, such as the paths produced by expanding a wildcard path,
+     * going through the access control list only once per endpoint, cluster and privilege.
+     *
+     * Whether the access control list allows access is kept for the endpoint and cluster of the last request path checked, so
+     * request paths are expected to come grouped by cluster, as they do when expanding a wildcard path. Access restrictions,
+     * which depend on the entity, are still checked for every request path.
+     *
+     * The access control list must not change while checking a batch. A delegate that implements Check() must allow or deny
+     * regardless of the request type and entity, see Delegate::Check().
+     */
+    class BatchCheck
+    {
+    public:
+        BatchCheck(AccessControl & accessControl, const SubjectDescriptor & subjectDescriptor) :
+            mAccessControl(accessControl), mSubjectDescriptor(subjectDescriptor)
+        {}
+
+        BatchCheck(const BatchCheck &)             = delete;
+        BatchCheck & operator=(const BatchCheck &) = delete;
+
+        /**
+         * Same as AccessControl::Check() for the subject of the batch.
+         */
+        CHIP_ERROR Check(const RequestPath & requestPath, Privilege requestPrivilege);
+
+    private:
+        AccessControl & mAccessControl;
+        SubjectDescriptor mSubjectDescriptor;
+        EndpointId mEndpoint       = kInvalidEndpointId;
+        ClusterId mCluster         = kInvalidClusterId;
+        uint8_t mAllowedPrivileges = 0;
+        uint8_t mDeniedPrivileges  = 0;
+    };
+
     AccessControl() = default;
 
     AccessControl(const AccessControl &)             = delete;
@@ -525,6 +565,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +616,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -596,6 +638,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCompiledEntries();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -731,6 +774,18 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Number of checks answered from the recent access control decisions,
+     * see CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE.
+     */
+    size_t GetDecisionCacheHits() const { return mDecisionCacheHits; }
+
+    /**
+     * Number of checks that went through the entries because no recent
+     * access control decision matched.
+     */
+    size_t GetDecisionCacheMisses() const { return mDecisionCacheMisses; }
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
@@ -754,6 +809,83 @@ private:
      */
     CHIP_ERROR CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Completes a check once the access control list has been checked, with aclResult, by checking access restrictions and
+     * auxiliary group entries.
+     */
+    CHIP_ERROR CheckAfterACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                             Privilege requestPrivilege, CHIP_ERROR aclResult);
+
+    /**
+     * Drops the compiled entries and the recent decisions of a fabric, or of all fabrics.
+     */
+    void InvalidateCompiledEntries(FabricIndex fabric);
+    void InvalidateCompiledEntries();
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    /**
+     * Entry of a fabric as copied out of the delegate. Its subjects and targets follow those of the previous entry in the
+     * arrays of the fabric.
+     */
+    struct CompiledEntry
+    {
+        AuthMode authMode;
+        uint8_t grantedPrivileges; // Requested privileges allowed by the privilege of the entry.
+        size_t subjectCount;
+        size_t targetCount;
+    };
+
+    struct CompiledFabric
+    {
+        bool valid                = false;
+        FabricIndex fabricIndex   = kUndefinedFabricIndex;
+        bool hasDeviceTypeTargets = false;
+        size_t entryCount         = 0;
+        Platform::ScopedMemoryBuffer<CompiledEntry> entries;
+        Platform::ScopedMemoryBuffer<NodeId> subjects;
+        Platform::ScopedMemoryBuffer<Entry::Target> targets;
+
+        void Clear()
+        {
+            valid                = false;
+            hasDeviceTypeTargets = false;
+            entryCount           = 0;
+            entries.Free();
+            subjects.Free();
+            targets.Free();
+        }
+    };
+
+    struct CachedDecision
+    {
+        uint64_t lastUse = 0; // 0 if unused
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        bool allowed;
+        NodeId subject;
+        CATValues cats;
+        EndpointId endpoint;
+        ClusterId cluster;
+    };
+
+    /**
+     * Returns the compiled entries of a fabric, compiling them if needed, or nullptr if the entries of the fabric cannot be
+     * compiled, in which case they are checked through the delegate.
+     */
+    CompiledFabric * GetCompiledFabric(FabricIndex fabric);
+    CHIP_ERROR CompileEntries(FabricIndex fabric, CompiledFabric & compiled);
+    CHIP_ERROR CheckCompiledEntries(const CompiledFabric & compiled, const SubjectDescriptor & subjectDescriptor,
+                                    const RequestPath & requestPath, Privilege requestPrivilege);
+    bool MatchesCompiledEntry(const CompiledEntry & entry, const NodeId * subjects, const Entry::Target * targets,
+                              const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                              Privilege requestPrivilege) const;
+    CachedDecision * FindCachedDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                        Privilege requestPrivilege);
+    void CacheDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                       bool allowed);
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
 private:
     Delegate * mDelegate = nullptr;
 
@@ -773,6 +905,18 @@ private:
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    CompiledFabric mCompiledFabrics[CHIP_CONFIG_MAX_FABRICS];
+    size_t mNextCompiledFabric = 0;
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    CachedDecision mDecisionCache[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+    uint64_t mDecisionCacheUseCounter = 0;
+#endif
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
+    size_t mDecisionCacheHits   = 0;
+    size_t mDecisionCacheMisses = 0;
 };
 
 /**
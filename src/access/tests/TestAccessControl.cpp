@@ -1988,6 +1988,155 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestBatchCheck)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+    for (const auto & checkData : checkData1)
+    {
+        CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        auto requestPath          = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+        // Same outcome for every privilege when checking the same cluster again, in any order.
+        AccessControl::BatchCheck batchCheck(accessControl, checkData.subjectDescriptor);
+        EXPECT_EQ(batchCheck.Check(requestPath, checkData.privilege), expectedResult);
+        for (auto privilege : privileges)
+        {
+            EXPECT_EQ(batchCheck.Check(requestPath, privilege),
+                      accessControl.Check(checkData.subjectDescriptor, requestPath, privilege));
+        }
+        EXPECT_EQ(batchCheck.Check(requestPath, checkData.privilege), expectedResult);
+    }
+}
+
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES && CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+TEST_F(TestAccessControl, TestDecisionCache)
+{
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 2, .authMode = AuthMode::kCase, .subject = kOperationalNodeId5 };
+    RequestPath allowedPath                   = { .cluster = kOnOffCluster, .endpoint = 2 };
+    RequestPath deniedPath                    = { .cluster = kLevelControlCluster, .endpoint = 2 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    allowedPath.requestType = Access::RequestType::kAttributeReadRequest;
+    deniedPath.requestType  = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    // The first check of a path goes through the entries, then the decision is reused, whether access is allowed or denied.
+    size_t hits   = accessControl.GetDecisionCacheHits();
+    size_t misses = accessControl.GetDecisionCacheMisses();
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, allowedPath, Privilege::kManage), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, allowedPath, Privilege::kManage), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, deniedPath, Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, deniedPath, Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.GetDecisionCacheHits(), hits + 2);
+    EXPECT_EQ(accessControl.GetDecisionCacheMisses(), misses + 2);
+
+    // A different privilege is a different decision.
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, allowedPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.GetDecisionCacheMisses(), misses + 3);
+
+    // Deleting the entry that allowed access drops the decision.
+    EXPECT_SUCCESS(accessControl.DeleteEntry(4));
+    misses = accessControl.GetDecisionCacheMisses();
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, allowedPath, Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.GetDecisionCacheMisses(), misses + 1);
+
+    // So does updating an entry of the fabric so that it allows access, through the fabric filtered overload.
+    {
+        Entry entry;
+        EXPECT_SUCCESS(accessControl.ReadEntry(2, 0, entry));
+        EXPECT_SUCCESS(entry.SetSubject(0, kOperationalNodeId5));
+        EXPECT_SUCCESS(accessControl.UpdateEntry(nullptr, 2, 0, entry));
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, allowedPath, Privilege::kManage), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, deniedPath, Privilege::kAdminister), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.GetDecisionCacheMisses(), misses + 3);
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES && CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+TEST_F(TestAccessControl, TestCheckManyEntries)
+{
+    constexpr FabricIndex kFabricCount       = 4;
+    constexpr size_t kEntriesPerFabric       = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC;
+    constexpr size_t kTargetsPerEntry        = CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_TARGETS_PER_ENTRY;
+    constexpr EndpointId kEndpointCount      = 32;
+    constexpr size_t kSamePathChecks         = 100;
+    constexpr ClusterId kFirstClusterId      = 0x0000'0100;
+    constexpr NodeId kFirstOperationalNodeId = 0x0000'0000'0000'1000;
+
+    // Every entry has a different subject, and the subject checked is that of the last entry of the last fabric, so that
+    // every entry of that fabric is looked at. Its targets are clusters on any endpoint.
+    for (FabricIndex fabricIndex = 1; fabricIndex <= kFabricCount; fabricIndex++)
+    {
+        for (size_t i = 0; i < kEntriesPerFabric; i++)
+        {
+            Entry entry;
+            ASSERT_SUCCESS(accessControl.PrepareEntry(entry));
+            ASSERT_SUCCESS(entry.SetFabricIndex(fabricIndex));
+            ASSERT_SUCCESS(entry.SetPrivilege(Privilege::kOperate));
+            ASSERT_SUCCESS(entry.SetAuthMode(AuthMode::kCase));
+            ASSERT_SUCCESS(entry.AddSubject(nullptr, kFirstOperationalNodeId + i));
+            for (size_t j = 0; j < kTargetsPerEntry; j++)
+            {
+                ASSERT_SUCCESS(entry.AddTarget(
+                    nullptr, { .flags = Target::kCluster, .cluster = static_cast<ClusterId>(kFirstClusterId + j) }));
+            }
+            ASSERT_SUCCESS(accessControl.CreateEntry(nullptr, entry));
+        }
+    }
+
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = kFabricCount,
+                                            .authMode    = AuthMode::kCase,
+                                            .subject     = kFirstOperationalNodeId + kEntriesPerFabric - 1 };
+
+    auto makePath = [](size_t clusterIndex, size_t endpointIndex) {
+        RequestPath requestPath = { .cluster  = static_cast<ClusterId>(kFirstClusterId + clusterIndex),
+                                    .endpoint = static_cast<EndpointId>(endpointIndex) };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+        requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+        return requestPath;
+    };
+
+    // Checks of many endpoints and clusters, as when expanding a wildcard path.
+    const size_t hits   = accessControl.GetDecisionCacheHits();
+    const size_t misses = accessControl.GetDecisionCacheMisses();
+    for (size_t endpointIndex = 0; endpointIndex < kEndpointCount; endpointIndex++)
+    {
+        for (size_t clusterIndex = 0; clusterIndex < kTargetsPerEntry; clusterIndex++)
+        {
+            ASSERT_SUCCESS(accessControl.Check(subjectDescriptor, makePath(clusterIndex, endpointIndex), Privilege::kView));
+        }
+    }
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+    // Each path is checked once, so no recent decision can match.
+    EXPECT_EQ(accessControl.GetDecisionCacheHits(), hits);
+    EXPECT_EQ(accessControl.GetDecisionCacheMisses(), misses + kEndpointCount * kTargetsPerEntry);
+#else
+    EXPECT_EQ(accessControl.GetDecisionCacheHits() + accessControl.GetDecisionCacheMisses(), hits + misses);
+#endif
+
+    // Checks of the same path, as when going through the attributes of a cluster.
+    for (size_t i = 0; i < kSamePathChecks; i++)
+    {
+        ASSERT_SUCCESS(accessControl.Check(subjectDescriptor, makePath(0, 1), Privilege::kView));
+    }
+#if CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES && CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    // Only the first one may go through the entries.
+    EXPECT_GE(accessControl.GetDecisionCacheHits(), hits + kSamePathChecks - 1);
+    EXPECT_EQ(accessControl.GetDecisionCacheHits() + accessControl.GetDecisionCacheMisses(),
+              hits + misses + kEndpointCount * kTargetsPerEntry + kSamePathChecks);
+#endif
+
+    // Checks that no entry allows.
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, makePath(kTargetsPerEntry, 1), Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, makePath(0, 1), Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+    subjectDescriptor.subject = kFirstOperationalNodeId + kEntriesPerFabric;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, makePath(0, 1), Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
@@ -31,6 +31,9 @@ namespace app {
 ///   - CurrentEncodingListIndex representing the list index that is next
 ///     to be encoded in the output. kInvalidListIndex means that a new list
 ///     encoding has been started.
+///
+/// It also records how many items the list generator had produced when the
+/// last item was encoded, so that generators able to seek can resume there.
 class AttributeEncodeState
 {
 public:
@@ -49,12 +52,14 @@ public:
         else
         {
             mCurrentEncodingListIndex = kInvalidListIndex;
+            mListItemsGenerated       = 0;
             mAllowPartialData         = false;
         }
     }
 
     bool AllowPartialData() const { return mAllowPartialData; }
     ListIndex CurrentEncodingListIndex() const { return mCurrentEncodingListIndex; }
+    ListIndex ListItemsGenerated() const { return mListItemsGenerated; }
 
     AttributeEncodeState & SetAllowPartialData(bool allow)
     {
@@ -68,9 +73,16 @@ public:
         return *this;
     }
 
+    AttributeEncodeState & SetListItemsGenerated(ListIndex count)
+    {
+        mListItemsGenerated = count;
+        return *this;
+    }
+
     void Reset()
     {
         mCurrentEncodingListIndex = kInvalidListIndex;
+        mListItemsGenerated       = 0;
         mAllowPartialData         = false;
     }
 
@@ -84,6 +96,12 @@ private:
      */
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
 
+    /**
+     * The number of items the list generator had passed to the encoder, including items skipped because of
+     * fabric filtering, when the item before mCurrentEncodingListIndex was encoded.
+     */
+    ListIndex mListItemsGenerated = 0;
+
     /**
      * When an attempt to encode an attribute returns an error, the buffer may contain tailing dirty data
      * (since the put was aborted).  The report engine normally rolls back the buffer to right before encoding
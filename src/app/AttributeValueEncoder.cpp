@@ -60,6 +60,7 @@ CHIP_ERROR AttributeValueEncoder::EnsureListStarted()
             mAttributeReportIBsBuilder.GetWriter()->ReserveBuffer(kEndOfAttributeReportIBByteCount + kEndOfListByteCount));
 
         mEncodeState.SetCurrentEncodingListIndex(0);
+        mEncodeState.SetListItemsGenerated(0);
     }
     else
     {
@@ -135,8 +136,19 @@ void AttributeValueEncoder::PostEncodeListItem(CHIP_ERROR aEncodeStatus, const T
 
     mCurrentEncodingListIndex++;
     mEncodeState.SetCurrentEncodingListIndex(mCurrentEncodingListIndex);
+    mEncodeState.SetListItemsGenerated(mListItemsGenerated);
     mEncodedAtLeastOneListItem = true;
 }
 
+ListIndex AttributeValueEncoder::SkipEncodedListItems()
+{
+    // Only valid before the generator produced any item, once EnsureListStarted() has run.
+    VerifyOrDie(mListItemsGenerated == 0 && mCurrentEncodingListIndex == 0);
+
+    mCurrentEncodingListIndex = mEncodeState.CurrentEncodingListIndex();
+    mListItemsGenerated       = mEncodeState.ListItemsGenerated();
+    return mListItemsGenerated;
+}
+
 } // namespace app
 } // namespace chip
@@ -94,9 +94,20 @@ public:
     public:
         ListEncodeHelper(AttributeValueEncoder & encoder) : mAttributeValueEncoder(encoder) {}
 
+        /**
+         * Returns the number of items that the list generator already passed to Encode() in earlier chunks of this list,
+         * up to the first item that still has to be encoded, and makes Encode() treat those items as already passed.
+         *
+         * Without this, Encode() skips the items that were sent in earlier chunks, which means the generator has to produce
+         * the whole list again for every chunk.  A generator that always produces the items in the same order can call
+         * this before producing any item and start at the returned position instead.  Returns 0 when starting a new list.
+         */
+        ListIndex SkipEncodedItems() const { return mAttributeValueEncoder.SkipEncodedListItems(); }
+
         template <typename T, std::enable_if_t<IsBaseType<T> && DataModel::IsFabricScoped<T>::value, bool> = true>
         CHIP_ERROR Encode(const T & aArg) const
         {
+            mAttributeValueEncoder.mListItemsGenerated++;
             VerifyOrReturnError(aArg.GetFabricIndex() != kUndefinedFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
 
             // If we are encoding for a fabric filtered attribute read and the fabric index does not match that present in the
@@ -111,6 +122,7 @@ public:
                   std::enable_if_t<IsBaseType<T> && !DataModel::IsFabricScoped<T>::value && !IsMatterEnum<T>, bool> = true>
         CHIP_ERROR Encode(const T & aArg) const
         {
+            mAttributeValueEncoder.mListItemsGenerated++;
             return mAttributeValueEncoder.EncodeListItem(mCheckpoint, aArg);
         }
 
@@ -263,6 +275,9 @@ private:
     // Does any cleanup work needed after attempting to encode a list item.
     void PostEncodeListItem(CHIP_ERROR aEncodeStatus, const TLV::TLVWriter & aCheckpoint);
 
+    // Implementation of ListEncodeHelper::SkipEncodedItems().
+    ListIndex SkipEncodedListItems();
+
     // EncodeListItem may be given an extra FabricIndex argument as a second
     // arg, or not.  Represent that via a parameter pack (which might be
     // empty). In practice, for any given ItemType the extra arg is either there
@@ -345,6 +360,8 @@ private:
     // mEncodedAtLeastOneListItem becomes true once we successfully encode a list item.
     bool mEncodedAtLeastOneListItem     = false;
     ListIndex mCurrentEncodingListIndex = kInvalidListIndex;
+    // The number of items the list generator has passed to ListEncodeHelper::Encode() so far.
+    ListIndex mListItemsGenerated = 0;
     AttributeEncodeState mEncodeState;
 };
 
@@ -32,6 +32,8 @@ inline constexpr size_t kNumPriorityLevel = 3;
 namespace chip {
 namespace app {
 
+class PersistentEventStore;
+
 /**
  * @brief
  *   The Priority of the log entry.
@@ -168,6 +170,9 @@ struct EventLoadOutContext
     const SingleLinkedListNode<EventPathParams> * mpInterestedEventPaths = nullptr;
     bool mFirst                                                          = true;
     Access::SubjectDescriptor mSubjectDescriptor;
+    // Store providing the events missing from the event buffers, and the first event number it has not been asked for yet.
+    PersistentEventStore * mpPersistentEventStore = nullptr;
+    EventNumber mNextStoredEventNumber            = 0;
 };
 } // namespace app
 } // namespace chip
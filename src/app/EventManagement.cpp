@@ -25,8 +25,10 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstring>
 
 using namespace chip::TLV;
 
@@ -66,8 +68,11 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    CircularEventBuffer::EventIndexEntry mMovedEventIndexEntry;
 };
 
+static_assert(kMaxEventSizeReserve <= UINT16_MAX, "CircularEventBuffer::EventIndexEntry::mLength cannot hold every event length");
+
 /**
  * @brief
  *  Internal structure for traversing event list.
@@ -124,7 +129,7 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, CircularEventBuffer::EventIndexEntry aIndexEntry)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -134,7 +139,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    // Only the queue state is modified until the copy succeeds, the event index does not need to be backed up.
+    TLVCircularBuffer backup = *nextBuffer;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -153,11 +159,14 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    aIndexEntry.mLength = static_cast<uint16_t>(writer.GetLengthWritten());
+    nextBuffer->AppendEventIndexEntry(aIndexEntry);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        static_cast<TLVCircularBuffer &>(*nextBuffer) = backup;
     }
     return err;
 }
@@ -203,7 +212,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
             // EvictEvent function
 
-            if (err != CHIP_NO_ERROR)
+            if (err == CHIP_NO_ERROR)
+            {
+                eventBuffer->RemoveHeadEventIndexEntry();
+            }
+            else
             {
                 VerifyOrExit(ctx.mSpaceNeededForMovedEvent != 0, /* no-op, return err */);
                 VerifyOrExit(eventBuffer->GetNextCircularEventBuffer() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
@@ -215,7 +228,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mMovedEventIndexEntry);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
@@ -226,6 +239,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // caller know that we could not honor the
                     // request
                     SuccessOrExit(err);
+                    eventBuffer->RemoveHeadEventIndexEntry();
                     continue;
                 }
                 // we cannot copy event outright. We remember the
@@ -353,9 +367,10 @@ void EventManagement::CreateEventManagement(Messaging::ExchangeManager * apExcha
  */
 void EventManagement::DestroyEventManagement()
 {
-    sInstance.mState        = EventManagementStates::Shutdown;
-    sInstance.mpEventBuffer = nullptr;
-    sInstance.mpExchangeMgr = nullptr;
+    sInstance.mState                 = EventManagementStates::Shutdown;
+    sInstance.mpEventBuffer          = nullptr;
+    sInstance.mpExchangeMgr          = nullptr;
+    sInstance.mpPersistentEventStore = nullptr;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -468,6 +483,12 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    mpEventBuffer->AppendEventIndexEntry({ ctxt.mCurrentEventNumber, opts.mPath.mClusterId, opts.mPath.mEndpointId,
+                                           static_cast<uint16_t>(writer.GetLengthWritten()) });
+    if (mpPersistentEventStore != nullptr && opts.mFabricIndex == kUndefinedFabricIndex)
+    {
+        PersistEvent(ctxt.mCurrentEventNumber, opts.mPriority, writer.GetLengthWritten());
+    }
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -496,6 +517,71 @@ exit:
     return err;
 }
 
+void EventManagement::PersistEvent(EventNumber aEventNumber, PriorityLevel aPriority, uint32_t aLength)
+{
+    uint8_t event[kMaxEventSizeReserve];
+    VerifyOrReturn(aLength <= sizeof(event));
+
+    // The event ends at the tail of the buffer and may wrap around the end of its storage.
+    const uint32_t size      = mpEventBuffer->GetTotalDataLength();
+    const uint32_t head      = static_cast<uint32_t>(mpEventBuffer->QueueHead() - mpEventBuffer->GetQueue());
+    const uint32_t start     = (head + mpEventBuffer->DataLength() - aLength) % size;
+    const uint32_t firstPart = std::min(aLength, size - start);
+    memcpy(event, mpEventBuffer->GetQueue() + start, firstPart);
+    memcpy(event + firstPart, mpEventBuffer->GetQueue(), aLength - firstPart);
+
+    CHIP_ERROR err = mpPersistentEventStore->AppendEvent(aEventNumber, aPriority, ByteSpan(event, aLength));
+    if (err != CHIP_NO_ERROR)
+    {
+        // The event is still available from the event buffers.
+        ChipLogError(EventLogging, "Failed to persist event 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(aEventNumber), err.Format());
+    }
+}
+
+CHIP_ERROR EventManagement::CopyStoredEventsBefore(EventNumber aEventNumber, EventLoadOutContext & aContext)
+{
+    VerifyOrReturnError(aContext.mpPersistentEventStore != nullptr, CHIP_NO_ERROR);
+
+    VerifyOrReturnError(aEventNumber >= aContext.mNextStoredEventNumber, CHIP_NO_ERROR);
+
+    // Event numbers skipped since the previous event belong to events that were dropped from the event buffers.
+    if (aEventNumber > aContext.mNextStoredEventNumber)
+    {
+        PersistentEventStore & store = *aContext.mpPersistentEventStore;
+        ReturnErrorOnFailure(store.ForEachEvent(aContext.mNextStoredEventNumber, aEventNumber, CopyStoredEvent, &aContext));
+    }
+    aContext.mNextStoredEventNumber = aEventNumber + 1;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyStoredEvent(EventNumber, const ByteSpan & aEvent, bool aFromEarlierBoot, void * apContext)
+{
+    EventLoadOutContext * const loadOutContext = static_cast<EventLoadOutContext *>(apContext);
+    EventEnvelopeContext event;
+    bool encodeEvent = false;
+    TLVReader reader;
+    reader.Init(aEvent);
+    ReturnErrorOnFailure(reader.Next());
+    ReturnErrorOnFailure(EventIterator(reader, 0, loadOutContext, &event, encodeEvent));
+
+    // The system timestamps of events logged before a reboot count from that boot, so no delta timestamp may be computed
+    // across them.
+    if (aFromEarlierBoot)
+    {
+        loadOutContext->mFirst = true;
+    }
+    if (encodeEvent)
+    {
+        ReturnErrorOnFailure(CopyIncludedEvent(reader, *loadOutContext));
+    }
+    if (aFromEarlierBoot)
+    {
+        loadOutContext->mFirst = true;
+    }
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR EventManagement::CopyEvent(const TLVReader & aReader, TLVWriter & aWriter, EventLoadOutContext * apContext)
 {
     TLVReader reader;
@@ -629,27 +715,39 @@ CHIP_ERROR EventManagement::CopyEventsSince(const TLVReader & aReader, size_t aD
     EventEnvelopeContext event;
     bool encodeEvent = false;
     CHIP_ERROR err   = EventIterator(aReader, aDepth, loadOutContext, &event, encodeEvent);
+    if ((err == CHIP_NO_ERROR) && (loadOutContext->mpPersistentEventStore != nullptr))
+    {
+        ReturnErrorOnFailure(CopyStoredEventsBefore(event.mEventNumber, *loadOutContext));
+        loadOutContext->mCurrentTime        = event.mCurrentTime;
+        loadOutContext->mCurrentEventNumber = event.mEventNumber;
+    }
     if ((err == CHIP_NO_ERROR) && encodeEvent)
     {
-        // checkpoint the writer
-        TLV::TLVWriter checkpoint = loadOutContext->mWriter;
+        err = CopyIncludedEvent(aReader, *loadOutContext);
+    }
+    return err;
+}
 
-        err = CopyEvent(aReader, loadOutContext->mWriter, loadOutContext);
+CHIP_ERROR EventManagement::CopyIncludedEvent(const TLVReader & aReader, EventLoadOutContext & aContext)
+{
+    // checkpoint the writer
+    TLV::TLVWriter checkpoint = aContext.mWriter;
 
-        // CHIP_NO_ERROR and CHIP_END_OF_TLV signify a
-        // successful copy.  In all other cases, roll back the
-        // writer state back to the checkpoint, i.e., the state
-        // before we began the copy operation.
-        if ((err != CHIP_NO_ERROR) && (err != CHIP_END_OF_TLV))
-        {
-            loadOutContext->mWriter = checkpoint;
-            return err;
-        }
+    CHIP_ERROR err = CopyEvent(aReader, aContext.mWriter, &aContext);
 
-        loadOutContext->mPreviousTime.mValue = loadOutContext->mCurrentTime.mValue;
-        loadOutContext->mFirst               = false;
-        loadOutContext->mEventCount++;
+    // CHIP_NO_ERROR and CHIP_END_OF_TLV signify a
+    // successful copy.  In all other cases, roll back the
+    // writer state back to the checkpoint, i.e., the state
+    // before we began the copy operation.
+    if ((err != CHIP_NO_ERROR) && (err != CHIP_END_OF_TLV))
+    {
+        aContext.mWriter = checkpoint;
+        return err;
     }
+
+    aContext.mPreviousTime.mValue = aContext.mCurrentTime.mValue;
+    aContext.mFirst               = false;
+    aContext.mEventCount++;
     return err;
 }
 
@@ -658,15 +756,30 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
                                              const Access::SubjectDescriptor & aSubjectDescriptor)
 {
     // TODO: Add particular set of event Paths in FetchEventsSince so that we can filter the interested paths
-    CHIP_ERROR err     = CHIP_NO_ERROR;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE == 0
     const bool recurse = false;
     TLVReader reader;
     CircularEventBufferWrapper bufWrapper;
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE == 0
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+    context.mpPersistentEventStore = mpPersistentEventStore;
+    context.mNextStoredEventNumber = aEventMin;
+    VerifyOrExit(mpEventBuffer != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+    // Events move from the less important buffers to the more important ones as they age, so the oldest events are in the
+    // buffer for critical events.
+    for (CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr && err == CHIP_NO_ERROR;
+         buffer                       = buffer->GetPreviousCircularEventBuffer())
+    {
+        err = FetchEventsFromBuffer(*buffer, context);
+    }
+#else
+    err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
     SuccessOrExit(err);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
@@ -674,6 +787,13 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     {
         err = CHIP_NO_ERROR;
     }
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+
+    // The store may also have events newer than the last one in the event buffers, e.g. when these were emptied by a reboot.
+    if (err == CHIP_NO_ERROR)
+    {
+        err = CopyStoredEventsBefore(mLastEventNumber, context);
+    }
 
 exit:
     if (err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY)
@@ -690,6 +810,68 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+static bool IsClusterInterested(const SingleLinkedListNode<EventPathParams> * apInterestedEventPaths,
+                                const CircularEventBuffer::EventIndexEntry & aEntry)
+{
+    for (auto * path = apInterestedEventPaths; path != nullptr; path = path->mpNext)
+    {
+        if ((path->mValue.HasWildcardEndpointId() || path->mValue.mEndpointId == aEntry.mEndpointId) &&
+            (path->mValue.HasWildcardClusterId() || path->mValue.mClusterId == aEntry.mClusterId))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+CHIP_ERROR EventManagement::FetchEventsFromBuffer(CircularEventBuffer & aBuffer, EventLoadOutContext & aContext)
+{
+    uint32_t offset = aBuffer.GetUnindexedDataLength();
+
+    // Events that no longer fit in the index have to be decoded to be filtered.
+    if (offset > 0)
+    {
+        ReturnErrorOnFailure(CopyEventsInRange(aBuffer, 0, offset, aContext));
+    }
+
+    for (size_t i = 0; i < aBuffer.GetNumIndexedEvents(); i++)
+    {
+        const CircularEventBuffer::EventIndexEntry & entry = aBuffer.GetIndexedEvent(i);
+        if (entry.mEventNumber >= aContext.mStartingEventNumber && IsClusterInterested(aContext.mpInterestedEventPaths, entry))
+        {
+            ReturnErrorOnFailure(CopyEventsInRange(aBuffer, offset, entry.mLength, aContext));
+        }
+        else
+        {
+            ReturnErrorOnFailure(CopyStoredEventsBefore(entry.mEventNumber, aContext));
+            // Same bookkeeping as EventIterator does for events that are not included in the report.
+            aContext.mCurrentEventNumber = entry.mEventNumber;
+        }
+        offset += entry.mLength;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR EventManagement::CopyEventsInRange(CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength,
+                                              EventLoadOutContext & aContext)
+{
+    const uint32_t headOffset = static_cast<uint32_t>(aBuffer.QueueHead() - aBuffer.GetQueue());
+    uint8_t * head            = aBuffer.GetQueue() + (headOffset + aOffset) % aBuffer.GetTotalDataLength();
+
+    TLVCircularBuffer range(aBuffer.GetQueue(), aBuffer.GetTotalDataLength(), head, aLength);
+    CircularTLVReader reader;
+    reader.Init(range);
+
+    CHIP_ERROR err = TLV::Utilities::Iterate(reader, CopyEventsSince, &aContext, false /*recurse*/);
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_NO_ERROR;
+    }
+    return err;
+}
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -854,7 +1036,10 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
     }
 
     // event is not getting dropped. Note how much space it requires, and return.
-    ctx->mSpaceNeededForMovedEvent = aReader.GetLengthRead();
+    ctx->mSpaceNeededForMovedEvent          = aReader.GetLengthRead();
+    ctx->mMovedEventIndexEntry.mEventNumber = context.mEventNumber;
+    ctx->mMovedEventIndexEntry.mClusterId   = context.mClusterId;
+    ctx->mMovedEventIndexEntry.mEndpointId  = context.mEndpointId;
     return CHIP_END_OF_TLV;
 }
 
@@ -887,7 +1072,50 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+    ResetEventIndex();
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+}
+
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+void CircularEventBuffer::AppendEventIndexEntry(const EventIndexEntry & aEntry)
+{
+    if (mNumIndexedEvents == CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE)
+    {
+        // The oldest indexed event stays in the buffer, but has to be decoded by readers from now on.
+        mIndexedDataLength -= mEventIndex[mEventIndexStart].mLength;
+        mEventIndexStart = (mEventIndexStart + 1) % CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE;
+        mNumIndexedEvents--;
+        mNumUnindexedEvents++;
+    }
+
+    mEventIndex[(mEventIndexStart + mNumIndexedEvents) % CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE] = aEntry;
+    mNumIndexedEvents++;
+    mIndexedDataLength += aEntry.mLength;
+}
+
+void CircularEventBuffer::RemoveHeadEventIndexEntry()
+{
+    if (mNumUnindexedEvents > 0)
+    {
+        mNumUnindexedEvents--;
+    }
+    else if (mNumIndexedEvents > 0)
+    {
+        mIndexedDataLength -= mEventIndex[mEventIndexStart].mLength;
+        mEventIndexStart = (mEventIndexStart + 1) % CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE;
+        mNumIndexedEvents--;
+    }
+}
+
+void CircularEventBuffer::ResetEventIndex()
+{
+    mEventIndexStart    = 0;
+    mNumIndexedEvents   = 0;
+    mNumUnindexedEvents = 0;
+    mIndexedDataLength  = 0;
 }
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
 {
@@ -32,6 +32,7 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
+#include <app/PersistentEventStore.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
 #include <lib/core/TLVCircularBuffer.h>
@@ -130,9 +131,67 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Summary of an event stored in the buffer, used by EventManagement::FetchEventsSince to find the events a reader may be
+     *   interested in without decoding every event.
+     */
+    struct EventIndexEntry
+    {
+        EventNumber mEventNumber = 0;
+        ClusterId mClusterId     = 0;
+        EndpointId mEndpointId   = 0;
+        uint16_t mLength         = 0; ///< Encoded length of the event in the buffer
+    };
+
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+    /**
+     * @brief
+     *   Records the event that was just written at the tail of the buffer.  If the index is full, its oldest entry is dropped
+     *   and that event has to be decoded by readers.
+     */
+    void AppendEventIndexEntry(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief
+     *   Forgets the event at the head of the buffer, which was just evicted.
+     */
+    void RemoveHeadEventIndexEntry();
+
+    /**
+     * @brief
+     *   The number of bytes at the head of the buffer holding events without an index entry.
+     */
+    uint32_t GetUnindexedDataLength() const { return DataLength() - mIndexedDataLength; }
+
+    size_t GetNumIndexedEvents() const { return mNumIndexedEvents; }
+
+    /**
+     * @brief
+     *   The index entry for the aIndex-th event following the unindexed data, oldest first.
+     */
+    const EventIndexEntry & GetIndexedEvent(size_t aIndex) const
+    {
+        return mEventIndex[(mEventIndexStart + aIndex) % CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE];
+    }
+#else
+    void AppendEventIndexEntry(const EventIndexEntry &) {}
+    void RemoveHeadEventIndexEntry() {}
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+
     ~CircularEventBuffer() override = default;
 
 private:
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+    void ResetEventIndex();
+
+    EventIndexEntry mEventIndex[CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE]; ///< Ring of entries for the newest events in the buffer
+    size_t mEventIndexStart     = 0;
+    size_t mNumIndexedEvents    = 0;
+    size_t mNumUnindexedEvents  = 0; ///< Number of events at the head of the buffer without an index entry
+    uint32_t mIndexedDataLength = 0; ///< Sum of the lengths of the indexed events
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -367,6 +426,15 @@ public:
     CHIP_ERROR FetchEventsSince(chip::TLV::TLVWriter & aWriter, const SingleLinkedListNode<EventPathParams> * apEventPathList,
                                 EventNumber & aEventMin, size_t & aEventCount,
                                 const Access::SubjectDescriptor & aSubjectDescriptor);
+    /**
+     * @brief
+     *   Sets the store that keeps a copy of every logged event, or nullptr to keep events only in the event buffers.
+     *
+     * FetchEventsSince gets the events that are missing from the event buffers, because they were evicted or logged before a
+     * reboot, from the store.  Fabric-scoped events are not stored, since they have to disappear when their fabric is removed.
+     */
+    void SetPersistentEventStore(PersistentEventStore * apStore) { mpPersistentEventStore = apStore; }
+
     /**
      * @brief brief Iterate all events and invalidate the fabric-sensitive events whose associated fabric has the given fabric
      * index.
@@ -455,13 +523,37 @@ private:
     // Internal function to log event
     CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
 
+    /**
+     * @brief Hands the event of aLength bytes that was just written to the tail of the first event buffer to the persistent
+     * event store.
+     */
+    void PersistEvent(EventNumber aEventNumber, PriorityLevel aPriority, uint32_t aLength);
+
+    /**
+     * @brief Copies the events of the persistent event store from the first one not yet copied up to, but not including,
+     * aEventNumber.  Used by #FetchEventsSince before each event of the event buffers, so that the events missing from the event
+     * buffers are copied in event number order.
+     */
+    static CHIP_ERROR CopyStoredEventsBefore(EventNumber aEventNumber, EventLoadOutContext & aContext);
+
+    /**
+     * @brief PersistentEventStore::EventCallback used by #CopyStoredEventsBefore.
+     */
+    static CHIP_ERROR CopyStoredEvent(EventNumber aEventNumber, const ByteSpan & aEvent, bool aFromEarlierBoot, void * apContext);
+
+    /**
+     * @brief Copies the event at aReader, which #EventIterator included in the report, to the writer of aContext.
+     */
+    static CHIP_ERROR CopyIncludedEvent(const TLV::TLVReader & aReader, EventLoadOutContext & aContext);
+
     /**
      * @brief copy the event outright to next buffer with higher priority
      *
      * @param[in] apEventBuffer  CircularEventBuffer
+     * @param[in] aIndexEntry    Index entry of the head event, recorded in the next buffer once the event is copied
      *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, CircularEventBuffer::EventIndexEntry aIndexEntry);
 
     /**
      * @brief Ensure that:
@@ -507,6 +599,24 @@ private:
      */
     static CHIP_ERROR CopyEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
 
+#if CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+    /**
+     * @brief
+     *   Internal API used to implement #FetchEventsSince
+     *
+     * Copies the events of aBuffer that the reader described by aContext is interested in, using the index of aBuffer to skip
+     * the events that are older than the starting event number or belong to clusters the reader has no interest in.
+     */
+    static CHIP_ERROR FetchEventsFromBuffer(CircularEventBuffer & aBuffer, EventLoadOutContext & aContext);
+
+    /**
+     * @brief
+     *   Runs #CopyEventsSince on the events stored in the aLength bytes of aBuffer that start aOffset bytes after its head.
+     */
+    static CHIP_ERROR CopyEventsInRange(CircularEventBuffer & aBuffer, uint32_t aOffset, uint32_t aLength,
+                                        EventLoadOutContext & aContext);
+#endif // CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE > 0
+
     /**
      * @brief Internal iterator function used to scan and filter though event logs
      *
@@ -580,6 +690,8 @@ private:
     System::Clock::Milliseconds64 mMonotonicStartupTime{};
 
     EventReporter * mpEventReporter = nullptr;
+
+    PersistentEventStore * mpPersistentEventStore = nullptr;
 };
 
 } // namespace app
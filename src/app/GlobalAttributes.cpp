@@ -53,11 +53,12 @@ DataModel::ActionReturnStatus ReadGlobalAttributeFromMetadata(DataModel::Provide
         auto buffer = builder.TakeBuffer();
 
         return encoder.EncodeList([&buffer](const auto & listEncodeHelper) {
-            for (auto id : buffer)
+            // Items sent in earlier chunks do not need to be produced again.
+            for (size_t i = listEncodeHelper.SkipEncodedItems(); i < buffer.size(); i++)
             {
                 // NOTE: cast to u64 because TLV encodes all numbers the same (no TLV sideffects)
                 //       and this reduces template variants for Encode, saving flash.
-                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(id)));
+                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(buffer[i])));
             }
             return CHIP_NO_ERROR;
         });
@@ -72,11 +73,11 @@ DataModel::ActionReturnStatus ReadGlobalAttributeFromMetadata(DataModel::Provide
         auto buffer = builder.TakeBuffer();
 
         return encoder.EncodeList([&buffer](const auto & listEncodeHelper) {
-            for (auto entry : buffer)
+            for (size_t i = listEncodeHelper.SkipEncodedItems(); i < buffer.size(); i++)
             {
                 // NOTE: cast to u64 because TLV encodes all numbers the same (no TLV sideffects)
                 //       and this reduces template variants for Encode, saving flash.
-                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(entry.commandId)));
+                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(buffer[i].commandId)));
             }
             return CHIP_NO_ERROR;
         });
@@ -91,11 +92,11 @@ DataModel::ActionReturnStatus ReadGlobalAttributeFromMetadata(DataModel::Provide
         auto buffer = builder.TakeBuffer();
 
         return encoder.EncodeList([&buffer](const auto & listEncodeHelper) {
-            for (auto entry : buffer)
+            for (size_t i = listEncodeHelper.SkipEncodedItems(); i < buffer.size(); i++)
             {
                 // NOTE: cast to u64 because TLV encodes all numbers the same (no TLV sideffects)
                 //       and this reduces template variants for Encode, saving flash.
-                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(entry.attributeId)));
+                ReturnErrorOnFailure(listEncodeHelper.Encode(static_cast<uint64_t>(buffer[i].attributeId)));
             }
             return CHIP_NO_ERROR;
         });
@@ -143,8 +143,8 @@ bool MayHaveAccessibleEventPath(DataModel::Provider * aProvider, const EventPath
 }
 
 /// Checks if the given path/attributeId, entry are ACL-accessible
-/// for the given subject descriptor
-bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, const Access::SubjectDescriptor & subjectDescriptor,
+/// for the subject descriptor of the given access check batch
+bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, Access::AccessControl::BatchCheck & accessCheck,
                                 const std::optional<DataModel::AttributeEntry> & entry)
 {
     if (!entry.has_value() || !entry->GetReadPrivilege().has_value())
@@ -162,7 +162,7 @@ bool IsAccessibleAttributeEntry(const ConcreteAttributePath & path, const Access
     // the assign below is safe.
     const Access::Privilege privilege = *entry->GetReadPrivilege(); // NOLINT(bugprone-unchecked-optional-access)
 
-    return (Access::GetAccessControl().Check(subjectDescriptor, requestPath, privilege) == CHIP_NO_ERROR);
+    return (accessCheck.Check(requestPath, privilege) == CHIP_NO_ERROR);
 }
 
 } // namespace
@@ -629,6 +629,10 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
     aHasValidAttributePath       = false;
     aRequestedAttributePathCount = 0;
 
+    // The attributes of a cluster all get the same answer from the access control list for a given privilege, so it is only
+    // checked once per cluster when going through an expanded wildcard path.
+    Access::AccessControl::BatchCheck accessCheck(Access::GetAccessControl(), aSubjectDescriptor);
+
     while (CHIP_NO_ERROR == (err = pathReader.Next(TLV::AnonymousTag())))
     {
         AttributePathIB::Parser path;
@@ -658,7 +662,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
                 //
                 // Here we check if the cluster is accessible at all (at least one attribute) for the
                 // given entry permissions.
-                if (IsAccessibleAttributeEntry(readPath, aSubjectDescriptor, entry))
+                if (IsAccessibleAttributeEntry(readPath, accessCheck, entry))
                 {
                     aHasValidAttributePath = true;
                     break;
@@ -672,7 +676,7 @@ CHIP_ERROR InteractionModelEngine::ParseAttributePaths(const Access::SubjectDesc
 
             std::optional<DataModel::AttributeEntry> entry = FindAttributeEntry(concretePath);
 
-            if (IsAccessibleAttributeEntry(concretePath, aSubjectDescriptor, entry))
+            if (IsAccessibleAttributeEntry(concretePath, accessCheck, entry))
             {
                 aHasValidAttributePath = true;
             }
@@ -1674,6 +1678,32 @@ CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(SingleLinkedListNo
     return err;
 }
 
+void InteractionModelEngine::AddReadHandlerToPathIndex(ReadHandler & aReadHandler)
+{
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+    CHIP_ERROR err = mReadHandlerPathIndex.AddReadHandler(aReadHandler);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(InteractionModel, "Failed to index ReadHandler paths: %" CHIP_ERROR_FORMAT, err.Format());
+        aReadHandler.mFlags.Set(ReadHandler::ReadHandlerFlags::NotInPathIndex);
+        mNumReadHandlersNotInPathIndex++;
+    }
+#endif
+}
+
+void InteractionModelEngine::RemoveReadHandlerFromPathIndex(ReadHandler & aReadHandler)
+{
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+    if (aReadHandler.mFlags.Has(ReadHandler::ReadHandlerFlags::NotInPathIndex))
+    {
+        aReadHandler.mFlags.Clear(ReadHandler::ReadHandlerFlags::NotInPathIndex);
+        mNumReadHandlersNotInPathIndex--;
+        return;
+    }
+    mReadHandlerPathIndex.RemoveReadHandler(aReadHandler);
+#endif
+}
+
 std::optional<DataModel::AttributeEntry> InteractionModelEngine::FindAttributeEntry(const ConcreteAttributePath & path)
 {
     DataModel::AttributeFinder finder(mDataModelProvider);
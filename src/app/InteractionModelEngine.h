@@ -54,6 +54,7 @@
 #include <app/data-model-provider/Provider.h>
 #include <app/icd/server/ICDServerConfig.h>
 #include <app/reporting/Engine.h>
+#include <app/reporting/ReadHandlerPathIndex.h>
 #include <app/reporting/ReportScheduler.h>
 #include <app/util/attribute-metadata.h>
 #include <app/util/basic-types.h>
@@ -213,6 +214,17 @@ public:
     // the path SHALL be removed from the list.
     void RemoveDuplicateConcreteAttributePath(SingleLinkedListNode<AttributePathParams> *& aAttributePaths);
 
+    /**
+     * Adds the attribute paths of a ReadHandler to the index the reporting engine uses to find the ReadHandlers affected by a
+     * dirty path.  Called once the path list of the ReadHandler is final; RemoveReadHandlerFromPathIndex must be called
+     * before that list is released.
+     *
+     * If the paths cannot be indexed, the reporting engine falls back to checking the paths of every ReadHandler until
+     * this ReadHandler is removed.
+     */
+    void AddReadHandlerToPathIndex(ReadHandler & aReadHandler);
+    void RemoveReadHandlerFromPathIndex(ReadHandler & aReadHandler);
+
     void ReleaseEventPathList(SingleLinkedListNode<EventPathParams> *& aEventPathList);
 
     CHIP_ERROR PushFrontEventPathParamsList(SingleLinkedListNode<EventPathParams> *& aEventPathList, EventPathParams & aEventPath);
@@ -663,6 +675,13 @@ private:
     ObjectPool<TimedHandler, CHIP_IM_MAX_NUM_TIMED_HANDLER> mTimedHandlers;
     WriteHandler mWriteHandlers[CHIP_IM_MAX_NUM_WRITE_HANDLER];
     reporting::Engine mReportingEngine;
+
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+    reporting::ReadHandlerPathIndex mReadHandlerPathIndex;
+
+    // Number of active ReadHandlers whose paths are missing from mReadHandlerPathIndex.
+    uint32_t mNumReadHandlersNotInPathIndex = 0;
+#endif
     reporting::ReportScheduler * mReportScheduler = nullptr;
 
     static constexpr size_t kReservedHandlersForReads = kMinSupportedReadRequestsPerFabric * (CHIP_CONFIG_MAX_FABRICS);
@@ -0,0 +1,65 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventLoggingTypes.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace app {
+
+/**
+ *   Interface for a storage tier that keeps a copy of logged events outside of the in-memory event buffers of
+ *   EventManagement, so that events can still be fetched after they were evicted from those buffers or after a restart.
+ *
+ *   Events are passed as the TLV-encoded EventReportIB that EventManagement keeps in its buffers.
+ */
+class PersistentEventStore
+{
+public:
+    virtual ~PersistentEventStore() = default;
+
+    /**
+     * Called with every stored event visited by ForEachEvent.  Returning anything but CHIP_NO_ERROR stops the iteration, and
+     * ForEachEvent returns that error.
+     *
+     * aFromEarlierBoot is true for events that were stored before the store was last initialized.  Their system timestamps
+     * count from an earlier boot and cannot be compared with the timestamps of later events.
+     */
+    using EventCallback = CHIP_ERROR (*)(EventNumber aEventNumber, const ByteSpan & aEvent, bool aFromEarlierBoot,
+                                         void * apContext);
+
+    /**
+     * Stores a copy of an event that was just logged.  Events are appended in increasing event number order.
+     *
+     * The store may drop its oldest events to make room for new ones.
+     */
+    virtual CHIP_ERROR AppendEvent(EventNumber aEventNumber, PriorityLevel aPriority, const ByteSpan & aEvent) = 0;
+
+    /**
+     * Calls aCallback with every stored event whose event number is at least aMin and less than aEnd, in increasing event
+     * number order.
+     */
+    virtual CHIP_ERROR ForEachEvent(EventNumber aMin, EventNumber aEnd, EventCallback aCallback, void * apContext) = 0;
+};
+
+} // namespace app
+} // namespace chip
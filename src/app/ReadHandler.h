@@ -338,6 +338,10 @@ private:
 
         // Don't need the response for report data if true
         SuppressResponse = (1 << 5),
+
+        // The attribute paths could not be added to the path index of the InteractionModelEngine, so the reporting engine
+        // has to check them directly when a path is marked dirty.
+        NotInPathIndex = (1 << 6),
     };
 
     /**
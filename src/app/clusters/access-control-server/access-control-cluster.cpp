@@ -63,22 +63,43 @@ using ArlReviewEvent = Events::FabricRestrictionReviewUpdate::Type;
 #endif // CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 
 namespace {
-using EntryProvider = CHIP_ERROR (Access::AccessControl::*)(FabricIndex, AccessControl::EntryIterator &) const;
+using EntryProvider      = CHIP_ERROR (Access::AccessControl::*)(FabricIndex, AccessControl::EntryIterator &) const;
+using EntryCountProvider = CHIP_ERROR (Access::AccessControl::*)(FabricIndex, size_t &) const;
 
+/**
+ * Encodes the entries of every fabric.  When the list is encoded over several chunks, the fabrics whose entries were all sent
+ * in earlier chunks are skipped using `countProvider`, if not null, so that their entries are not read again.
+ */
 CHIP_ERROR ReadAclEntries(FabricTable & fabricTable, Access::AccessControl & accessControl, AttributeValueEncoder & aEncoder,
-                          EntryProvider provider)
+                          EntryProvider provider, EntryCountProvider countProvider)
 {
     AccessControl::EntryIterator iterator;
     AccessControl::Entry entry;
     AclStorage::EncodableEntry encodableEntry(entry);
     return aEncoder.EncodeList([&](const auto & encoder) -> CHIP_ERROR {
+        size_t skip = encoder.SkipEncodedItems();
         for (auto & info : fabricTable)
         {
             auto fabric = info.GetFabricIndex();
+            if (skip > 0 && countProvider != nullptr)
+            {
+                size_t count;
+                ReturnErrorOnFailure((accessControl.*countProvider)(fabric, count));
+                if (skip >= count)
+                {
+                    skip -= count;
+                    continue;
+                }
+            }
             ReturnErrorOnFailure((accessControl.*provider)(fabric, iterator));
             CHIP_ERROR err = CHIP_NO_ERROR;
             while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
             {
+                if (skip > 0)
+                {
+                    skip--;
+                    continue;
+                }
                 ReturnErrorOnFailure(encoder.Encode(encodableEntry));
             }
             VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_SENTINEL, err);
@@ -471,10 +492,12 @@ DataModel::ActionReturnStatus AccessControlCluster::ReadAttribute(const DataMode
     switch (request.path.mAttributeId)
     {
     case AccessControl::Attributes::Acl::Id:
-        return ReadAclEntries(mClusterContext.fabricTable, mClusterContext.accessControl, encoder, &Access::AccessControl::Entries);
+        return ReadAclEntries(mClusterContext.fabricTable, mClusterContext.accessControl, encoder, &Access::AccessControl::Entries,
+                              static_cast<EntryCountProvider>(&Access::AccessControl::GetEntryCount));
     case AccessControl::Attributes::AuxiliaryACL::Id:
+        // Auxiliary entries cannot be counted without iterating over them.
         return ReadAclEntries(mClusterContext.fabricTable, mClusterContext.accessControl, encoder,
-                              &Access::AccessControl::AuxiliaryEntries);
+                              &Access::AccessControl::AuxiliaryEntries, nullptr);
 #if CHIP_CONFIG_ENABLE_ACL_EXTENSIONS
     case AccessControl::Attributes::Extension::Id:
         return ReadExtension(mClusterContext.persistentStorage, mClusterContext.fabricTable, encoder);
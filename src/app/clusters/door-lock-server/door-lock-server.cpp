@@ -4364,7 +4364,8 @@ CHIP_ERROR DoorLockServer::ReadAliroExpeditedTransactionSupportedProtocolVersion
     VerifyOrReturnValue(delegate != nullptr, aEncoder.EncodeEmptyList());
 
     return aEncoder.EncodeList([delegate](const auto & encoder) -> CHIP_ERROR {
-        for (uint8_t i = 0; true; i++)
+        // Versions sent in earlier chunks are not read from the delegate again.
+        for (auto i = static_cast<uint8_t>(encoder.SkipEncodedItems()); true; i++)
         {
             uint8_t buffer[kAliroProtocolVersionSize];
             MutableByteSpan protocolVersion(buffer);
@@ -4384,7 +4385,8 @@ CHIP_ERROR DoorLockServer::ReadAliroSupportedBLEUWBProtocolVersions(AttributeVal
     VerifyOrReturnValue(delegate != nullptr, aEncoder.EncodeEmptyList());
 
     return aEncoder.EncodeList([delegate](const auto & encoder) -> CHIP_ERROR {
-        for (uint8_t i = 0; true; i++)
+        // Versions sent in earlier chunks are not read from the delegate again.
+        for (auto i = static_cast<uint8_t>(encoder.SkipEncodedItems()); true; i++)
         {
             uint8_t buffer[kAliroProtocolVersionSize];
             MutableByteSpan protocolVersion(buffer);
@@ -140,6 +140,8 @@ CHIP_ERROR ReadGroupKeyMap(FabricTable & fabricTable, GroupDataProvider & provid
 {
     return aEncoder.EncodeList([&fabricTable, &provider](const auto & encoder) -> CHIP_ERROR {
         CHIP_ERROR encodeStatus = CHIP_NO_ERROR;
+        // Mappings sent in earlier chunks are not encoded again, and fabrics whose mappings were all sent are not read.
+        size_t skip = encoder.SkipEncodedItems();
 
         for (auto & fabric : fabricTable)
         {
@@ -147,9 +149,21 @@ CHIP_ERROR ReadGroupKeyMap(FabricTable & fabricTable, GroupDataProvider & provid
             auto iter         = provider.IterateGroupKeys(fabric_index);
             VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+            if (skip >= iter->Count())
+            {
+                skip -= iter->Count();
+                iter->Release();
+                continue;
+            }
+
             GroupDataProvider::GroupKey mapping;
             while (iter->Next(mapping))
             {
+                if (skip > 0)
+                {
+                    skip--;
+                    continue;
+                }
                 GroupKeyManagement::Structs::GroupKeyMapStruct::Type key = {
                     .groupId       = mapping.group_id,
                     .groupKeySetID = mapping.keyset_id,
@@ -233,6 +247,8 @@ CHIP_ERROR ReadGroupTable(FabricTable & fabricTable, GroupDataProvider & provide
 {
     return aEncoder.EncodeList([&fabricTable, &provider](const auto & encoder) -> CHIP_ERROR {
         CHIP_ERROR encodeStatus = CHIP_NO_ERROR;
+        // Groups sent in earlier chunks are not encoded again, and fabrics whose groups were all sent are not read.
+        size_t skip = encoder.SkipEncodedItems();
 
         for (auto & fabric : fabricTable)
         {
@@ -240,9 +256,21 @@ CHIP_ERROR ReadGroupTable(FabricTable & fabricTable, GroupDataProvider & provide
             auto iter         = provider.IterateGroupInfo(fabric_index);
             VerifyOrReturnError(nullptr != iter, CHIP_ERROR_NO_MEMORY);
 
+            if (skip >= iter->Count())
+            {
+                skip -= iter->Count();
+                iter->Release();
+                continue;
+            }
+
             GroupDataProvider::GroupInfo info;
             while (iter->Next(info))
             {
+                if (skip > 0)
+                {
+                    skip--;
+                    continue;
+                }
                 encodeStatus = encoder.Encode(GroupTableCodec(&provider, fabric_index, info));
                 if (encodeStatus != CHIP_NO_ERROR)
                 {
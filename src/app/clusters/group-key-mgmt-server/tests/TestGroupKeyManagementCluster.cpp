@@ -226,6 +226,36 @@ TEST_F(TestGroupKeyManagementCluster, TestWriteGroupKeyMapAttribute)
     }
 }
 
+// A chunked read that resumes after the first two mappings must only produce the remaining one.
+TEST_F(TestGroupKeyManagementCluster, TestReadGroupKeyMapResumesFromLastEncodedItem)
+{
+    auto keys = TestHelpers::CreateGroupKeyMapList(3, kTestFabricIndex);
+    PrepopulateGroupKeyMap(keys, ListWritingPattern::ReplaceAll);
+
+    Access::SubjectDescriptor subjectDescriptor;
+    subjectDescriptor.fabricIndex = kTestFabricIndex;
+    subjectDescriptor.authMode    = Access::AuthMode::kCase;
+
+    ReadOperation readOperation(kRootEndpointId, GroupKeyManagement::Id, GroupKeyManagement::Attributes::GroupKeyMap::Id);
+    readOperation.SetSubjectDescriptor(subjectDescriptor);
+
+    AttributeEncodeState resumeState;
+    resumeState.SetCurrentEncodingListIndex(2).SetListItemsGenerated(2);
+    std::unique_ptr<AttributeValueEncoder> encoder =
+        readOperation.StartEncoding(ReadOperation::EncodingParams().SetEncodingState(resumeState));
+    ASSERT_TRUE(mCluster.ReadAttribute(readOperation.GetRequest(), *encoder).IsSuccess());
+    ASSERT_EQ(readOperation.FinishEncoding(), CHIP_NO_ERROR);
+
+    std::vector<DecodedAttributeData> attributeData;
+    ASSERT_EQ(readOperation.GetEncodedIBs().Decode(attributeData), CHIP_NO_ERROR);
+    ASSERT_EQ(attributeData.size(), 1u);
+
+    GroupKeyManagement::Structs::GroupKeyMapStruct::DecodableType key;
+    ASSERT_EQ(DataModel::Decode(attributeData[0].dataReader, key), CHIP_NO_ERROR);
+    EXPECT_EQ(key.groupId, keys[2].groupId);
+    EXPECT_EQ(key.groupKeySetID, keys[2].groupKeySetID);
+}
+
 const chip::EndpointId kTestEndpoint1 = 10;
 const chip::EndpointId kTestEndpoint2 = 11;
 constexpr uint64_t kStartTimeOffset   = 100;
@@ -0,0 +1,570 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/event-store/MmapSegmentEventStore.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace app {
+
+using namespace Encoding;
+
+namespace {
+
+// Segment header: magic, version (16 bits), priority (8 bits), padding, sequence (32 bits), reserved (32 bits).
+constexpr uint8_t kSegmentMagic[]         = { 'C', 'E', 'V', 'S' };
+constexpr uint16_t kSegmentVersion        = 1;
+constexpr size_t kSegmentVersionOffset    = 4;
+constexpr size_t kSegmentPriorityOffset   = 6;
+constexpr size_t kSegmentSequenceOffset   = 8;
+constexpr uint32_t kSegmentHeaderSize     = 16;
+
+// Event record: payload length (32 bits), checksum (32 bits), event number (64 bits), payload.  The checksum covers the
+// event number and the payload.  The length is written last, and a zero length marks the end of the segment data since
+// segments are created zero-filled.
+constexpr size_t kRecordChecksumOffset    = 4;
+constexpr size_t kRecordEventNumberOffset = 8;
+constexpr uint32_t kRecordHeaderSize      = 16;
+
+struct Crc32Table
+{
+    constexpr Crc32Table()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+            }
+            mEntries[i] = crc;
+        }
+    }
+
+    uint32_t mEntries[256] = {};
+};
+
+constexpr Crc32Table kCrc32Table;
+
+uint32_t ComputeChecksum(const uint8_t * aData, size_t aLength)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < aLength; i++)
+    {
+        crc = kCrc32Table.mEntries[(crc ^ aData[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+bool ParseSegmentFileName(const char * aName, size_t & aPriority, uint32_t & aSequence)
+{
+    unsigned priority = 0;
+    int consumed      = 0;
+    if (sscanf(aName, "events-%1u-%10" SCNu32 ".seg%n", &priority, &aSequence, &consumed) != 2 || consumed == 0 ||
+        aName[consumed] != '\0')
+    {
+        return false;
+    }
+    aPriority = priority;
+    return true;
+}
+
+} // namespace
+
+CHIP_ERROR MmapSegmentEventStore::Init(const Config & aConfig)
+{
+    VerifyOrReturnError(!mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aConfig.mDirectory != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aConfig.mSegmentSize > kSegmentHeaderSize + kRecordHeaderSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aConfig.mMaxSegmentsPerPriority > 0 && aConfig.mMaxSegmentsPerPriority <= kMaxSegmentsPerPriority,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mConfig = aConfig;
+
+    // Collect the sequence numbers of the existing segments, sorted in increasing order.  Only the newest segments of each
+    // priority are kept; older ones are left over from a configuration with more segments and are deleted.
+    uint32_t sequences[kNumPriorities][kMaxSegmentsPerPriority];
+    uint8_t numSequences[kNumPriorities] = {};
+    char path[kMaxPathLength];
+
+    DIR * dir = opendir(mConfig.mDirectory);
+    VerifyOrReturnError(dir != nullptr, CHIP_ERROR_POSIX(errno));
+    for (dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+    {
+        size_t priority;
+        uint32_t sequence;
+        if (!ParseSegmentFileName(entry->d_name, priority, sequence) || priority >= kNumPriorities)
+        {
+            continue;
+        }
+
+        uint32_t * prioritySequences = sequences[priority];
+        uint8_t & count              = numSequences[priority];
+        if (count == mConfig.mMaxSegmentsPerPriority)
+        {
+            uint32_t oldest = std::min(sequence, prioritySequences[0]);
+            if (FormatSegmentPath(path, priority, oldest) == CHIP_NO_ERROR)
+            {
+                unlink(path);
+            }
+            if (oldest == sequence)
+            {
+                continue;
+            }
+            memmove(&prioritySequences[0], &prioritySequences[1], (count - 1u) * sizeof(prioritySequences[0]));
+            count--;
+        }
+
+        uint8_t position = count;
+        for (; position > 0 && prioritySequences[position - 1] > sequence; position--)
+        {
+            prioritySequences[position] = prioritySequences[position - 1];
+        }
+        prioritySequences[position] = sequence;
+        count++;
+    }
+    closedir(dir);
+
+    for (size_t priority = 0; priority < kNumPriorities; priority++)
+    {
+        PrioritySegments & segments = mPriorities[priority];
+        for (uint8_t i = 0; i < numSequences[priority]; i++)
+        {
+            Segment & segment = segments.mSegments[segments.mNumSegments];
+            CHIP_ERROR err    = OpenSegment(priority, sequences[priority][i], segment);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(EventLogging, "Dropping event segment %u-%" PRIu32 ": %" CHIP_ERROR_FORMAT,
+                             static_cast<unsigned>(priority), sequences[priority][i], err.Format());
+                if (FormatSegmentPath(path, priority, sequences[priority][i]) == CHIP_NO_ERROR)
+                {
+                    unlink(path);
+                }
+                continue;
+            }
+            RecoverSegment(segment);
+            segments.mNumSegments++;
+        }
+    }
+
+    mSyncScheduled     = false;
+    mDirectoryUnsynced = false;
+    mAppendedSinceInit = false;
+    mInitialized       = true;
+    return CHIP_NO_ERROR;
+}
+
+void MmapSegmentEventStore::Shutdown()
+{
+    VerifyOrReturn(mInitialized);
+
+    if (mSyncScheduled)
+    {
+        mConfig.mSystemLayer->CancelTimer(OnSyncTimer, this);
+        mSyncScheduled = false;
+    }
+
+    CHIP_ERROR err = Sync();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to sync event segments: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    for (PrioritySegments & segments : mPriorities)
+    {
+        for (uint8_t i = 0; i < segments.mNumSegments; i++)
+        {
+            munmap(segments.mSegments[i].mData, segments.mSegments[i].mSize);
+            segments.mSegments[i] = Segment();
+        }
+        segments.mNumSegments = 0;
+    }
+    mInitialized = false;
+}
+
+CHIP_ERROR MmapSegmentEventStore::Sync()
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+
+    // Segments that were filled since the last sync have unsynced data as well as the newest ones.
+    for (PrioritySegments & segments : mPriorities)
+    {
+        for (uint8_t i = 0; i < segments.mNumSegments; i++)
+        {
+            ReturnErrorOnFailure(SyncSegment(segments.mSegments[i]));
+        }
+    }
+    if (mDirectoryUnsynced)
+    {
+        ReturnErrorOnFailure(SyncDirectory());
+        mDirectoryUnsynced = false;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MmapSegmentEventStore::AppendEvent(EventNumber aEventNumber, PriorityLevel aPriority, const ByteSpan & aEvent)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    const size_t priority = to_underlying(aPriority);
+    VerifyOrReturnError(priority < kNumPriorities, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!aEvent.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aEvent.size() <= mConfig.mSegmentSize - kSegmentHeaderSize - kRecordHeaderSize,
+                        CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    PrioritySegments & segments = mPriorities[priority];
+    const uint32_t recordSize   = static_cast<uint32_t>(kRecordHeaderSize + aEvent.size());
+    bool needsSegment           = (segments.mNumSegments == 0);
+    if (!needsSegment)
+    {
+        const Segment & newest = segments.mSegments[segments.mNumSegments - 1];
+        VerifyOrReturnError(!newest.mHasEvents || aEventNumber > newest.mLastEventNumber, CHIP_ERROR_INVALID_ARGUMENT);
+        needsSegment = (newest.mSize - newest.mUsed < recordSize);
+    }
+    if (needsSegment)
+    {
+        ReturnErrorOnFailure(StartSegment(priority));
+    }
+
+    Segment & segment = segments.mSegments[segments.mNumSegments - 1];
+    uint8_t * record  = segment.mData + segment.mUsed;
+
+    memcpy(record + kRecordHeaderSize, aEvent.data(), aEvent.size());
+    LittleEndian::Put64(record + kRecordEventNumberOffset, aEventNumber);
+    LittleEndian::Put32(record + kRecordChecksumOffset,
+                        ComputeChecksum(record + kRecordEventNumberOffset, sizeof(uint64_t) + aEvent.size()));
+    LittleEndian::Put32(record, static_cast<uint32_t>(aEvent.size()));
+
+    if (!segment.mHasEvents)
+    {
+        segment.mFirstEventNumber = aEventNumber;
+        segment.mHasEvents        = true;
+    }
+    segment.mLastEventNumber = aEventNumber;
+    segment.mUsed += recordSize;
+
+    if (!mAppendedSinceInit)
+    {
+        mFirstAppend       = aEventNumber;
+        mAppendedSinceInit = true;
+    }
+    ScheduleSync();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MmapSegmentEventStore::ForEachEvent(EventNumber aMin, EventNumber aEnd, EventCallback aCallback, void * apContext)
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aCallback != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Start each priority at its newest segment that does not begin after aMin, so that older segments need not be read.
+    Cursor cursors[kNumPriorities];
+    for (size_t priority = 0; priority < kNumPriorities; priority++)
+    {
+        const PrioritySegments & segments = mPriorities[priority];
+        for (uint8_t i = 0; i < segments.mNumSegments; i++)
+        {
+            if (segments.mSegments[i].mHasEvents && segments.mSegments[i].mFirstEventNumber <= aMin)
+            {
+                cursors[priority].mSegment = i;
+            }
+        }
+        cursors[priority].mOffset = kSegmentHeaderSize;
+    }
+
+    // Each priority holds its events in increasing order, so merge them by always visiting the smallest next event number.
+    while (true)
+    {
+        size_t next                 = kNumPriorities;
+        EventNumber nextEventNumber = 0;
+        ByteSpan nextEvent;
+
+        for (size_t priority = 0; priority < kNumPriorities; priority++)
+        {
+            EventNumber eventNumber = 0;
+            ByteSpan event;
+            bool found;
+            while ((found = ReadEvent(mPriorities[priority], cursors[priority], eventNumber, event)) && eventNumber < aMin)
+            {
+                cursors[priority].mOffset += kRecordHeaderSize + static_cast<uint32_t>(event.size());
+            }
+            if (found && eventNumber < aEnd && (next == kNumPriorities || eventNumber < nextEventNumber))
+            {
+                next            = priority;
+                nextEventNumber = eventNumber;
+                nextEvent       = event;
+            }
+        }
+
+        VerifyOrReturnError(next != kNumPriorities, CHIP_NO_ERROR);
+        const bool fromEarlierBoot = !mAppendedSinceInit || nextEventNumber < mFirstAppend;
+        ReturnErrorOnFailure(aCallback(nextEventNumber, nextEvent, fromEarlierBoot, apContext));
+        cursors[next].mOffset += kRecordHeaderSize + static_cast<uint32_t>(nextEvent.size());
+    }
+}
+
+CHIP_ERROR MmapSegmentEventStore::FormatSegmentPath(char (&aPath)[kMaxPathLength], size_t aPriority, uint32_t aSequence) const
+{
+    int length = snprintf(aPath, sizeof(aPath), "%s/events-%u-%" PRIu32 ".seg", mConfig.mDirectory,
+                          static_cast<unsigned>(aPriority), aSequence);
+    VerifyOrReturnError(length > 0 && static_cast<size_t>(length) < sizeof(aPath), CHIP_ERROR_BUFFER_TOO_SMALL);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MmapSegmentEventStore::OpenSegment(size_t aPriority, uint32_t aSequence, Segment & aSegment)
+{
+    char path[kMaxPathLength];
+    ReturnErrorOnFailure(FormatSegmentPath(path, aPriority, aSequence));
+
+    int fd = open(path, O_RDWR | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        CHIP_ERROR err = CHIP_ERROR_POSIX(errno);
+        close(fd);
+        return err;
+    }
+    if (info.st_size < static_cast<off_t>(kSegmentHeaderSize) || info.st_size > static_cast<off_t>(UINT32_MAX))
+    {
+        close(fd);
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    const uint32_t size = static_cast<uint32_t>(info.st_size);
+    void * data         = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+    VerifyOrReturnError(data != MAP_FAILED, CHIP_ERROR_POSIX(errno));
+
+    const uint8_t * header = static_cast<const uint8_t *>(data);
+    if (memcmp(header, kSegmentMagic, sizeof(kSegmentMagic)) != 0 ||
+        LittleEndian::Get16(header + kSegmentVersionOffset) != kSegmentVersion || header[kSegmentPriorityOffset] != aPriority ||
+        LittleEndian::Get32(header + kSegmentSequenceOffset) != aSequence)
+    {
+        munmap(data, size);
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    aSegment           = Segment();
+    aSegment.mSequence = aSequence;
+    aSegment.mData     = static_cast<uint8_t *>(data);
+    aSegment.mSize     = size;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MmapSegmentEventStore::StartSegment(size_t aPriority)
+{
+    PrioritySegments & segments = mPriorities[aPriority];
+    uint32_t sequence           = 0;
+    if (segments.mNumSegments > 0)
+    {
+        sequence = segments.mSegments[segments.mNumSegments - 1].mSequence + 1;
+    }
+    if (segments.mNumSegments == mConfig.mMaxSegmentsPerPriority)
+    {
+        RemoveOldestSegment(aPriority);
+    }
+
+    char path[kMaxPathLength];
+    ReturnErrorOnFailure(FormatSegmentPath(path, aPriority, sequence));
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+
+    void * data = MAP_FAILED;
+    if (ftruncate(fd, mConfig.mSegmentSize) == 0)
+    {
+        data = mmap(nullptr, mConfig.mSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    CHIP_ERROR err = (data == MAP_FAILED) ? CHIP_ERROR_POSIX(errno) : CHIP_NO_ERROR;
+    close(fd);
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(path);
+        return err;
+    }
+
+    uint8_t * header = static_cast<uint8_t *>(data);
+    memcpy(header, kSegmentMagic, sizeof(kSegmentMagic));
+    LittleEndian::Put16(header + kSegmentVersionOffset, kSegmentVersion);
+    header[kSegmentPriorityOffset] = static_cast<uint8_t>(aPriority);
+    LittleEndian::Put32(header + kSegmentSequenceOffset, sequence);
+
+    Segment & segment = segments.mSegments[segments.mNumSegments++];
+    segment           = Segment();
+    segment.mSequence = sequence;
+    segment.mData     = header;
+    segment.mSize     = mConfig.mSegmentSize;
+    segment.mUsed     = kSegmentHeaderSize;
+
+    // The header and the new directory entry are synced with the events appended to the segment.
+    mDirectoryUnsynced = true;
+    return CHIP_NO_ERROR;
+}
+
+void MmapSegmentEventStore::RecoverSegment(Segment & aSegment)
+{
+    uint32_t offset = kSegmentHeaderSize;
+    while (aSegment.mSize - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record   = aSegment.mData + offset;
+        const uint32_t length    = LittleEndian::Get32(record);
+        const EventNumber number = LittleEndian::Get64(record + kRecordEventNumberOffset);
+        if (length == 0 || length > aSegment.mSize - offset - kRecordHeaderSize ||
+            LittleEndian::Get32(record + kRecordChecksumOffset) !=
+                ComputeChecksum(record + kRecordEventNumberOffset, sizeof(uint64_t) + length) ||
+            (aSegment.mHasEvents && number <= aSegment.mLastEventNumber))
+        {
+            break;
+        }
+
+        if (!aSegment.mHasEvents)
+        {
+            aSegment.mFirstEventNumber = number;
+            aSegment.mHasEvents        = true;
+        }
+        aSegment.mLastEventNumber = number;
+        offset += kRecordHeaderSize + length;
+    }
+
+    aSegment.mUsed   = offset;
+    aSegment.mSynced = offset;
+
+    // Clear a partially written event so that it is not mistaken for the end of an appended one later on.
+    if (aSegment.mSize - offset >= sizeof(uint32_t) && LittleEndian::Get32(aSegment.mData + offset) != 0)
+    {
+        ChipLogProgress(EventLogging, "Discarding incomplete events at offset %" PRIu32 " of event segment %" PRIu32, offset,
+                        aSegment.mSequence);
+        memset(aSegment.mData + offset, 0, aSegment.mSize - offset);
+
+        const uint32_t pageSize = static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+        const uint32_t start    = offset - offset % pageSize;
+        if (msync(aSegment.mData + start, aSegment.mSize - start, MS_SYNC) != 0)
+        {
+            ChipLogError(EventLogging, "Failed to sync recovered event segment %" PRIu32, aSegment.mSequence);
+        }
+    }
+}
+
+CHIP_ERROR MmapSegmentEventStore::SyncSegment(Segment & aSegment)
+{
+    VerifyOrReturnError(aSegment.mSynced < aSegment.mUsed, CHIP_NO_ERROR);
+
+    // msync needs a page-aligned address, so start at the page holding the first unsynced byte.
+    const uint32_t pageSize = static_cast<uint32_t>(sysconf(_SC_PAGESIZE));
+    const uint32_t start    = aSegment.mSynced - aSegment.mSynced % pageSize;
+    VerifyOrReturnError(msync(aSegment.mData + start, aSegment.mUsed - start, MS_SYNC) == 0, CHIP_ERROR_POSIX(errno));
+
+    aSegment.mSynced = aSegment.mUsed;
+    return CHIP_NO_ERROR;
+}
+
+void MmapSegmentEventStore::RemoveOldestSegment(size_t aPriority)
+{
+    PrioritySegments & segments = mPriorities[aPriority];
+    VerifyOrReturn(segments.mNumSegments > 0);
+
+    char path[kMaxPathLength];
+    munmap(segments.mSegments[0].mData, segments.mSegments[0].mSize);
+    if (FormatSegmentPath(path, aPriority, segments.mSegments[0].mSequence) == CHIP_NO_ERROR)
+    {
+        unlink(path);
+    }
+
+    for (uint8_t i = 1; i < segments.mNumSegments; i++)
+    {
+        segments.mSegments[i - 1] = segments.mSegments[i];
+    }
+    segments.mSegments[--segments.mNumSegments] = Segment();
+}
+
+void MmapSegmentEventStore::ScheduleSync()
+{
+    VerifyOrReturn(mConfig.mSystemLayer != nullptr && !mSyncScheduled);
+
+    CHIP_ERROR err = mConfig.mSystemLayer->StartTimer(mConfig.mSyncDelay, OnSyncTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The events are still synced by the next append that manages to start the timer, or on shutdown.
+        ChipLogError(EventLogging, "Failed to schedule event segment sync: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mSyncScheduled = true;
+}
+
+void MmapSegmentEventStore::OnSyncTimer(System::Layer * aLayer, void * apAppState)
+{
+    MmapSegmentEventStore * store = static_cast<MmapSegmentEventStore *>(apAppState);
+    store->mSyncScheduled         = false;
+
+    CHIP_ERROR err = store->Sync();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to sync event segments: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+CHIP_ERROR MmapSegmentEventStore::SyncDirectory()
+{
+    // Make the creation of a new segment file durable.
+    int fd = open(mConfig.mDirectory, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_POSIX(errno));
+    CHIP_ERROR err = (fsync(fd) == 0) ? CHIP_NO_ERROR : CHIP_ERROR_POSIX(errno);
+    close(fd);
+    return err;
+}
+
+bool MmapSegmentEventStore::ReadEvent(const PrioritySegments & aSegments, Cursor & aCursor, EventNumber & aEventNumber,
+                                      ByteSpan & aEvent) const
+{
+    // Returns the event at aCursor, first moving aCursor to the next segment if it is at the end of its segment.
+    while (aCursor.mSegment < aSegments.mNumSegments)
+    {
+        const Segment & segment = aSegments.mSegments[aCursor.mSegment];
+        if (aCursor.mOffset < segment.mUsed)
+        {
+            const uint8_t * record = segment.mData + aCursor.mOffset;
+            aEventNumber           = LittleEndian::Get64(record + kRecordEventNumberOffset);
+            aEvent                 = ByteSpan(record + kRecordHeaderSize, LittleEndian::Get32(record));
+            return true;
+        }
+        aCursor.mSegment++;
+        aCursor.mOffset = kSegmentHeaderSize;
+    }
+    return false;
+}
+
+} // namespace app
+} // namespace chip
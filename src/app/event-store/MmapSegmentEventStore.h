@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/PersistentEventStore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * @class MmapSegmentEventStore
+ *
+ * @brief PersistentEventStore keeping events in append-only segment files that are memory-mapped, for POSIX platforms.
+ *
+ * Each priority level gets its own sequence of fixed-size segment files named `events-<priority>-<sequence>.seg` in the
+ * configured directory.  Events are appended to the newest segment of their priority; when it is full, a new segment is
+ * started and, once a priority has reached its maximum number of segments, its oldest segment is deleted.  This bounds the
+ * disk space used by each priority to the segment size times the maximum number of segments.
+ *
+ * Every event is stored with a checksum.  Appending an event does not wait for the disk: written data is synced from a timer
+ * shortly after it was appended and when the store is shut down, so a crash can lose the latest events or leave a partially
+ * written one at the end of a segment.  Init drops anything from the first event that fails its checksum to the end of the
+ * segment.  The events found by Init are reported as logged in an earlier boot.
+ */
+class MmapSegmentEventStore : public PersistentEventStore
+{
+public:
+    static constexpr uint8_t kMaxSegmentsPerPriority = 16;
+
+    struct Config
+    {
+        const char * mDirectory         = nullptr;   ///< Existing directory holding the segment files, not shared with other stores
+        uint32_t mSegmentSize           = 64 * 1024; ///< Size of each segment file in bytes
+        uint8_t mMaxSegmentsPerPriority = 4;         ///< At most kMaxSegmentsPerPriority
+        /// Layer running the sync timer.  Without one, appended events are only synced by Sync() and Shutdown().
+        System::Layer * mSystemLayer             = nullptr;
+        System::Clock::Milliseconds32 mSyncDelay = System::Clock::Milliseconds32(1000); ///< Delay from an append to its sync
+    };
+
+    MmapSegmentEventStore() = default;
+    ~MmapSegmentEventStore() override { Shutdown(); }
+
+    MmapSegmentEventStore(const MmapSegmentEventStore &)             = delete;
+    MmapSegmentEventStore & operator=(const MmapSegmentEventStore &) = delete;
+
+    /**
+     * Opens the segments already present in the configured directory, recovering the events they hold.
+     */
+    CHIP_ERROR Init(const Config & aConfig);
+
+    /**
+     * Syncs and closes all segments.
+     */
+    void Shutdown();
+
+    /**
+     * Writes the events appended since the last sync to disk.  Called by the sync timer, or by the user when there is no
+     * system layer.
+     */
+    CHIP_ERROR Sync();
+
+    CHIP_ERROR AppendEvent(EventNumber aEventNumber, PriorityLevel aPriority, const ByteSpan & aEvent) override;
+    CHIP_ERROR ForEachEvent(EventNumber aMin, EventNumber aEnd, EventCallback aCallback, void * apContext) override;
+
+private:
+    static constexpr size_t kNumPriorities = 3;
+    static constexpr size_t kMaxPathLength = 256;
+
+    struct Segment
+    {
+        uint32_t mSequence            = 0;
+        uint8_t * mData               = nullptr;
+        uint32_t mSize                = 0;
+        uint32_t mUsed                = 0; ///< End of the last event
+        uint32_t mSynced              = 0; ///< End of the last event known to be on disk
+        EventNumber mFirstEventNumber = 0;
+        EventNumber mLastEventNumber  = 0;
+        bool mHasEvents               = false;
+    };
+
+    struct PrioritySegments
+    {
+        Segment mSegments[kMaxSegmentsPerPriority]; ///< Oldest first
+        uint8_t mNumSegments = 0;
+    };
+
+    struct Cursor
+    {
+        uint8_t mSegment = 0;
+        uint32_t mOffset = 0;
+    };
+
+    CHIP_ERROR FormatSegmentPath(char (&aPath)[kMaxPathLength], size_t aPriority, uint32_t aSequence) const;
+    CHIP_ERROR OpenSegment(size_t aPriority, uint32_t aSequence, Segment & aSegment);
+    CHIP_ERROR StartSegment(size_t aPriority);
+    void RecoverSegment(Segment & aSegment);
+    CHIP_ERROR SyncSegment(Segment & aSegment);
+    void RemoveOldestSegment(size_t aPriority);
+    CHIP_ERROR SyncDirectory();
+    void ScheduleSync();
+    static void OnSyncTimer(System::Layer * aLayer, void * apAppState);
+
+    bool ReadEvent(const PrioritySegments & aSegments, Cursor & aCursor, EventNumber & aEventNumber, ByteSpan & aEvent) const;
+
+    Config mConfig;
+    bool mInitialized       = false;
+    bool mSyncScheduled     = false;
+    bool mDirectoryUnsynced = false; ///< A segment file was created since the last sync
+    bool mAppendedSinceInit = false; ///< Whether mFirstAppend is set
+    /// First event appended since Init, the events before it were logged in an earlier boot.
+    EventNumber mFirstAppend = 0;
+    PrioritySegments mPriorities[kNumPriorities];
+};
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,351 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/event-store/MmapSegmentEventStore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/Span.h>
+#include <system/SystemLayer.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+struct StoredEvent
+{
+    EventNumber mEventNumber;
+    std::vector<uint8_t> mData;
+    bool mFromEarlierBoot;
+};
+
+CHIP_ERROR CollectEvent(EventNumber aEventNumber, const ByteSpan & aEvent, bool aFromEarlierBoot, void * apContext)
+{
+    auto * events = static_cast<std::vector<StoredEvent> *>(apContext);
+    events->push_back({ aEventNumber, { aEvent.begin(), aEvent.end() }, aFromEarlierBoot });
+    return CHIP_NO_ERROR;
+}
+
+// System layer that only records the timers started on it, so that tests can fire them.
+class TimerRecordingLayer : public System::Layer
+{
+public:
+    CriticalFailure Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override {}
+    bool IsInitialized() const override { return true; }
+
+    CriticalFailure StartTimer(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        mNumStartedTimers++;
+        mComplete = aComplete;
+        mAppState = aAppState;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout aDelay, System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    bool IsTimerActive(System::TimerCompleteCallback aComplete, void * aAppState) override { return mComplete != nullptr; }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return System::Clock::kZero;
+    }
+    void CancelTimer(System::TimerCompleteCallback aComplete, void * aAppState) override { mComplete = nullptr; }
+    CriticalFailure ScheduleWork(System::TimerCompleteCallback aComplete, void * aAppState) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+    void FireTimer()
+    {
+        System::TimerCompleteCallback complete = mComplete;
+        mComplete                              = nullptr;
+        complete(this, mAppState);
+    }
+
+    size_t mNumStartedTimers                = 0;
+    System::TimerCompleteCallback mComplete = nullptr;
+    void * mAppState                        = nullptr;
+};
+
+std::vector<StoredEvent> CollectEvents(MmapSegmentEventStore & aStore, EventNumber aMin = 0, EventNumber aEnd = UINT64_MAX)
+{
+    std::vector<StoredEvent> events;
+    EXPECT_EQ(aStore.ForEachEvent(aMin, aEnd, CollectEvent, &events), CHIP_NO_ERROR);
+    return events;
+}
+
+// Payloads differ in size and content from one event to the next.
+std::vector<uint8_t> MakePayload(EventNumber aEventNumber)
+{
+    std::vector<uint8_t> payload(8 + aEventNumber % 23);
+    for (size_t i = 0; i < payload.size(); i++)
+    {
+        payload[i] = static_cast<uint8_t>(aEventNumber * 31 + i);
+    }
+    return payload;
+}
+
+PriorityLevel PriorityFor(EventNumber aEventNumber)
+{
+    return static_cast<PriorityLevel>(aEventNumber % 3);
+}
+
+CHIP_ERROR AppendEvents(MmapSegmentEventStore & aStore, EventNumber aFirst, EventNumber aEnd)
+{
+    for (EventNumber eventNumber = aFirst; eventNumber < aEnd; eventNumber++)
+    {
+        std::vector<uint8_t> payload = MakePayload(eventNumber);
+        ReturnErrorOnFailure(aStore.AppendEvent(eventNumber, PriorityFor(eventNumber), ByteSpan(payload.data(), payload.size())));
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ExpectEvents(const std::vector<StoredEvent> & aEvents, const std::vector<EventNumber> & aExpected)
+{
+    ASSERT_EQ(aEvents.size(), aExpected.size());
+    for (size_t i = 0; i < aEvents.size(); i++)
+    {
+        EXPECT_EQ(aEvents[i].mEventNumber, aExpected[i]);
+        EXPECT_EQ(aEvents[i].mData, MakePayload(aExpected[i]));
+    }
+}
+
+std::vector<EventNumber> Range(EventNumber aFirst, EventNumber aEnd)
+{
+    std::vector<EventNumber> numbers;
+    for (EventNumber eventNumber = aFirst; eventNumber < aEnd; eventNumber++)
+    {
+        numbers.push_back(eventNumber);
+    }
+    return numbers;
+}
+
+class TestMmapSegmentEventStore : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        strcpy(mDirectory, "/tmp/chip-event-store-XXXXXX");
+        ASSERT_NE(mkdtemp(mDirectory), nullptr);
+        mConfig.mDirectory = mDirectory;
+    }
+
+    void TearDown() override
+    {
+        DIR * dir = opendir(mDirectory);
+        if (dir != nullptr)
+        {
+            for (dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+            {
+                if (entry->d_name[0] != '.')
+                {
+                    unlinkat(dirfd(dir), entry->d_name, 0);
+                }
+            }
+            closedir(dir);
+        }
+        rmdir(mDirectory);
+    }
+
+    size_t CountSegmentFiles(unsigned aPriority)
+    {
+        char prefix[16];
+        snprintf(prefix, sizeof(prefix), "events-%u-", aPriority);
+
+        size_t count = 0;
+        DIR * dir    = opendir(mDirectory);
+        for (dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+        {
+            count += (strncmp(entry->d_name, prefix, strlen(prefix)) == 0) ? 1 : 0;
+        }
+        closedir(dir);
+        return count;
+    }
+
+    char mDirectory[64];
+    MmapSegmentEventStore::Config mConfig;
+};
+
+TEST_F(TestMmapSegmentEventStore, TestEventsAreMergedAcrossPriorities)
+{
+    MmapSegmentEventStore store;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendEvents(store, 0, 30), CHIP_NO_ERROR);
+
+    ExpectEvents(CollectEvents(store), Range(0, 30));
+    ExpectEvents(CollectEvents(store, 7, 19), Range(7, 19));
+    ExpectEvents(CollectEvents(store, 30), {});
+
+    // Event numbers must keep increasing within a priority.
+    std::vector<uint8_t> payload = MakePayload(3);
+    EXPECT_EQ(store.AppendEvent(3, PriorityFor(3), ByteSpan(payload.data(), payload.size())), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // An error returned by the callback stops the iteration.
+    size_t visited = 0;
+    EXPECT_EQ(store.ForEachEvent(
+                  0, UINT64_MAX,
+                  [](EventNumber, const ByteSpan &, bool, void * apContext) {
+                      return ++*static_cast<size_t *>(apContext) == 5 ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+                  },
+                  &visited),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(visited, 5u);
+}
+
+TEST_F(TestMmapSegmentEventStore, TestEventsAreRecoveredAfterReopen)
+{
+    {
+        MmapSegmentEventStore store;
+        ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+        ASSERT_EQ(AppendEvents(store, 0, 40), CHIP_NO_ERROR);
+    }
+
+    MmapSegmentEventStore store;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    ExpectEvents(CollectEvents(store), Range(0, 40));
+
+    ASSERT_EQ(AppendEvents(store, 40, 50), CHIP_NO_ERROR);
+    std::vector<StoredEvent> events = CollectEvents(store);
+    ExpectEvents(events, Range(0, 50));
+
+    // Only the events found when the store was opened come from an earlier boot.
+    for (const StoredEvent & event : events)
+    {
+        EXPECT_EQ(event.mFromEarlierBoot, event.mEventNumber < 40);
+    }
+}
+
+TEST_F(TestMmapSegmentEventStore, TestCorruptedEventIsDropped)
+{
+    {
+        MmapSegmentEventStore store;
+        ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 0; eventNumber < 3; eventNumber++)
+        {
+            std::vector<uint8_t> payload = MakePayload(eventNumber);
+            ASSERT_EQ(store.AppendEvent(eventNumber, PriorityLevel::Info, ByteSpan(payload.data(), payload.size())), CHIP_NO_ERROR);
+        }
+    }
+
+    // Flip the last payload byte of the last event, as if the crash happened while it was being written.
+    char path[128];
+    snprintf(path, sizeof(path), "%s/events-1-0.seg", mDirectory);
+    int fd = open(path, O_RDWR);
+    ASSERT_GE(fd, 0);
+    const off_t lastByte = 16 + (16 + 8) + (16 + 9) + (16 + 10) - 1;
+    uint8_t byte;
+    ASSERT_EQ(pread(fd, &byte, 1, lastByte), 1);
+    byte ^= 0xFF;
+    ASSERT_EQ(pwrite(fd, &byte, 1, lastByte), 1);
+    close(fd);
+
+    MmapSegmentEventStore store;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    ExpectEvents(CollectEvents(store), { 0, 1 });
+
+    // The corrupted event is overwritten by the next one.
+    std::vector<uint8_t> payload = MakePayload(5);
+    ASSERT_EQ(store.AppendEvent(5, PriorityLevel::Info, ByteSpan(payload.data(), payload.size())), CHIP_NO_ERROR);
+    store.Shutdown();
+
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    ExpectEvents(CollectEvents(store), { 0, 1, 5 });
+}
+
+TEST_F(TestMmapSegmentEventStore, TestSegmentsAreBounded)
+{
+    mConfig.mSegmentSize            = 256;
+    mConfig.mMaxSegmentsPerPriority = 3;
+
+    MmapSegmentEventStore store;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    ASSERT_EQ(AppendEvents(store, 0, 300), CHIP_NO_ERROR);
+
+    for (unsigned priority = 0; priority < 3; priority++)
+    {
+        EXPECT_EQ(CountSegmentFiles(priority), 3u);
+    }
+
+    // The oldest events were dropped with their segments; the newest ones of every priority are still there.
+    std::vector<StoredEvent> events = CollectEvents(store);
+    ASSERT_FALSE(events.empty());
+    EXPECT_GT(events.front().mEventNumber, 0u);
+    EXPECT_EQ(events.back().mEventNumber, 299u);
+    for (size_t i = 1; i < events.size(); i++)
+    {
+        EXPECT_LT(events[i - 1].mEventNumber, events[i].mEventNumber);
+        EXPECT_EQ(events[i].mData, MakePayload(events[i].mEventNumber));
+    }
+
+    // Events that do not fit in a segment are rejected.
+    std::vector<uint8_t> payload(mConfig.mSegmentSize);
+    EXPECT_EQ(store.AppendEvent(300, PriorityLevel::Debug, ByteSpan(payload.data(), payload.size())), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    // Reopening with fewer segments deletes the oldest ones.
+    store.Shutdown();
+    mConfig.mMaxSegmentsPerPriority = 2;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+    for (unsigned priority = 0; priority < 3; priority++)
+    {
+        EXPECT_EQ(CountSegmentFiles(priority), 2u);
+    }
+    std::vector<StoredEvent> remaining = CollectEvents(store);
+    ASSERT_FALSE(remaining.empty());
+    EXPECT_GT(remaining.front().mEventNumber, events.front().mEventNumber);
+    EXPECT_EQ(remaining.back().mEventNumber, 299u);
+}
+
+TEST_F(TestMmapSegmentEventStore, TestSyncIsDeferredToTimer)
+{
+    constexpr EventNumber kNumEvents = 20000;
+
+    TimerRecordingLayer layer;
+    mConfig.mSystemLayer = &layer;
+
+    MmapSegmentEventStore store;
+    ASSERT_EQ(store.Init(mConfig), CHIP_NO_ERROR);
+
+    // Appending many events, across many segments, starts a single sync timer instead of syncing.
+    ASSERT_EQ(AppendEvents(store, 0, kNumEvents), CHIP_NO_ERROR);
+    EXPECT_EQ(layer.mNumStartedTimers, 1u);
+    ASSERT_NE(layer.mComplete, nullptr);
+
+    // Only the newest events fit in the default configuration.
+    std::vector<StoredEvent> events = CollectEvents(store);
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.back().mEventNumber, kNumEvents - 1);
+
+    // Once the timer has synced the events, the next append starts it again.
+    layer.FireTimer();
+    ASSERT_EQ(AppendEvents(store, kNumEvents, kNumEvents + 1), CHIP_NO_ERROR);
+    EXPECT_EQ(layer.mNumStartedTimers, 2u);
+
+    // Shutting down cancels the pending timer.
+    store.Shutdown();
+    EXPECT_EQ(layer.mComplete, nullptr);
+}
+
+} // namespace
@@ -38,6 +38,7 @@
 #include <lib/support/CodeUtils.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
 #include <optional>
 
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
@@ -62,8 +63,8 @@ using Protocols::InteractionModel::Status;
 ///
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
-std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & subjectDescriptor,
-                                                   const ConcreteReadAttributePath & path, Privilege requiredPrivilege)
+std::optional<CHIP_ERROR> ValidateReadAttributeACL(AccessControl::BatchCheck & accessCheck, const ConcreteReadAttributePath & path,
+                                                   Privilege requiredPrivilege)
 {
 
     RequestPath requestPath{ .cluster     = path.mClusterId,
@@ -71,7 +72,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(const SubjectDescriptor & sub
                              .requestType = RequestType::kAttributeReadRequest,
                              .entityId    = path.mAttributeId };
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err = accessCheck.Check(requestPath, requiredPrivilege);
     if (err == CHIP_NO_ERROR)
     {
         return std::nullopt;
@@ -107,7 +108,8 @@ std::optional<Status> ValidateAttributeIsReadable(DataModel::Provider * dataMode
 }
 
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                  BitFlags<ReadFlags> flags, AttributeReportIBs::Builder & reportBuilder,
+                                                  AccessControl::BatchCheck & accessCheck, BitFlags<ReadFlags> flags,
+                                                  AttributeReportIBs::Builder & reportBuilder,
                                                   const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
@@ -151,7 +153,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     DataModel::AttributeFinder finder(dataModel);
     std::optional<DataModel::AttributeEntry> entry = finder.Find(path);
 
-    if (auto access_status = ValidateReadAttributeACL(subjectDescriptor, path, Privilege::kView); access_status.has_value())
+    if (auto access_status = ValidateReadAttributeACL(accessCheck, path, Privilege::kView); access_status.has_value())
     {
         status = *access_status;
     }
@@ -163,7 +165,7 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     // entry->GetReadPrivilege() is guaranteed to have a value, since that condition is checked in the previous condition (inside
     // ValidateAttributeIsReadable()).
     // NOLINTNEXTLINE(bugprone-unchecked-optional-access)
-    else if (auto required_privilege_status = ValidateReadAttributeACL(subjectDescriptor, path, entry->GetReadPrivilege().value());
+    else if (auto required_privilege_status = ValidateReadAttributeACL(accessCheck, path, entry->GetReadPrivilege().value());
              required_privilege_status.has_value())
     {
         status = *required_privilege_status;
@@ -394,6 +396,11 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         uint32_t attributesRead = 0;
 #endif
 
+        // Paths are expanded cluster by cluster, so the access control list only needs to be checked once per cluster and
+        // privilege while building this report.
+        const SubjectDescriptor subjectDescriptor = apReadHandler->GetSubjectDescriptor();
+        AccessControl::BatchCheck accessCheck(GetAccessControl(), subjectDescriptor);
+
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
                                                           apReadHandler->AttributeIterationPosition());
@@ -404,7 +411,7 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
                 bool concretePathDirty = false;
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
                 mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
+                    if (dirtyPath->IncludesDirtyAttribute(readPath))
                     {
                         // We don't need to worry about paths that were already marked dirty before the last time this read handler
                         // started a report that it completed: those paths already got reported.
@@ -450,8 +457,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             flags.Set(ReadFlags::kFabricFiltered, apReadHandler->IsFabricFiltered());
             flags.Set(ReadFlags::kAllowsLargePayload, apReadHandler->AllowsLargePayload());
             DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(), flags,
-                                    attributeReportIBs, pathForRetrieval, &encodeState);
+                RetrieveClusterData(mpImEngine->GetDataModelProvider(), subjectDescriptor, accessCheck, flags, attributeReportIBs,
+                                    pathForRetrieval, &encodeState);
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -903,7 +910,8 @@ CHIP_ERROR Engine::ScheduleRun()
 
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    uint32_t numReadHandled                      = 0;
+    const System::Clock::Microseconds64 runStart = System::SystemClock().GetMonotonicMicroseconds64();
 
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
@@ -917,9 +925,17 @@ void Engine::Run()
         if (readHandler->ShouldReportUnscheduled() || mpImEngine->GetReportScheduler()->IsReportableNow(readHandler))
         {
 
+            const System::Clock::Microseconds64 reportStart = System::SystemClock().GetMonotonicMicroseconds64();
+
             mRunningReadHandler = readHandler;
             CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
             mRunningReadHandler = nullptr;
+
+            const System::Clock::Microseconds64 buildTime = System::SystemClock().GetMonotonicMicroseconds64() - reportStart;
+            mReportBuildStats.mTotalBuildTime += buildTime;
+            mReportBuildStats.mReportCount++;
+            mReportBuildStats.mMaxBuildTime = std::max(mReportBuildStats.mMaxBuildTime, buildTime);
+
             if (err != CHIP_NO_ERROR)
             {
                 return;
@@ -931,6 +947,14 @@ void Engine::Run()
         // mCurReadHandlerIdx to account for that removal, so it's safe to
         // increment here.
         mCurReadHandlerIdx++;
+
+        if (mRunTimeBudget != System::Clock::kZero && numReadHandled < initialAllocated &&
+            System::SystemClock().GetMonotonicMicroseconds64() - runStart >= mRunTimeBudget)
+        {
+            // Let other work on the event loop proceed; the next run resumes with the ReadHandler at mCurReadHandlerIdx.
+            TEMPORARY_RETURN_IGNORED ScheduleRun();
+            return;
+        }
     }
 
     //
@@ -969,6 +993,14 @@ bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttribute
         if (path->IsAttributePathSupersetOf(aAttributePath))
         {
             path->mGeneration = GetDirtySetGeneration();
+            if (path->mDirtyAttributes != 0)
+            {
+                // The path only covers some attributes of its cluster; add the new one, or widen it to the whole cluster if
+                // the new path has no bit of its own.
+                const uint64_t dirtyAttributes =
+                    aAttributePath.HasWildcardAttributeId() ? 0 : AttributeDirtyBit(aAttributePath.mAttributeId);
+                path->mDirtyAttributes = (dirtyAttributes == 0) ? 0 : (path->mDirtyAttributes | dirtyAttributes);
+            }
             return Loop::Break;
         }
         if (aAttributePath.IsAttributePathSupersetOf(*path))
@@ -977,11 +1009,12 @@ bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttribute
             // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
             // want.
             // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
+            path->mGeneration      = GetDirtySetGeneration();
+            path->mEndpointId      = aAttributePath.mEndpointId;
+            path->mClusterId       = aAttributePath.mClusterId;
+            path->mListIndex       = aAttributePath.mListIndex;
+            path->mAttributeId     = aAttributePath.mAttributeId;
+            path->mDirtyAttributes = 0;
             return Loop::Break;
         }
         return Loop::Continue;
@@ -1024,6 +1057,21 @@ bool Engine::MergeDirtyPathsUnderSameCluster()
             {
                 outerPath->mGeneration = innerPath->mGeneration;
             }
+
+            // Keep track of exactly which attributes are dirty when they all have a bit of their own; otherwise the merged
+            // path covers the whole cluster.
+            const uint64_t outerAttributes = outerPath->GetDirtyAttributes();
+            const uint64_t innerAttributes = innerPath->GetDirtyAttributes();
+            if (outerAttributes != 0 && innerAttributes != 0)
+            {
+                outerPath->mDirtyAttributes = outerAttributes | innerAttributes;
+                mDirtySetMergeStats.mAttributeMerges++;
+            }
+            else
+            {
+                outerPath->mDirtyAttributes = 0;
+                mDirtySetMergeStats.mClusterMerges++;
+            }
             outerPath->SetWildcardAttributeId();
 
             // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
@@ -1059,6 +1107,8 @@ bool Engine::MergeDirtyPathsUnderSameEndpoint()
             }
             outerPath->SetWildcardClusterId();
             outerPath->SetWildcardAttributeId();
+            outerPath->mDirtyAttributes = 0;
+            mDirtySetMergeStats.mEndpointMerges++;
 
             // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
             // generation to 0 and then clear it later.
@@ -1080,6 +1130,7 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
         mGlobalDirtySet.ReleaseAll();
         auto object         = mGlobalDirtySet.CreateObject();
         object->mGeneration = GetDirtySetGeneration();
+        mDirtySetMergeStats.mFullMerges++;
     }
 
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
@@ -1104,25 +1155,43 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+
+    auto markDirty = [this, &dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+        // A ReadHandler with several paths intersecting the dirty path only needs to be marked once; AttributePathIsDirty
+        // records the current dirty set generation.
+        VerifyOrReturnValue(handler->mDirtyGeneration.Raw() != mDirtyGeneration.Raw(), Loop::Continue);
+
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
         if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
         {
+            handler->AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
+        }
+
+        return Loop::Continue;
+    };
+
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+    if (mpImEngine->mNumReadHandlersNotInPathIndex == 0)
+    {
+        mpImEngine->mReadHandlerPathIndex.ForEachInterestedReadHandler(aAttributePath, markDirty);
+    }
+    else
+#endif
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &markDirty](ReadHandler * handler) {
             for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
             {
                 if (object->mValue.Intersects(aAttributePath))
                 {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
-                    break;
+                    return markDirty(handler);
                 }
             }
-        }
-
-        return Loop::Continue;
-    });
+            return Loop::Continue;
+        });
+    }
 
     if (!intersectsInterestPath)
     {
@@ -37,6 +37,7 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
@@ -125,6 +126,42 @@ public:
 
     uint32_t GetNumReportsInFlight() const { return mNumReportsInFlight; }
 
+    /**
+     * Time spent building and sending reports from Run(), for instrumentation.
+     */
+    struct ReportBuildStats
+    {
+        uint32_t mReportCount = 0;
+        System::Clock::Microseconds64 mTotalBuildTime{ 0 };
+        System::Clock::Microseconds64 mMaxBuildTime{ 0 };
+    };
+
+    const ReportBuildStats & GetReportBuildStats() const { return mReportBuildStats; }
+    void ResetReportBuildStats() { mReportBuildStats = ReportBuildStats(); }
+
+    /**
+     * Sets how long a single run may spend building reports before it yields to the event loop and schedules itself to
+     * continue with the next ReadHandler.  A zero budget never yields.  Defaults to CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS.
+     */
+    void SetRunTimeBudget(System::Clock::Milliseconds32 aBudget) { mRunTimeBudget = aBudget; }
+
+    /**
+     * Counts of the merges done to fit dirty paths into the global dirty set.  Attribute merges keep track of exactly which
+     * attributes of a cluster are dirty; the others widen the dirty set, so reports carry attributes that did not change.
+     * Merging paths of the same cluster is only an attribute merge when every attribute involved has a bit of its own (see
+     * AttributeDirtyBit()); otherwise it is a cluster merge, as before dirty attribute bits existed.
+     */
+    struct DirtySetMergeStats
+    {
+        uint32_t mAttributeMerges = 0;
+        uint32_t mClusterMerges   = 0;
+        uint32_t mEndpointMerges  = 0;
+        uint32_t mFullMerges      = 0;
+    };
+
+    const DirtySetMergeStats & GetDirtySetMergeStats() const { return mDirtySetMergeStats; }
+    void ResetDirtySetMergeStats() { mDirtySetMergeStats = DirtySetMergeStats(); }
+
     AttributeGeneration GetDirtySetGeneration() const { return mDirtyGeneration; }
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -146,12 +183,59 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
+    /**
+     * Number of bits of AttributePathParamsWithGeneration::mDirtyAttributes used for attribute IDs starting at 0.  The
+     * remaining bits track the global attributes 0xFFF8 - 0xFFFF.
+     */
+    static constexpr uint32_t kDirtyAttributeBitsForClusterAttributes = 56;
+    static constexpr AttributeId kFirstGlobalAttributeWithDirtyBit    = 0xFFF8;
+
+    /**
+     * Returns the bit tracking the given attribute in AttributePathParamsWithGeneration::mDirtyAttributes, or 0 if the
+     * attribute has no bit of its own.
+     */
+    static constexpr uint64_t AttributeDirtyBit(AttributeId aAttributeId)
+    {
+        if (aAttributeId < kDirtyAttributeBitsForClusterAttributes)
+        {
+            return uint64_t(1) << aAttributeId;
+        }
+        if (aAttributeId >= kFirstGlobalAttributeWithDirtyBit && aAttributeId <= 0xFFFF)
+        {
+            return uint64_t(1) << (kDirtyAttributeBitsForClusterAttributes + (aAttributeId - kFirstGlobalAttributeWithDirtyBit));
+        }
+        return 0;
+    }
+
     struct AttributePathParamsWithGeneration : public AttributePathParams
     {
         AttributePathParamsWithGeneration() = default;
         AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
 
+        /**
+         * Returns the attributes of the path's cluster covered by this path as AttributeDirtyBit() bits, or 0 if that
+         * cannot be expressed with bits (every attribute, or an attribute without a bit of its own).
+         */
+        uint64_t GetDirtyAttributes() const
+        {
+            return HasWildcardAttributeId() ? mDirtyAttributes : AttributeDirtyBit(mAttributeId);
+        }
+
+        bool IncludesDirtyAttribute(const ConcreteAttributePath & aPath) const
+        {
+            return IsAttributePathSupersetOf(aPath) &&
+                (mDirtyAttributes == 0 || (mDirtyAttributes & AttributeDirtyBit(aPath.mAttributeId)) != 0);
+        }
+
         AttributeGeneration mGeneration;
+
+        /**
+         * For a path with a concrete cluster and a wildcard attribute, the attributes of the cluster that are dirty, as
+         * AttributeDirtyBit() bits.  0 means every attribute covered by the path is dirty.
+         *
+         * This grows each global dirty set slot from 16 to 24 bytes (see AttributeGeneration in Generations.h).
+         */
+        uint64_t mDirtyAttributes = 0;
     };
 
     /**
@@ -252,6 +336,15 @@ private:
      */
     uint32_t mNumReportsInFlight = 0;
 
+    /**
+     * Time budget for a single Run(); zero means unlimited.
+     */
+    System::Clock::Milliseconds32 mRunTimeBudget{ CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS };
+
+    ReportBuildStats mReportBuildStats;
+
+    DirtySetMergeStats mDirtySetMergeStats;
+
     /**
      *  Current read handler index
      *
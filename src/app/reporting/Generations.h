@@ -54,15 +54,19 @@ static_assert(AreGenerationsInOrder(0x80000000 + 0x12345, 0x12344));
 ///
 /// Note: usage of uint32_t is intentional to minimize size overhead. For example, in
 /// `struct AttributePathParamsWithGeneration` (defined in Engine.h), using 32-bit generations
-/// keeps the structure size at 16 bytes.
+/// keeps the path and its generation within 16 bytes, with no padding before the 8-byte
+/// dirty attribute bits that follow them.
 ///
 /// The size breakdown is as follows:
 /// - Base `AttributePathParams`: 12 bytes (4-byte ClusterId, 4-byte AttributeId,
 ///   2-byte EndpointId, 2-byte ListIndex).
-/// - Current: Adding a 4-byte `AttributeGeneration` results in a total of 16 bytes.
+/// - Current: Adding a 4-byte `AttributeGeneration` results in 16 bytes. The 8-byte dirty
+///   attribute bits bring each global dirty set slot to 24 bytes, i.e. 64 more bytes of RAM
+///   for the default CHIP_IM_SERVER_MAX_NUM_DIRTY_SET of 8. They let merged paths keep
+///   reporting only the attributes that changed instead of the whole cluster.
 /// - Hypothetical: If this were 64-bit, the compiler would insert 4 bytes of alignment
 ///   padding after the 12-byte base to satisfy the 8-byte alignment requirement for
-///   the uint64_t, resulting in 24 bytes (12 + 4 + 8) — a 50% increase in size.
+///   the uint64_t, resulting in 32 bytes (12 + 4 + 8 + 8).
 ///
 /// On typical 32-bit MCU targets used by this stack, using 32-bit arithmetic instead of
 /// 64-bit handling often results in smaller generated code, helping reduce flash usage.
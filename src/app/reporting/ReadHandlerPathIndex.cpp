@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReadHandlerPathIndex.h>
+
+#include <app/ReadHandler.h>
+
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+ReadHandlerPathIndex::Entry *& ReadHandlerPathIndex::ListFor(const AttributePathParams & aPath)
+{
+    if (aPath.HasWildcardClusterId())
+    {
+        return mClusterWildcardEntries;
+    }
+    return mBuckets[BucketIndex(aPath.mEndpointId, aPath.mClusterId)];
+}
+
+CHIP_ERROR ReadHandlerPathIndex::AddReadHandler(ReadHandler & aReadHandler)
+{
+    for (auto * path = aReadHandler.GetAttributePathList(); path != nullptr; path = path->mpNext)
+    {
+        Entry * entry = mEntryPool.CreateObject(&aReadHandler, &path->mValue);
+        if (entry == nullptr)
+        {
+            RemoveReadHandler(aReadHandler);
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        Entry *& list = ListFor(path->mValue);
+        entry->mpNext = list;
+        list          = entry;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ReadHandlerPathIndex::RemoveReadHandler(const ReadHandler & aReadHandler)
+{
+    for (auto * path = aReadHandler.GetAttributePathList(); path != nullptr; path = path->mpNext)
+    {
+        for (Entry ** link = &ListFor(path->mValue); *link != nullptr; link = &(*link)->mpNext)
+        {
+            if ((*link)->mpPath == &path->mValue)
+            {
+                Entry * entry = *link;
+                *link         = entry->mpNext;
+                mEntryPool.ReleaseObject(entry);
+                break;
+            }
+        }
+    }
+}
+
+void ReadHandlerPathIndex::RemoveAll()
+{
+    for (Entry *& bucket : mBuckets)
+    {
+        bucket = nullptr;
+    }
+    mClusterWildcardEntries = nullptr;
+    mEntryPool.ReleaseAll();
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Pool.h>
+
+#include <stddef.h>
+
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+
+namespace chip {
+namespace app {
+
+class ReadHandler;
+
+namespace reporting {
+
+/**
+ * @class ReadHandlerPathIndex
+ *
+ * @brief Index from attribute paths to the ReadHandlers that requested them, used by the reporting engine to find the
+ *        ReadHandlers affected by a dirty path without walking the path list of every active ReadHandler.
+ *
+ * Every attribute path of an indexed ReadHandler gets one entry.  Paths with a concrete cluster are hashed on their
+ * endpoint and cluster into a fixed number of buckets, with wildcard endpoints hashed as kInvalidEndpointId; paths with
+ * a wildcard cluster are kept on a separate list.  A concrete dirty cluster path thus only needs to look at two buckets
+ * plus the wildcard list.  A dirty path with a wildcard endpoint or cluster (e.g. an endpoint change) looks at every
+ * entry.
+ *
+ * Entries reference the path nodes owned by the ReadHandler, so a ReadHandler must be removed from the index before
+ * its path list is modified or released.
+ */
+class ReadHandlerPathIndex
+{
+public:
+    static constexpr size_t kNumBuckets = CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS;
+
+    ReadHandlerPathIndex() = default;
+    ~ReadHandlerPathIndex() { RemoveAll(); }
+
+    ReadHandlerPathIndex(const ReadHandlerPathIndex &)             = delete;
+    ReadHandlerPathIndex & operator=(const ReadHandlerPathIndex &) = delete;
+
+    /**
+     * Adds an entry for every attribute path of the given ReadHandler.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if an entry could not be allocated; no entry is left behind for the ReadHandler.
+     */
+    CHIP_ERROR AddReadHandler(ReadHandler & aReadHandler);
+
+    /**
+     * Removes the entries for every attribute path of the given ReadHandler.  Paths that are not indexed are ignored.
+     */
+    void RemoveReadHandler(const ReadHandler & aReadHandler);
+
+    void RemoveAll();
+
+    /**
+     * Calls aFunction with every ReadHandler that has an attribute path intersecting aPath.  A ReadHandler with
+     * several intersecting paths is visited once per such path.
+     *
+     * @returns Loop::Break if aFunction returned Loop::Break, Loop::Finish otherwise.
+     */
+    template <typename Function>
+    Loop ForEachInterestedReadHandler(const AttributePathParams & aPath, Function && aFunction) const
+    {
+        if (aPath.HasWildcardEndpointId() || aPath.HasWildcardClusterId())
+        {
+            for (const Entry * bucket : mBuckets)
+            {
+                VerifyOrReturnValue(VisitIntersecting(bucket, aPath, aFunction) == Loop::Continue, Loop::Break);
+            }
+        }
+        else
+        {
+            const size_t bucket         = BucketIndex(aPath.mEndpointId, aPath.mClusterId);
+            const size_t wildcardBucket = BucketIndex(kInvalidEndpointId, aPath.mClusterId);
+
+            VerifyOrReturnValue(VisitIntersecting(mBuckets[bucket], aPath, aFunction) == Loop::Continue, Loop::Break);
+            if (wildcardBucket != bucket)
+            {
+                VerifyOrReturnValue(VisitIntersecting(mBuckets[wildcardBucket], aPath, aFunction) == Loop::Continue, Loop::Break);
+            }
+        }
+
+        VerifyOrReturnValue(VisitIntersecting(mClusterWildcardEntries, aPath, aFunction) == Loop::Continue, Loop::Break);
+        return Loop::Finish;
+    }
+
+    size_t GetNumEntries() const { return mEntryPool.Allocated(); }
+
+private:
+    struct Entry
+    {
+        Entry(ReadHandler * aReadHandler, const AttributePathParams * aPath) : mpReadHandler(aReadHandler), mpPath(aPath) {}
+
+        ReadHandler * mpReadHandler;
+        const AttributePathParams * mpPath;
+        Entry * mpNext = nullptr;
+    };
+
+    static size_t BucketIndex(EndpointId aEndpointId, ClusterId aClusterId)
+    {
+        return ((aClusterId ^ (static_cast<uint32_t>(aEndpointId) << 16)) * 2654435761u) % kNumBuckets;
+    }
+
+    template <typename Function>
+    static Loop VisitIntersecting(const Entry * aEntry, const AttributePathParams & aPath, Function & aFunction)
+    {
+        for (; aEntry != nullptr; aEntry = aEntry->mpNext)
+        {
+            if (aEntry->mpPath->Intersects(aPath))
+            {
+                VerifyOrReturnValue(aFunction(aEntry->mpReadHandler) == Loop::Continue, Loop::Break);
+            }
+        }
+        return Loop::Continue;
+    }
+
+    Entry *& ListFor(const AttributePathParams & aPath);
+
+    Entry * mBuckets[kNumBuckets]   = {};
+    Entry * mClusterWildcardEntries = nullptr;
+
+    ObjectPool<Entry, CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS>
+        mEntryPool;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
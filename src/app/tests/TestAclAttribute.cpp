@@ -20,6 +20,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <access/examples/PermissiveAccessControlDelegate.h>
+#include <app/AttributePathExpandIterator.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteEventPath.h>
 #include <app/InteractionModelEngine.h>
@@ -82,15 +83,18 @@ public:
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const chip::Access::RequestPath & requestPath,
                      Privilege requestPrivilege) override
     {
+        mCheckCount++;
         if (requestPath.cluster == kTestDeniedClusterId2 || requestPath.endpoint == kTestDeniedEndpointId)
         {
             return CHIP_ERROR_ACCESS_DENIED;
         }
         return CHIP_NO_ERROR;
     }
+
+    size_t mCheckCount = 0;
 };
 
-AccessControl::Delegate * GetTestAccessControlDelegate()
+TestAccessControlDelegate * GetTestAccessControlDelegate()
 {
     static TestAccessControlDelegate accessControlDelegate;
     return &accessControlDelegate;
@@ -108,6 +112,7 @@ public:
     void OnAttributeData(const chip::app::ConcreteDataAttributePath & aPath, chip::TLV::TLVReader * apData,
                          const chip::app::StatusIB & status) override
     {
+        mAttributeDataCount++;
         mGotReport          = true;
         mLastStatusReceived = status;
     }
@@ -129,7 +134,8 @@ public:
         }
     }
 
-    bool mGotReport = false;
+    bool mGotReport            = false;
+    size_t mAttributeDataCount = 0;
     chip::app::StatusIB mLastStatusReceived;
     CHIP_ERROR mError = CHIP_NO_ERROR;
 };
@@ -318,6 +324,77 @@ TEST_F(TestAclAttribute, TestACLDeniedAttribute_Read)
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// A read of */*/* checks the access control list once per cluster (and privilege), not once per attribute.
+TEST_F(TestAclAttribute, TestWildcardReadChecksEachClusterOnce)
+{
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+
+    // Every attribute read, whether access is allowed or denied. Checked one at a time, as before batching, each attribute path
+    // takes a check of the delegate; checked in a batch, each cluster does.
+    size_t attributePathCount = 0;
+    size_t singleCheckCount   = 0;
+    size_t batchCheckCount    = 0;
+    {
+        const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = 0x1234 };
+        AccessControl::BatchCheck batchCheck(GetAccessControl(), subjectDescriptor);
+
+        SingleLinkedListNode<AttributePathParams> wildcardPath;
+        auto position = AttributePathExpandIterator::Position::StartIterating(&wildcardPath);
+        AttributePathExpandIterator iterator(engine->GetDataModelProvider(), position);
+        ConcreteAttributePath path;
+        while (iterator.Next(path))
+        {
+            attributePathCount++;
+
+            const RequestPath requestPath = { .cluster     = path.mClusterId,
+                                              .endpoint    = path.mEndpointId,
+                                              .requestType = RequestType::kAttributeReadRequest,
+                                              .entityId    = path.mAttributeId };
+
+            size_t checkCount = GetTestAccessControlDelegate()->mCheckCount;
+            RETURN_SAFELY_IGNORED GetAccessControl().Check(subjectDescriptor, requestPath, Privilege::kView);
+            singleCheckCount += GetTestAccessControlDelegate()->mCheckCount - checkCount;
+
+            checkCount = GetTestAccessControlDelegate()->mCheckCount;
+            RETURN_SAFELY_IGNORED batchCheck.Check(requestPath, Privilege::kView);
+            batchCheckCount += GetTestAccessControlDelegate()->mCheckCount - checkCount;
+        }
+    }
+    EXPECT_EQ(attributePathCount, 24u);
+    EXPECT_EQ(singleCheckCount, attributePathCount);
+    EXPECT_EQ(batchCheckCount, 3u);
+
+    app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                               chip::app::ReadClient::InteractionType::Read);
+
+    chip::app::AttributePathParams attributePathParams[1];
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    GetTestAccessControlDelegate()->mCheckCount = 0;
+    EXPECT_EQ(readClient.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+    EXPECT_TRUE(delegate.mGotReport);
+
+    // The three clusters have the same attributes, and only those of the allowed cluster are reported.
+    EXPECT_EQ(delegate.mAttributeDataCount, attributePathCount / 3);
+
+    // One check when validating the request, then one for each of the three clusters while reporting; checking each attribute
+    // took one more check when validating the request and up to two per attribute while reporting.
+    ChipLogProgress(DataManagement, "%u access checks for %u attribute paths",
+                    static_cast<unsigned>(GetTestAccessControlDelegate()->mCheckCount), static_cast<unsigned>(attributePathCount));
+    EXPECT_EQ(GetTestAccessControlDelegate()->mCheckCount, 4u);
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F(TestAclAttribute, AccessDeniedPrecedenceOverUnsupportedEndpoint_Write)
 {
     {
@@ -859,6 +859,98 @@ TEST(TestAttributeValueEncoder, TestEncodeFabricFilteredListOfPreEncoded)
     VERIFY_BUFFER_STATE(test, expected);
 }
 
+// Encodes a list of aListSize items in 128-byte chunks, once with a generator that produces the whole list for every chunk
+// and once with a generator that skips the items encoded by earlier chunks, and checks that both produce the same chunks.
+// aEncodeItem(encoder, i) encodes the i-th item.  Returns the number of items produced by each generator.
+template <typename EncodeItem>
+void EncodeListInChunks(FabricIndex aFabricIndex, size_t aListSize, EncodeItem aEncodeItem, size_t & aNumChunks,
+                        size_t & aNumItemsProducedFromStart, size_t & aNumItemsProducedWhenSkipping)
+{
+    auto fromStart = [&](const auto & encoder) -> CHIP_ERROR {
+        for (size_t i = 0; i < aListSize; i++)
+        {
+            aNumItemsProducedFromStart++;
+            ReturnErrorOnFailure(aEncodeItem(encoder, i));
+        }
+        return CHIP_NO_ERROR;
+    };
+    auto skipping = [&](const auto & encoder) -> CHIP_ERROR {
+        for (size_t i = encoder.SkipEncodedItems(); i < aListSize; i++)
+        {
+            aNumItemsProducedWhenSkipping++;
+            ReturnErrorOnFailure(aEncodeItem(encoder, i));
+        }
+        return CHIP_NO_ERROR;
+    };
+
+    AttributeEncodeState fromStartState;
+    AttributeEncodeState skippingState;
+    CHIP_ERROR err;
+
+    aNumChunks                    = 0;
+    aNumItemsProducedFromStart    = 0;
+    aNumItemsProducedWhenSkipping = 0;
+    do
+    {
+        LimitedTestSetup<128> fromStartTest(aFabricIndex, fromStartState);
+        LimitedTestSetup<128> skippingTest(aFabricIndex, skippingState);
+
+        err = fromStartTest.encoder.EncodeList(fromStart);
+        EXPECT_EQ(skippingTest.encoder.EncodeList(skipping), err);
+        EXPECT_EQ(fromStartTest.writer.GetLengthWritten(), skippingTest.writer.GetLengthWritten());
+        EXPECT_EQ(memcmp(fromStartTest.buf, skippingTest.buf, fromStartTest.writer.GetLengthWritten()), 0);
+
+        fromStartState = fromStartTest.encoder.GetState();
+        skippingState  = skippingTest.encoder.GetState();
+        aNumChunks++;
+    } while ((err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL) && aNumChunks <= aListSize);
+
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeListChunkingSkipsEncodedItems)
+{
+    constexpr size_t kListSize = 1000;
+    size_t numChunks;
+    size_t numItemsProducedFromStart;
+    size_t numItemsProducedWhenSkipping;
+
+    EncodeListInChunks(
+        kUndefinedFabricIndex, kListSize,
+        [](const auto & encoder, size_t i) { return encoder.Encode(static_cast<uint32_t>(i)); }, numChunks,
+        numItemsProducedFromStart, numItemsProducedWhenSkipping);
+
+    EXPECT_GT(numChunks, 1u);
+    // Every chunk but the last stops at an item that did not fit, which the next chunk produces again.
+    EXPECT_EQ(numItemsProducedWhenSkipping, kListSize + numChunks - 1);
+    // Producing the whole list for every chunk is quadratic in the number of chunks.
+    EXPECT_GT(numItemsProducedFromStart, kListSize * numChunks / 2);
+}
+
+TEST(TestAttributeValueEncoder, TestEncodeFabricFilteredListChunkingSkipsEncodedItems)
+{
+    constexpr size_t kListSize = 1000;
+    size_t numChunks;
+    size_t numItemsProducedFromStart;
+    size_t numItemsProducedWhenSkipping;
+
+    // Only every other item belongs to the accessing fabric, so the skipped items include the filtered ones.
+    EncodeListInChunks(
+        kTestFabricIndex, kListSize,
+        [](const auto & encoder, size_t i) {
+            Clusters::AccessControl::Structs::AccessControlExtensionStruct::Type item;
+            item.fabricIndex = static_cast<FabricIndex>(kTestFabricIndex + (i % 2));
+            return encoder.Encode(item);
+        },
+        numChunks, numItemsProducedFromStart, numItemsProducedWhenSkipping);
+
+    EXPECT_GT(numChunks, 1u);
+    // Chunks resume right after the last encoded item, so a filtered item between it and the item that did not fit is
+    // produced again as well.
+    EXPECT_LE(numItemsProducedWhenSkipping, kListSize + 2 * (numChunks - 1));
+    EXPECT_GT(numItemsProducedFromStart, kListSize * numChunks / 2);
+}
+
 #undef VERIFY_BUFFER_STATE
 
 } // anonymous namespace
@@ -21,6 +21,7 @@
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/PersistentEventStore.h>
 #include <app/tests/AppTestContext.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
@@ -39,6 +40,9 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <utility>
+#include <vector>
+
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
 
@@ -288,4 +292,218 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+using EventNumberAndEndpoint = std::pair<chip::EventNumber, chip::EndpointId>;
+
+// Collects the event number and endpoint of every EventReportIB read by aReader.
+void CollectEvents(chip::TLV::TLVReader & aReader, std::vector<EventNumberAndEndpoint> & aEvents)
+{
+    while (aReader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser data;
+        chip::app::EventPathIB::Parser path;
+        EventNumberAndEndpoint event;
+
+        ASSERT_EQ(report.Init(aReader), CHIP_NO_ERROR);
+        ASSERT_EQ(report.GetEventData(&data), CHIP_NO_ERROR);
+        ASSERT_EQ(data.GetEventNumber(&event.first), CHIP_NO_ERROR);
+        ASSERT_EQ(data.GetPath(&path), CHIP_NO_ERROR);
+        ASSERT_EQ(path.GetEndpoint(&event.second), CHIP_NO_ERROR);
+        aEvents.push_back(event);
+    }
+}
+
+TEST_F(TestEventLogging, TestFetchEventsMatchesStoredEvents)
+{
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    TestEventGenerator testEventGenerator;
+
+    // Mix priorities so that events are moved between buffers and dropped, and alternate endpoints so that fetches for a single
+    // endpoint skip half of the events.
+    for (int i = 0; i < 30; i++)
+    {
+        chip::app::EventOptions options;
+        chip::EventNumber eventNumber;
+        options.mPath     = { (i % 2) ? kTestEndpointId1 : kTestEndpointId2, kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = static_cast<chip::app::PriorityLevel>(i % 3);
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eventNumber), CHIP_NO_ERROR);
+    }
+
+    std::vector<EventNumberAndEndpoint> storedEvents;
+    {
+        chip::TLV::TLVReader reader;
+        chip::app::CircularEventBufferWrapper bufWrapper;
+        EXPECT_EQ(logMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper), CHIP_NO_ERROR);
+        CollectEvents(reader, storedEvents);
+    }
+    ASSERT_FALSE(storedEvents.empty());
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> endpoint1Path;
+    endpoint1Path.mValue.mEndpointId = kTestEndpointId1;
+    endpoint1Path.mValue.mClusterId  = kLivenessClusterId;
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> endpoint2Path;
+    endpoint2Path.mValue.mEndpointId = kTestEndpointId2;
+    endpoint2Path.mValue.mClusterId  = kLivenessClusterId;
+    endpoint2Path.mValue.mEventId    = kLivenessChangeEvent;
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    ASSERT_TRUE(backingStore.Alloc(1024));
+
+    // Every starting event number around the stored ones, for each kind of reader.
+    for (auto * paths : { &endpoint1Path, &endpoint2Path, &wildcardPath })
+    {
+        for (chip::EventNumber start = 0; start <= storedEvents.back().first + 1; start++)
+        {
+            chip::TLV::TLVWriter writer;
+            chip::TLV::TLVReader reader;
+            chip::EventNumber eventMin = start;
+            size_t eventCount          = 0;
+
+            writer.Init(backingStore.Get(), 1024);
+            EXPECT_EQ(logMgmt.FetchEventsSince(writer, paths, eventMin, eventCount, chip::Access::SubjectDescriptor{}),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(eventMin, storedEvents.back().first + 1);
+
+            std::vector<EventNumberAndEndpoint> expectedEvents;
+            for (const auto & event : storedEvents)
+            {
+                if (event.first >= start && (paths->mValue.HasWildcardEndpointId() || paths->mValue.mEndpointId == event.second))
+                {
+                    expectedEvents.push_back(event);
+                }
+            }
+
+            std::vector<EventNumberAndEndpoint> fetchedEvents;
+            reader.Init(backingStore.Get(), writer.GetLengthWritten());
+            CollectEvents(reader, fetchedEvents);
+            EXPECT_EQ(eventCount, expectedEvents.size());
+            EXPECT_EQ(fetchedEvents, expectedEvents);
+        }
+    }
+}
+
+// PersistentEventStore keeping events in memory.
+class TestPersistentEventStore : public chip::app::PersistentEventStore
+{
+public:
+    CHIP_ERROR AppendEvent(chip::EventNumber aEventNumber, chip::app::PriorityLevel, const chip::ByteSpan & aEvent) override
+    {
+        mEvents.push_back({ aEventNumber, { aEvent.begin(), aEvent.end() } });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ForEachEvent(chip::EventNumber aMin, chip::EventNumber aEnd, EventCallback aCallback, void * apContext) override
+    {
+        for (const auto & event : mEvents)
+        {
+            if (event.first >= aMin && event.first < aEnd)
+            {
+                chip::ByteSpan data(event.second.data(), event.second.size());
+                ReturnErrorOnFailure(aCallback(event.first, data, event.first < mFirstEventOfThisBoot, apContext));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<std::pair<chip::EventNumber, std::vector<uint8_t>>> mEvents;
+    chip::EventNumber mFirstEventOfThisBoot = 0;
+};
+
+// Whether each EventReportIB read by aReader has an absolute, rather than a delta, timestamp.
+void CollectHasAbsoluteTimestamp(chip::TLV::TLVReader & aReader, std::vector<bool> & aAbsolute)
+{
+    while (aReader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser data;
+        uint64_t timestamp;
+
+        ASSERT_EQ(report.Init(aReader), CHIP_NO_ERROR);
+        ASSERT_EQ(report.GetEventData(&data), CHIP_NO_ERROR);
+        aAbsolute.push_back(data.GetDeltaSystemTimestamp(&timestamp) != CHIP_NO_ERROR &&
+                            data.GetDeltaEpochTimestamp(&timestamp) != CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestEventLogging, TestFetchEventsFromPersistentEventStore)
+{
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    TestEventGenerator testEventGenerator;
+    TestPersistentEventStore store;
+    logMgmt.SetPersistentEventStore(&store);
+
+    for (int i = 0; i < 30; i++)
+    {
+        chip::app::EventOptions options;
+        chip::EventNumber eventNumber;
+        options.mPath     = { (i % 2) ? kTestEndpointId1 : kTestEndpointId2, kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = static_cast<chip::app::PriorityLevel>(i % 3);
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eventNumber), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(store.mEvents.size(), 30u);
+
+    std::vector<EventNumberAndEndpoint> storedEvents;
+    {
+        chip::TLV::TLVReader reader;
+        chip::app::CircularEventBufferWrapper bufWrapper;
+        EXPECT_EQ(logMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper), CHIP_NO_ERROR);
+        CollectEvents(reader, storedEvents);
+    }
+    ASSERT_FALSE(storedEvents.empty());
+    ASSERT_GT(storedEvents.front().first, 0u);
+    // Some of the events newer than the oldest one in the event buffers were dropped from the lower priority buffers.
+    ASSERT_LT(storedEvents.size(), 30u - storedEvents.front().first);
+
+    // Every event missing from the event buffers comes from the store, in event number order.
+    std::vector<EventNumberAndEndpoint> expectedEvents;
+    for (chip::EventNumber eventNumber = 0; eventNumber < 30; eventNumber++)
+    {
+        expectedEvents.push_back({ eventNumber, (eventNumber % 2) ? kTestEndpointId1 : kTestEndpointId2 });
+    }
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    ASSERT_TRUE(backingStore.Alloc(4096));
+
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVReader reader;
+    chip::EventNumber eventMin = 0;
+    size_t eventCount          = 0;
+
+    writer.Init(backingStore.Get(), 4096);
+    EXPECT_EQ(logMgmt.FetchEventsSince(writer, &wildcardPath, eventMin, eventCount, chip::Access::SubjectDescriptor{}),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(eventMin, storedEvents.back().first + 1);
+
+    std::vector<EventNumberAndEndpoint> fetchedEvents;
+    reader.Init(backingStore.Get(), writer.GetLengthWritten());
+    CollectEvents(reader, fetchedEvents);
+    EXPECT_EQ(eventCount, expectedEvents.size());
+    EXPECT_EQ(fetchedEvents, expectedEvents);
+
+    // Events logged before a reboot and the event after them do not get a timestamp relative to their predecessor.
+    store.mFirstEventOfThisBoot = 5;
+    eventMin                    = 0;
+    eventCount                  = 0;
+    writer.Init(backingStore.Get(), 4096);
+    EXPECT_EQ(logMgmt.FetchEventsSince(writer, &wildcardPath, eventMin, eventCount, chip::Access::SubjectDescriptor{}),
+              CHIP_NO_ERROR);
+
+    std::vector<bool> hasAbsoluteTimestamp;
+    reader.Init(backingStore.Get(), writer.GetLengthWritten());
+    CollectHasAbsoluteTimestamp(reader, hasAbsoluteTimestamp);
+    ASSERT_EQ(hasAbsoluteTimestamp.size(), 30u);
+    for (size_t i = 0; i < hasAbsoluteTimestamp.size(); i++)
+    {
+        EXPECT_EQ(hasAbsoluteTimestamp[i], i <= 5);
+    }
+
+    logMgmt.SetPersistentEventStore(nullptr);
+}
+
 } // namespace
@@ -79,6 +79,18 @@ static chip::System::Clock::ClockBase * gRealClock;
 static chip::app::reporting::ReportSchedulerImpl * gReportScheduler;
 static bool sUsingSubSync = false;
 
+// Mock clock whose monotonic microsecond time advances by 1ms on every read, so that each step of the reporting engine
+// takes a measurable amount of time.
+class SteppingMockClock : public chip::System::Clock::Internal::MockClock
+{
+public:
+    chip::System::Clock::Microseconds64 GetMonotonicMicroseconds64() override
+    {
+        AdvanceMonotonic(chip::System::Clock::Milliseconds64(1));
+        return MockClock::GetMonotonicMicroseconds64();
+    }
+};
+
 const chip::Testing::MockNodeConfig & TestMockNodeConfig()
 {
     using namespace chip::app;
@@ -554,6 +566,7 @@ public:
     void TestReadInvalidAttributePathRoundtrip();
     void TestReadReportFailure();
     void TestReadRoundtrip();
+    void TestReadRoundtripWithRunTimeBudget();
     void TestReadRoundtripWithDataVersionFilter();
     void TestReadRoundtripWithMultiSamePathDifferentDataVersionFilter();
     void TestReadRoundtripWithNoMatchPathDataVersionFilter();
@@ -1246,6 +1259,69 @@ void TestReadInteraction::TestReadRoundtrip()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadRoundtripWithRunTimeBudget)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadRoundtripWithRunTimeBudget)
+void TestReadInteraction::TestReadRoundtripWithRunTimeBudget()
+{
+    MockInteractionModelApp delegate1;
+    MockInteractionModelApp delegate2;
+    auto * engine          = chip::app::InteractionModelEngine::GetInstance();
+    auto & reportingEngine = engine->GetReportingEngine();
+    SteppingMockClock clock;
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    chip::app::AttributePathParams attributePathParams[1];
+    attributePathParams[0].mEndpointId  = kTestEndpointId;
+    attributePathParams[0].mClusterId   = kTestClusterId;
+    attributePathParams[0].mAttributeId = 1;
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mpAttributePathParamsList    = attributePathParams;
+    readPrepareParams.mAttributePathParamsListSize = 1;
+
+    {
+        app::ReadClient readClient1(engine, &GetExchangeManager(), delegate1, chip::app::ReadClient::InteractionType::Read);
+        app::ReadClient readClient2(engine, &GetExchangeManager(), delegate2, chip::app::ReadClient::InteractionType::Read);
+
+        // Hold off the reporting engine until both ReadHandlers exist, then run it by hand.
+        reportingEngine.mRunScheduled = true;
+        EXPECT_EQ(readClient1.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        EXPECT_EQ(readClient2.SendRequest(readPrepareParams), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(), 2u);
+
+        reportingEngine.mRunScheduled = false;
+        reportingEngine.ResetReportBuildStats();
+        reportingEngine.SetRunTimeBudget(System::Clock::Milliseconds32(1));
+        clock.SetMonotonic(gMockClock.GetMonotonicMilliseconds64());
+        chip::System::Clock::Internal::SetSystemClockForTesting(&clock);
+        reportingEngine.Run();
+        chip::System::Clock::Internal::SetSystemClockForTesting(&gMockClock);
+        gMockClock.SetMonotonic(clock.GetMonotonicMilliseconds64());
+
+        // The first report used up the budget, so the engine yielded and scheduled itself for the second one.
+        EXPECT_EQ(reportingEngine.GetReportBuildStats().mReportCount, 1u);
+        EXPECT_GE(reportingEngine.GetReportBuildStats().mMaxBuildTime, System::Clock::Milliseconds64(1));
+        EXPECT_TRUE(reportingEngine.IsRunScheduled());
+        EXPECT_EQ(delegate1.mNumAttributeResponse + delegate2.mNumAttributeResponse, 0);
+
+        DrainAndServiceIO();
+
+        EXPECT_EQ(reportingEngine.GetReportBuildStats().mReportCount, 2u);
+        EXPECT_EQ(delegate1.mNumAttributeResponse, 1);
+        EXPECT_TRUE(delegate1.mGotReport);
+        EXPECT_FALSE(delegate1.mReadError);
+        EXPECT_EQ(delegate2.mNumAttributeResponse, 1);
+        EXPECT_TRUE(delegate2.mGotReport);
+        EXPECT_FALSE(delegate2.mReadError);
+    }
+
+    reportingEngine.SetRunTimeBudget(System::Clock::Milliseconds32(CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS));
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestReadRoundtripWithDataVersionFilter)
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestReadRoundtripWithDataVersionFilter)
 void TestReadInteraction::TestReadRoundtripWithDataVersionFilter()
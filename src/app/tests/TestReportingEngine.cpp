@@ -29,6 +29,7 @@
 #include <app/ConcreteAttributePath.h>
 #include <app/InteractionModelEngine.h>
 #include <app/reporting/Engine.h>
+#include <app/reporting/ReadHandlerPathIndex.h>
 #include <app/reporting/tests/MockReportScheduler.h>
 #include <app/tests/AppTestContext.h>
 #include <app/tests/test-interaction-model-api.h>
@@ -98,6 +99,8 @@ public:
     void TestBuildAndSendSingleReportData();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestMergeDirtyAttributesUnderSameCluster();
+    void TestReadHandlerPathIndex();
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -359,6 +362,169 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeDirtyAttributesUnderSameCluster)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    using namespace Clusters::Globals::Attributes;
+
+    Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    reportingEngine.mGlobalDirtySet.ReleaseAll();
+    reportingEngine.BumpDirtySetGeneration();
+    reportingEngine.ResetDirtySetMergeStats();
+
+    auto dirtyAttributes = [&reportingEngine]() {
+        uint64_t attributes = 0;
+        reportingEngine.mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
+            attributes = path->mDirtyAttributes;
+            return Loop::Break;
+        });
+        return attributes;
+    };
+    auto isDirty = [&reportingEngine](AttributeId aAttributeId) {
+        ConcreteAttributePath path(kTestEndpointId, kTestClusterId, aAttributeId);
+        return reportingEngine.mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+            return dirtyPath->IncludesDirtyAttribute(path) ? Loop::Break : Loop::Continue;
+        }) == Loop::Break;
+    };
+
+    // Attributes with a bit of their own are merged without losing track of which ones are dirty.
+    uint64_t expected = 0;
+    for (AttributeId i = 1; i <= CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+        expected |= Engine::AttributeDirtyBit(i);
+    }
+    EXPECT_EQ(CHIP_NO_ERROR,
+              reportingEngine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, FeatureMap::Id)));
+    expected |= Engine::AttributeDirtyBit(FeatureMap::Id);
+
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
+    EXPECT_EQ(dirtyAttributes(), expected);
+    EXPECT_TRUE(isDirty(1));
+    EXPECT_TRUE(isDirty(FeatureMap::Id));
+    EXPECT_FALSE(isDirty(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1));
+    EXPECT_FALSE(isDirty(ClusterRevision::Id));
+    EXPECT_EQ(reportingEngine.GetDirtySetMergeStats().mAttributeMerges, uint32_t(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET - 1));
+    EXPECT_EQ(reportingEngine.GetDirtySetMergeStats().mClusterMerges, 0u);
+
+    // Further attributes of the cluster are added to the merged path.
+    EXPECT_EQ(CHIP_NO_ERROR,
+              reportingEngine.InsertPathIntoDirtySet(
+                  AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1)));
+    EXPECT_TRUE(isDirty(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET + 1));
+    EXPECT_EQ(reportingEngine.GetGlobalDirtySetSize(), 1u);
+
+    // An attribute without a bit of its own widens the path to the whole cluster.
+    constexpr AttributeId kAttributeWithoutBit = 0x4000;
+    static_assert(Engine::AttributeDirtyBit(kAttributeWithoutBit) == 0);
+    EXPECT_EQ(CHIP_NO_ERROR,
+              reportingEngine.InsertPathIntoDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, kAttributeWithoutBit)));
+    EXPECT_EQ(dirtyAttributes(), 0u);
+    EXPECT_TRUE(isDirty(ClusterRevision::Id));
+
+    reportingEngine.mGlobalDirtySet.ReleaseAll();
+    reportingEngine.ResetDirtySetMergeStats();
+
+    // Merging such an attribute when the pool is exhausted also covers the whole cluster.
+    EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, kAttributeWithoutBit)));
+    for (AttributeId i = 1; i < CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        EXPECT_TRUE(InsertToDirtySet(AttributePathParams(kTestEndpointId, kTestClusterId, i)));
+    }
+    EXPECT_EQ(CHIP_NO_ERROR,
+              reportingEngine.InsertPathIntoDirtySet(
+                  AttributePathParams(kTestEndpointId, kTestClusterId, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET)));
+    EXPECT_TRUE(VerifyDirtySetContent(AttributePathParams(kTestEndpointId, kTestClusterId)));
+    EXPECT_EQ(dirtyAttributes(), 0u);
+    EXPECT_GT(reportingEngine.GetDirtySetMergeStats().mClusterMerges, 0u);
+
+    reportingEngine.Shutdown();
+}
+
+#if CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestReadHandlerPathIndex)
+{
+    auto * engine = InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), app::reporting::GetDefaultReportScheduler()), CHIP_NO_ERROR);
+
+    DummyDelegate dummy;
+    TestExchangeDelegate delegate;
+    ReadHandlerPathIndex index;
+
+    // Concrete path, wildcard endpoint, wildcard cluster and wildcard attribute on another endpoint.
+    AttributePathParams paths[] = {
+        AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1),
+        AttributePathParams(kInvalidEndpointId, kTestClusterId, kTestFieldId2),
+        AttributePathParams(kTestEndpointId),
+        AttributePathParams(EndpointId(kTestEndpointId + 1), kTestClusterId + 1),
+    };
+
+    {
+        ReadHandler handler0(dummy, NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Read,
+                             app::reporting::GetDefaultReportScheduler());
+        ReadHandler handler1(dummy, NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Read,
+                             app::reporting::GetDefaultReportScheduler());
+        ReadHandler handler2(dummy, NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Read,
+                             app::reporting::GetDefaultReportScheduler());
+        ReadHandler handler3(dummy, NewExchangeToAlice(&delegate), ReadHandler::InteractionType::Read,
+                             app::reporting::GetDefaultReportScheduler());
+        ReadHandler * handlers[] = { &handler0, &handler1, &handler2, &handler3 };
+
+        for (size_t i = 0; i < MATTER_ARRAY_SIZE(handlers); i++)
+        {
+            EXPECT_SUCCESS(engine->PushFrontAttributePathList(handlers[i]->mpAttributePathList, paths[i]));
+            EXPECT_SUCCESS(index.AddReadHandler(*handlers[i]));
+        }
+        EXPECT_EQ(index.GetNumEntries(), MATTER_ARRAY_SIZE(handlers));
+
+        // Returns a bitmask of the handlers the index reports for the given dirty path.
+        auto interested = [&](const AttributePathParams & aDirtyPath) {
+            uint32_t mask = 0;
+            index.ForEachInterestedReadHandler(aDirtyPath, [&](ReadHandler * handler) {
+                for (size_t i = 0; i < MATTER_ARRAY_SIZE(handlers); i++)
+                {
+                    if (handlers[i] == handler)
+                    {
+                        mask |= (1u << i);
+                    }
+                }
+                return Loop::Continue;
+            });
+            return mask;
+        };
+
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1)), 0b0101u);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId2)), 0b0110u);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId + 1, kTestClusterId, kTestFieldId2)), 0b0010u);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId + 1, kTestClusterId + 1, kTestFieldId1)), 0b1000u);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId + 2, kTestClusterId + 1, kTestFieldId1)), 0u);
+
+        // Wildcard dirty paths, as used for endpoint changes.
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId)), 0b0111u);
+        EXPECT_EQ(interested(AttributePathParams()), 0b1111u);
+
+        index.RemoveReadHandler(handler2);
+        EXPECT_EQ(index.GetNumEntries(), MATTER_ARRAY_SIZE(handlers) - 1);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId, kTestClusterId, kTestFieldId1)), 0b0001u);
+        EXPECT_EQ(interested(AttributePathParams(kTestEndpointId)), 0b0011u);
+
+        // Removing a ReadHandler twice is harmless.
+        index.RemoveReadHandler(handler2);
+        EXPECT_EQ(index.GetNumEntries(), MATTER_ARRAY_SIZE(handlers) - 1);
+
+        index.RemoveAll();
+        EXPECT_EQ(index.GetNumEntries(), 0u);
+        EXPECT_EQ(interested(AttributePathParams()), 0u);
+    }
+
+    engine->Shutdown();
+}
+#endif // CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS > 0
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
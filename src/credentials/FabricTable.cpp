@@ -1960,6 +1960,10 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
         // This scope block is to illustrate the complete commit transaction
         // state. We can see it contains a LARGE number of items...
 
+        // Make all the items durable with a single storage commit. The commit marker stored
+        // above is already durable, so an interrupted commit is still cleaned up at next boot.
+        ScopedPersistentStorageBatch storageBatch(mStorage);
+
         // Atomically assume data no longer pending, since we are committing it. Do so here
         // so that FindFabricBy* will return real data and never pending.
         mStateFlags.Clear(StateFlags::kIsPendingFabricDataPresent);
@@ -2054,6 +2058,15 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
             }
         }
         stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : fabricIndexErr;
+
+        // Make all the items stored above durable
+        CHIP_ERROR storageErr = storageBatch.Commit();
+        if (storageErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(FabricProvisioning, "Failed to commit pending fabric data to storage: %" CHIP_ERROR_FORMAT,
+                         storageErr.Format());
+        }
+        stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : storageErr;
     }
 
     // Commit must have same side-effect as reverting all pending data
@@ -17,6 +17,7 @@
 #include <credentials/GroupDataProviderImpl.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/CommonPersistentData.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
@@ -845,12 +846,126 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    mGroupSessionIndex.Invalidate();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    mGroupSessionIndex.Invalidate();
+}
+
+GroupDataProviderImpl::ScopedGroupBatch::ScopedGroupBatch(GroupDataProviderImpl & provider) :
+    mProvider(provider), mStorageBatch(provider.mStorage)
+{
+    mProvider.mBatchDepth++;
+}
+
+GroupDataProviderImpl::ScopedGroupBatch::~ScopedGroupBatch()
+{
+    // The writes of an aborted batch stay visible, and are made durable by the next commit.
+    if (!mEnded)
+    {
+        End(true);
+    }
+}
+
+CHIP_ERROR GroupDataProviderImpl::ScopedGroupBatch::Commit()
+{
+    VerifyOrReturnError(!mEnded, CHIP_NO_ERROR);
+    CHIP_ERROR err = mStorageBatch.Commit();
+    End(err == CHIP_NO_ERROR);
+    return err;
+}
+
+void GroupDataProviderImpl::ScopedGroupBatch::End(bool deliver)
+{
+    mEnded = true;
+    if (--mProvider.mBatchDepth == 0)
+    {
+        mProvider.ReleaseNotifications(deliver);
+    }
+}
+
+void GroupDataProviderImpl::NotifyGroupAdded(FabricIndex fabric_index, const GroupInfo & new_group)
+{
+    Notify(PendingNotification::Type::kAdded, fabric_index, new_group);
+}
+
+void GroupDataProviderImpl::NotifyGroupRemoved(FabricIndex fabric_index, const GroupInfo & old_group)
+{
+    Notify(PendingNotification::Type::kRemoved, fabric_index, old_group);
+}
+
+void GroupDataProviderImpl::NotifyGroupModified(FabricIndex fabric_index, GroupId group_id)
+{
+    GroupInfo group;
+    group.group_id = group_id;
+    Notify(PendingNotification::Type::kModified, fabric_index, group);
+}
+
+void GroupDataProviderImpl::Notify(PendingNotification::Type type, FabricIndex fabric_index, const GroupInfo & group)
+{
+    PendingNotification * notification = nullptr;
+    if (mBatchDepth > 0)
+    {
+        notification = Platform::New<PendingNotification>();
+    }
+    if (notification == nullptr)
+    {
+        // Outside of a batch, or out of memory: the change is already written.
+        Deliver(PendingNotification{ type, fabric_index, group });
+        return;
+    }
+
+    notification->type         = type;
+    notification->fabric_index = fabric_index;
+    notification->group.Copy(group);
+    if (mLastPendingNotification == nullptr)
+    {
+        mPendingNotifications = notification;
+    }
+    else
+    {
+        mLastPendingNotification->next = notification;
+    }
+    mLastPendingNotification = notification;
+}
+
+void GroupDataProviderImpl::Deliver(const PendingNotification & notification)
+{
+    switch (notification.type)
+    {
+    case PendingNotification::Type::kAdded:
+        GroupAdded(notification.fabric_index, notification.group);
+        break;
+    case PendingNotification::Type::kRemoved:
+        GroupRemoved(notification.fabric_index, notification.group);
+        break;
+    case PendingNotification::Type::kModified:
+        GroupModified(notification.fabric_index, notification.group.group_id);
+        break;
+    }
+}
+
+void GroupDataProviderImpl::ReleaseNotifications(bool deliver)
+{
+    // Listeners may change groups again: those notifications are delivered on their own.
+    PendingNotification * notification = mPendingNotifications;
+    mPendingNotifications              = nullptr;
+    mLastPendingNotification           = nullptr;
+
+    while (notification != nullptr)
+    {
+        PendingNotification * next = notification->next;
+        if (deliver)
+        {
+            Deliver(*notification);
+        }
+        Platform::Delete(notification);
+        notification = next;
+    }
 }
 
 //
@@ -861,6 +976,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfo(chip::FabricIndex fabric_index, c
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -878,13 +994,15 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfo(chip::FabricIndex fabric_index, c
 
         group.Copy(info);
         ReturnErrorOnFailure(group.Save(mStorage));
-        GroupModified(fabric_index, info.group_id);
+        ReturnErrorOnFailure(storageBatch.Commit());
+        NotifyGroupModified(fabric_index, info.group_id);
         return CHIP_NO_ERROR;
     }
 
     // New group_id
     group.Copy(info);
-    return SetGroupInfoAt(fabric_index, fabric.group_count, group);
+    ReturnErrorOnFailure(SetGroupInfoAt(fabric_index, fabric.group_count, group));
+    return storageBatch.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupInfo(chip::FabricIndex fabric_index, chip::GroupId group_id, GroupInfo & info)
@@ -915,6 +1033,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -936,7 +1055,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
         {
             mAuxAclNotificationNeeded = true;
         }
-        return group.Save(mStorage);
+        ReturnErrorOnFailure(group.Save(mStorage));
+        return storageBatch.Commit();
     }
     if (index < fabric.group_count)
     {
@@ -949,7 +1069,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
 
         ReturnErrorOnFailure(RemoveEndpoints(fabric_index, old_group.group_id));
         ReturnErrorOnFailure(old_group.Delete(mStorage));
-        GroupRemoved(fabric_index, old_group);
+        NotifyGroupRemoved(fabric_index, old_group);
     }
     else
     {
@@ -976,7 +1096,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     ReturnErrorOnFailure(fabric.Save(mStorage));
-    GroupAdded(fabric_index, group);
+    ReturnErrorOnFailure(storageBatch.Commit());
+    NotifyGroupAdded(fabric_index, group);
     return CHIP_NO_ERROR;
 }
 
@@ -999,6 +1120,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_ind
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -1046,7 +1168,8 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_ind
     }
     // Update fabric info
     ReturnErrorOnFailure(fabric.Save(mStorage));
-    GroupRemoved(fabric_index, group);
+    ReturnErrorOnFailure(storageBatch.Commit());
+    NotifyGroupRemoved(fabric_index, group);
     return CHIP_NO_ERROR;
 }
 
@@ -1067,6 +1190,7 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -1097,7 +1221,8 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
         fabric.first_group = group.group_id;
         fabric.group_count++;
         ReturnErrorOnFailure(fabric.Save(mStorage));
-        GroupAdded(fabric_index, group);
+        ReturnErrorOnFailure(storageBatch.Commit());
+        NotifyGroupAdded(fabric_index, group);
         return CHIP_NO_ERROR;
     }
 
@@ -1130,7 +1255,8 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
     }
     group.endpoint_count++;
     ReturnErrorOnFailure(group.Save(mStorage));
-    GroupModified(fabric_index, group.group_id);
+    ReturnErrorOnFailure(storageBatch.Commit());
+    NotifyGroupModified(fabric_index, group.group_id);
     return CHIP_NO_ERROR;
 }
 
@@ -1139,6 +1265,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
     EndpointData endpoint;
@@ -1175,12 +1302,14 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
     {
         group.endpoint_count--;
         ReturnErrorOnFailure(group.Save(mStorage));
-        GroupModified(fabric_index, group.group_id);
+        ReturnErrorOnFailure(storageBatch.Commit());
+        NotifyGroupModified(fabric_index, group.group_id);
         return CHIP_NO_ERROR;
     }
 
     // No more endpoints and empty groups are not allowed: remove the group.
-    return RemoveGroupInfoAt(fabric_index, group.index);
+    ReturnErrorOnFailure(RemoveGroupInfoAt(fabric_index, group.index));
+    return storageBatch.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id,
@@ -1194,6 +1323,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpointAllGroups(chip::FabricIndex fabr
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -1219,7 +1349,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpointAllGroups(chip::FabricIndex fabr
         group_index++;
     }
 
-    return CHIP_NO_ERROR;
+    return storageBatch.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::EndpointId endpoint_id)
@@ -1384,6 +1514,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -1404,13 +1535,14 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
     group.first_endpoint = kInvalidEndpointId;
     group.endpoint_count = 0;
     ReturnErrorOnFailure(group.Save(mStorage));
+    ReturnErrorOnFailure(storageBatch.Commit());
 
     if (notifyNeeded)
     {
         mAuxAclNotificationNeeded = true;
     }
 
-    GroupModified(fabric_index, group.group_id);
+    NotifyGroupModified(fabric_index, group.group_id);
     return CHIP_NO_ERROR;
 }
 
@@ -1437,7 +1569,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId
 
             map.keyset_id = keyset_id;
             ReturnErrorOnFailure(map.Save(mStorage));
-            GroupModified(fabric_index, group_id);
+            NotifyGroupModified(fabric_index, group_id);
             return CHIP_NO_ERROR;
         }
         map.id = map.next;
@@ -1452,6 +1584,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
 
@@ -1471,7 +1604,8 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     {
         // Update existing map
         ReturnErrorOnFailure(map.Save(mStorage));
-        GroupModified(fabric_index, in_map.group_id);
+        ReturnErrorOnFailure(storageBatch.Commit());
+        NotifyGroupModified(fabric_index, in_map.group_id);
         return CHIP_NO_ERROR;
     }
 
@@ -1497,8 +1631,9 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index,
     }
     // Update fabric
     fabric.map_count++;
-    GroupModified(fabric_index, in_map.group_id);
-    return fabric.Save(mStorage);
+    NotifyGroupModified(fabric_index, in_map.group_id);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return storageBatch.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupKey(FabricIndex fabric_index, GroupId group_id, KeysetId & keyset_id)
@@ -1543,6 +1678,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     KeyMapData map;
 
@@ -1568,14 +1704,16 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
         fabric.map_count--;
     }
     // Update fabric
-    GroupModified(fabric_index, map.group_id);
-    return fabric.Save(mStorage);
+    NotifyGroupModified(fabric_index, map.group_id);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return storageBatch.Commit();
 }
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
@@ -1591,11 +1729,12 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index
         map.id = map.next;
     }
 
-    GroupModified(fabric_index, 0 /* all groups affected*/);
+    NotifyGroupModified(fabric_index, 0 /* all groups affected*/);
     // Update fabric
     fabric.first_map = 0;
     fabric.map_count = 0;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    return storageBatch.Commit();
 }
 
 GroupDataProvider::GroupKeyIterator * GroupDataProviderImpl::IterateGroupKeys(chip::FabricIndex fabric_index)
@@ -1653,6 +1792,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
@@ -1682,7 +1822,10 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     if (found)
     {
         // Update existing keyset info, keep next
-        return keyset.Save(mStorage);
+        ReturnErrorOnFailure(keyset.Save(mStorage));
+        ReturnErrorOnFailure(storageBatch.Commit());
+        UpdateGroupSessionIndex(fabric_index, keyset.keyset_id, keyset.operational_keys, keyset.keys_count);
+        return CHIP_NO_ERROR;
     }
 
     // New keyset
@@ -1694,7 +1837,10 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
     // Update fabric
     fabric.keyset_count++;
     fabric.first_keyset = in_keyset.keyset_id;
-    return fabric.Save(mStorage);
+    ReturnErrorOnFailure(fabric.Save(mStorage));
+    ReturnErrorOnFailure(storageBatch.Commit());
+    UpdateGroupSessionIndex(fabric_index, keyset.keyset_id, keyset.operational_keys, keyset.keys_count);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint16_t target_id, KeySet & out_keyset)
@@ -1724,12 +1870,14 @@ CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, u
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+    ScopedGroupBatch storageBatch(*this);
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
     ReturnErrorOnFailure(fabric.Load(mStorage));
     VerifyOrReturnError(keyset.Find(mStorage, fabric, target_id), CHIP_ERROR_NOT_FOUND);
     ReturnErrorOnFailure(keyset.Delete(mStorage));
+    mGroupSessionIndex.Remove(fabric_index, target_id);
 
     if (keyset.first)
     {
@@ -1767,7 +1915,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, u
         // open to suggestsions for the correct behavior.
         TEMPORARY_RETURN_IGNORED RemoveGroupKeyAt(fabric_index, idx);
     }
-    return CHIP_NO_ERROR;
+    return storageBatch.Commit();
 }
 
 GroupDataProvider::KeySetIterator * GroupDataProviderImpl::IterateKeySets(chip::FabricIndex fabric_index)
@@ -1824,6 +1972,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    ScopedGroupBatch storageBatch(*this);
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1866,7 +2016,10 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
     // event will be emitted from this action
     err                       = fabric.Delete(mStorage);
     mAuxAclNotificationNeeded = false;
-    return err;
+
+    // Make the removals that succeeded durable
+    CHIP_ERROR commitErr = storageBatch.Commit();
+    return (err != CHIP_NO_ERROR) ? err : commitErr;
 }
 
 //
@@ -1977,6 +2130,8 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+    mUseIndex = provider.LoadGroupSessionIndex();
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1998,6 +2153,10 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
         {
             break;
         }
+        if (mUseIndex && !mProvider.mGroupSessionIndex.HasFabric(mSessionId, fabric.fabric_index))
+        {
+            continue;
+        }
 
         // Iterate key sets
         KeyMapData mapping(fabric.fabric_index, fabric.first_map);
@@ -2009,6 +2168,10 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
             {
                 break;
             }
+            if (mUseIndex && !mProvider.mGroupSessionIndex.HasKeySet(mSessionId, fabric.fabric_index, mapping.keyset_id))
+            {
+                continue;
+            }
 
             // Group found, get the keyset
             KeySetData keyset;
@@ -2035,6 +2198,14 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
         FabricData fabric(mFabric);
         VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mProvider.mStorage), false);
 
+        if (mFirstMap && mUseIndex && !mProvider.mGroupSessionIndex.HasFabric(mSessionId, fabric.fabric_index))
+        {
+            // No key set in this fabric uses the target session ID, skip its mappings altogether
+            mFabric = fabric.next;
+            mFabricCount++;
+            continue;
+        }
+
         if (mMapCount >= fabric.map_count)
         {
             // No more keyset/group mappings on the current fabric, try next fabric
@@ -2054,6 +2225,15 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
         KeyMapData mapping(mFabric, mMapping);
         VerifyOrReturnError(CHIP_NO_ERROR == mapping.Load(mProvider.mStorage), false);
 
+        if (mUseIndex && !mProvider.mGroupSessionIndex.HasKeySet(mSessionId, mFabric, mapping.keyset_id))
+        {
+            // The mapped keyset has no key matching the target session ID, try next
+            mMapping = mapping.next;
+            mMapCount++;
+            mKeyIndex = 0;
+            continue;
+        }
+
         // Group found, get the keyset
         KeySetData keyset;
         VerifyOrReturnError(keyset.Find(mProvider.mStorage, fabric, mapping.keyset_id), false);
@@ -2088,6 +2268,150 @@ void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+//
+// Group session index
+//
+
+constexpr size_t GroupDataProviderImpl::GroupSessionIndex::kMaxEntries;
+
+size_t GroupDataProviderImpl::GroupSessionIndex::LowerBound(uint16_t session_id) const
+{
+    size_t low  = 0;
+    size_t high = mCount;
+    while (low < high)
+    {
+        size_t mid = low + (high - low) / 2;
+        if (mEntries[mid].session_id < session_id)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void GroupDataProviderImpl::GroupSessionIndex::Add(uint16_t session_id, FabricIndex fabric_index, KeysetId keyset_id)
+{
+    VerifyOrReturn(mState == State::kValid);
+
+    size_t pos = LowerBound(session_id);
+    for (size_t i = pos; i < mCount && mEntries[i].session_id == session_id; ++i)
+    {
+        if (mEntries[i].fabric_index == fabric_index && mEntries[i].keyset_id == keyset_id)
+        {
+            return;
+        }
+    }
+
+    if (mCount >= kMaxEntries)
+    {
+        ChipLogProgress(Crypto, "Group session index full, falling back to full key set scans");
+        mState = State::kOverflowed;
+        mCount = 0;
+        return;
+    }
+
+    memmove(&mEntries[pos + 1], &mEntries[pos], (mCount - pos) * sizeof(Entry));
+    mEntries[pos].session_id   = session_id;
+    mEntries[pos].keyset_id    = keyset_id;
+    mEntries[pos].fabric_index = fabric_index;
+    mCount++;
+}
+
+void GroupDataProviderImpl::GroupSessionIndex::Remove(FabricIndex fabric_index, KeysetId keyset_id)
+{
+    if (mState == State::kOverflowed)
+    {
+        Invalidate();
+        return;
+    }
+    VerifyOrReturn(mState == State::kValid);
+
+    size_t count = 0;
+    for (size_t i = 0; i < mCount; ++i)
+    {
+        if (mEntries[i].fabric_index != fabric_index || mEntries[i].keyset_id != keyset_id)
+        {
+            mEntries[count++] = mEntries[i];
+        }
+    }
+    mCount = count;
+}
+
+bool GroupDataProviderImpl::GroupSessionIndex::HasFabric(uint16_t session_id, FabricIndex fabric_index) const
+{
+    for (size_t i = LowerBound(session_id); i < mCount && mEntries[i].session_id == session_id; ++i)
+    {
+        if (mEntries[i].fabric_index == fabric_index)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GroupDataProviderImpl::GroupSessionIndex::HasKeySet(uint16_t session_id, FabricIndex fabric_index, KeysetId keyset_id) const
+{
+    for (size_t i = LowerBound(session_id); i < mCount && mEntries[i].session_id == session_id; ++i)
+    {
+        if (mEntries[i].fabric_index == fabric_index && mEntries[i].keyset_id == keyset_id)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool GroupDataProviderImpl::LoadGroupSessionIndex()
+{
+    VerifyOrReturnValue(mGroupSessionIndex.GetState() == GroupSessionIndex::State::kStale, mGroupSessionIndex.IsValid());
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnValue(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, false);
+
+    mGroupSessionIndex.Reset();
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        if (CHIP_NO_ERROR != fabric.Load(mStorage))
+        {
+            mGroupSessionIndex.Invalidate();
+            return false;
+        }
+
+        KeySetData keyset(fabric.fabric_index, fabric.first_keyset);
+        for (uint16_t j = 0; j < fabric.keyset_count; ++j, keyset.keyset_id = keyset.next)
+        {
+            if (CHIP_NO_ERROR != keyset.Load(mStorage))
+            {
+                mGroupSessionIndex.Invalidate();
+                return false;
+            }
+            UpdateGroupSessionIndex(fabric.fabric_index, keyset.keyset_id, keyset.operational_keys, keyset.keys_count);
+        }
+    }
+
+    return mGroupSessionIndex.IsValid();
+}
+
+void GroupDataProviderImpl::UpdateGroupSessionIndex(FabricIndex fabric_index, KeysetId keyset_id,
+                                                    const Crypto::GroupOperationalCredentials * keys, uint8_t keys_count)
+{
+    // A key set write does not make room in an overflowed index: only RemoveKeySet() does.
+    VerifyOrReturn(mGroupSessionIndex.IsValid());
+
+    mGroupSessionIndex.Remove(fabric_index, keyset_id);
+    for (uint8_t i = 0; (i < keys_count) && (i < KeySet::kEpochKeysMax); ++i)
+    {
+        mGroupSessionIndex.Add(keys[i].hash, fabric_index, keyset_id);
+    }
+}
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
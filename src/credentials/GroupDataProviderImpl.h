@@ -270,9 +270,123 @@ protected:
         uint16_t mKeyIndex       = 0;
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
+        bool mUseIndex           = false;
         GroupKeyContext mGroupKeyContext;
     };
 
+    /**
+     *  In-memory index of the operational key hashes (group session IDs) installed in each fabric's key sets.
+     *  It lets IterateGroupSessions() skip fabrics and key sets that cannot match an incoming group session ID
+     *  without loading them from persistent storage. The index is built lazily on first use and kept up to date
+     *  on key set writes. When the index overflows, lookups fall back to a full scan until a key set is removed,
+     *  after which the index is built again.
+     */
+    class GroupSessionIndex
+    {
+    public:
+        static constexpr size_t kMaxEntries = CHIP_CONFIG_MAX_FABRICS * kMaxGroupKeysPerFabric * KeySet::kEpochKeysMax;
+
+        enum class State : uint8_t
+        {
+            kStale,      // Not built yet, or out of date: built again on next use
+            kValid,      // Complete, may be used to skip key sets
+            kOverflowed, // Too many key hashes to fit: not used, nor built again until a key set is removed
+        };
+
+        State GetState() const { return mState; }
+        bool IsValid() const { return mState == State::kValid; }
+        void Invalidate()
+        {
+            mState = State::kStale;
+            mCount = 0;
+        }
+        void Reset()
+        {
+            mState = State::kValid;
+            mCount = 0;
+        }
+
+        /**
+         *  Adds the given key hash for the key set. Duplicate entries are ignored.
+         *  On overflow the index is marked as overflowed, since it can no longer be trusted to be complete.
+         */
+        void Add(uint16_t session_id, FabricIndex fabric_index, KeysetId keyset_id);
+
+        /**
+         *  Removes the key hashes of the key set. If the index had overflowed, it is marked stale so that it is
+         *  built again, now that fewer key hashes may fit.
+         */
+        void Remove(FabricIndex fabric_index, KeysetId keyset_id);
+
+        bool HasFabric(uint16_t session_id, FabricIndex fabric_index) const;
+        bool HasKeySet(uint16_t session_id, FabricIndex fabric_index, KeysetId keyset_id) const;
+
+    private:
+        struct Entry
+        {
+            uint16_t session_id;
+            KeysetId keyset_id;
+            FabricIndex fabric_index;
+        };
+
+        // Entries are kept sorted by session_id, returns the index of the first entry not lower than session_id
+        size_t LowerBound(uint16_t session_id) const;
+
+        Entry mEntries[kMaxEntries];
+        size_t mCount = 0;
+        State mState  = State::kStale;
+    };
+
+    // Batches the storage writes of an operation. Group notifications are held while any batch is open, and
+    // delivered when the outermost one ends, so that nested operations don't report changes before they are durable.
+    class ScopedGroupBatch
+    {
+    public:
+        explicit ScopedGroupBatch(GroupDataProviderImpl & provider);
+        ~ScopedGroupBatch();
+
+        ScopedGroupBatch(const ScopedGroupBatch &)             = delete;
+        ScopedGroupBatch & operator=(const ScopedGroupBatch &) = delete;
+
+        // Commits the batch. Does nothing if the batch was already committed.
+        [[nodiscard]] CHIP_ERROR Commit();
+
+    private:
+        void End(bool deliver);
+
+        GroupDataProviderImpl & mProvider;
+        ScopedPersistentStorageBatch mStorageBatch;
+        bool mEnded = false;
+    };
+
+    struct PendingNotification
+    {
+        enum class Type : uint8_t
+        {
+            kAdded,
+            kRemoved,
+            kModified,
+        };
+
+        Type type;
+        FabricIndex fabric_index;
+        GroupInfo group;
+        PendingNotification * next = nullptr;
+    };
+
+    void NotifyGroupAdded(FabricIndex fabric_index, const GroupInfo & new_group);
+    void NotifyGroupRemoved(FabricIndex fabric_index, const GroupInfo & old_group);
+    void NotifyGroupModified(FabricIndex fabric_index, GroupId group_id);
+    void Notify(PendingNotification::Type type, FabricIndex fabric_index, const GroupInfo & group);
+    void Deliver(const PendingNotification & notification);
+    // Delivers the held notifications, or drops them if the outermost batch failed to commit.
+    void ReleaseNotifications(bool deliver);
+
+    // Loads the group session index from storage, if it is not up to date. Returns true if the index may be used.
+    bool LoadGroupSessionIndex();
+    void UpdateGroupSessionIndex(FabricIndex fabric_index, KeysetId keyset_id, const Crypto::GroupOperationalCredentials * keys,
+                                 uint8_t keys_count);
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -281,7 +395,13 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+    GroupSessionIndex mGroupSessionIndex;
     bool mAuxAclNotificationNeeded = false;
+
+    // Depth of the open batches, and the notifications held until the outermost one ends, in order.
+    uint32_t mBatchDepth                           = 0;
+    PendingNotification * mPendingNotifications    = nullptr;
+    PendingNotification * mLastPendingNotification = nullptr;
 };
 
 } // namespace Credentials
@@ -481,6 +481,9 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
 
     // TODO: Handle transaction marking to revert partial certs at next boot if we get interrupted by reboot.
 
+    // Commit all the certificates, or the clean-up on failure, to storage at once.
+    ScopedPersistentStorageBatch storageBatch(mStorage);
+
     // Start committing NOC first so we don't have dangling roots if one was added.
     ByteSpan pendingNocSpan{ mPendingNoc.Get(), mPendingNoc.AllocatedSize() };
     CHIP_ERROR nocErr = SaveCertToStorage(mStorage, mPendingFabricIndex, CertChainElement::kNoc, pendingNocSpan);
@@ -526,9 +529,13 @@ CHIP_ERROR PersistentStorageOpCertStore::CommitOpCertsForFabric(FabricIndex fabr
             // TODO: Handle transaction marking to revert certs if somehow failing store on update by pre-backing-up opcerts
         }
 
+        // Make the clean-up durable, the first error is what gets reported.
+        (void) storageBatch.Commit();
         return stickyErr;
     }
 
+    ReturnErrorOnFailure(storageBatch.Commit());
+
     // If we got here, we succeeded and can reset the pending certs: next `GetCertificate` will use the stored certs
     RevertPendingOpCerts();
     return CHIP_NO_ERROR;
@@ -563,6 +570,7 @@ CHIP_ERROR PersistentStorageOpCertStore::RemoveOpCertsForFabric(FabricIndex fabr
     RevertPendingOpCerts();
 
     // Remove all persisted certs for the given fabric, blindly
+    ScopedPersistentStorageBatch storageBatch(mStorage);
     CHIP_ERROR nocErr  = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kNoc);
     CHIP_ERROR icacErr = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kIcac);
     CHIP_ERROR rcacErr = DeleteCertFromStorage(mStorage, fabricIndex, CertChainElement::kRcac);
@@ -578,12 +586,16 @@ CHIP_ERROR PersistentStorageOpCertStore::RemoveOpCertsForFabric(FabricIndex fabr
     vvscErr = (vvscErr == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : vvscErr;
     vvsErr  = (vvsErr == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND) ? CHIP_NO_ERROR : vvsErr;
 
+    // Make the deletions that succeeded durable
+    CHIP_ERROR commitErr = storageBatch.Commit();
+
     // Find the first error and return that
     CHIP_ERROR stickyErr = nocErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : icacErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : rcacErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : vvscErr;
     stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : vvsErr;
+    stickyErr            = (stickyErr != CHIP_NO_ERROR) ? stickyErr : commitErr;
 
     return stickyErr;
 }
@@ -16,6 +16,7 @@
  *    limitations under the License.
  */
 
+#include <limits>
 #include <set>
 #include <string.h>
 #include <tuple>
@@ -140,13 +141,17 @@ public:
     GroupInfo latest;
     size_t added_count   = 0;
     size_t removed_count = 0;
+    // Notifications received while the storage had writes not yet committed
+    size_t uncommitted_count                      = 0;
+    chip::TestPersistentStorageDelegate * storage = nullptr;
 
     void Reset()
     {
-        fabric_index  = kUndefinedFabricIndex;
-        latest        = GroupInfo();
-        added_count   = 0;
-        removed_count = 0;
+        fabric_index      = kUndefinedFabricIndex;
+        latest            = GroupInfo();
+        added_count       = 0;
+        removed_count     = 0;
+        uncommitted_count = 0;
     }
 
     void OnGroupAdded(chip::FabricIndex fabric, const GroupInfo & new_group) override
@@ -154,12 +159,21 @@ public:
         fabric_index = fabric;
         latest.Copy(new_group);
         added_count++;
+        CheckCommitted();
     }
     void OnGroupRemoved(chip::FabricIndex fabric, const GroupInfo & old_group) override
     {
         fabric_index = fabric;
         latest.Copy(old_group);
         removed_count++;
+        CheckCommitted();
+    }
+    void CheckCommitted()
+    {
+        if ((storage != nullptr) && storage->IsBatching())
+        {
+            uncommitted_count++;
+        }
     }
 };
 static TestListener sListener;
@@ -227,6 +241,7 @@ struct TestGroupDataProvider : public ::testing::Test
         sProvider.SetStorageDelegate(&sDelegate);
         sProvider.SetSessionKeystore(&sSessionKeystore);
         sProvider.SetListener(&chip::app::TestGroups::sListener);
+        chip::app::TestGroups::sListener.storage = &sDelegate;
         EXPECT_EQ(sProvider.Init(), CHIP_NO_ERROR);
         SetGroupDataProvider(&sProvider);
 
@@ -400,6 +415,48 @@ TEST_F(TestGroupDataProvider, TestGroupInfo)
     EXPECT_EQ(sListener.removed_count, 3u);
 }
 
+TEST_F(TestGroupDataProvider, TestGroupNotificationsAfterCommit)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+    sListener.Reset();
+
+    // New groups are saved by a nested SetGroupInfoAt()
+    EXPECT_EQ(provider->SetGroupInfo(kFabric1, kGroupInfo1_1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupInfo(kFabric1, kGroupInfo1_2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupInfo(kFabric1, kGroupInfo1_3), CHIP_NO_ERROR);
+    EXPECT_EQ(sListener.added_count, 3u);
+    EXPECT_EQ(sListener.latest, kGroupInfo1_3);
+
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->AddEndpoint(kFabric1, kGroup2, kEndpointId1), CHIP_NO_ERROR);
+
+    // Removing the last endpoint of a group removes it with a nested RemoveGroupInfoAt()
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kGroup1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(sListener.removed_count, 1u);
+    EXPECT_EQ(sListener.latest.group_id, kGroup1);
+
+    // Nested RemoveEndpoint() for each group
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kEndpointId1), CHIP_NO_ERROR);
+    EXPECT_EQ(sListener.removed_count, 1u);
+    EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kEndpointId0), CHIP_NO_ERROR);
+    EXPECT_EQ(sListener.removed_count, 2u);
+    EXPECT_EQ(sListener.latest.group_id, kGroup2);
+
+    // Nested RemoveGroupInfoAt() for each group
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_EQ(sListener.added_count, 3u);
+    EXPECT_EQ(sListener.removed_count, 3u);
+    EXPECT_EQ(sListener.latest, kGroupInfo1_3);
+
+    // Listeners only learned of changes once they were committed
+    EXPECT_EQ(sListener.uncommitted_count, 0u);
+}
+
 TEST_F(TestGroupDataProvider, TestGroupInfoIterator)
 {
     GroupDataProvider * provider = GetGroupDataProvider();
@@ -536,7 +593,10 @@ TEST_F(TestGroupDataProvider, TestEndpoints)
     EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup3, kEndpointId3));
     EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup4, kEndpointId3));
 
+    // Updating the lists of all the groups is committed to storage at once
+    size_t commitCount = sDelegate.GetNumCommits();
     EXPECT_EQ(provider->RemoveEndpoint(kFabric1, kEndpointId3), CHIP_NO_ERROR);
+    EXPECT_EQ(sDelegate.GetNumCommits(), commitCount + 1);
 
     EXPECT_TRUE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId1));
     EXPECT_FALSE(provider->HasEndpoint(kFabric1, kGroup1, kEndpointId3));
@@ -1231,6 +1291,126 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionIndexUpdates)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    auto countSessions = [provider](uint16_t session_id) {
+        auto it = provider->IterateGroupSessions(session_id);
+        if (it == nullptr)
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+        size_t total = it->Count();
+        size_t count = 0;
+        GroupSession session;
+        while (it->Next(session))
+        {
+            count++;
+        }
+        it->Release();
+        return (count == total) ? count : std::numeric_limits<size_t>::max();
+    };
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t old_session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    EXPECT_EQ(countSessions(old_session_id), 1u);
+
+    // Replacing the keys of an existing key set must update the session lookup
+    KeySet updated(kKeysetId1, SecurityPolicy::kTrustFirst, 1);
+    memcpy(updated.epoch_keys, kEpochKeys2, sizeof(kEpochKeys2));
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, updated), CHIP_NO_ERROR);
+
+    key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t new_session_id = key_context->GetKeyHash();
+    key_context->Release();
+    ASSERT_NE(old_session_id, new_session_id);
+
+    EXPECT_EQ(countSessions(old_session_id), 0u);
+    EXPECT_EQ(countSessions(new_session_id), 1u);
+
+    // The same key set on a second fabric yields one session per fabric
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId1, updated), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(new_session_id), 2u);
+
+    // Removing the key set removes its sessions
+    EXPECT_EQ(provider->RemoveKeySet(kFabric1, kKeysetId1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(new_session_id), 1u);
+
+    ResetProvider(provider);
+    EXPECT_EQ(countSessions(new_session_id), 0u);
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionIndexOverflow)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    auto countSessions = [provider](uint16_t session_id) {
+        auto it = provider->IterateGroupSessions(session_id);
+        if (it == nullptr)
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+        size_t count = 0;
+        GroupSession session;
+        while (it->Next(session))
+        {
+            count++;
+        }
+        it->Release();
+        return count;
+    };
+
+    // One more fabric than the index is sized for, each with all of its key sets holding three keys
+    constexpr FabricIndex kFabricCount = CHIP_CONFIG_MAX_FABRICS + 1;
+    for (FabricIndex fabric_index = 1; fabric_index <= kFabricCount; fabric_index++)
+    {
+        for (uint16_t i = 1; i <= kMaxGroupKeysPerFabric; i++)
+        {
+            KeySet keyset    = kKeySet0;
+            keyset.keyset_id = i;
+            EXPECT_EQ(provider->SetKeySet(fabric_index, kCompressedFabricId1, keyset), CHIP_NO_ERROR);
+        }
+    }
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, GroupKey(kGroup1, 1)), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabricCount, 0, GroupKey(kGroup1, 1)), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    // The index overflows: sessions are found by scanning all key sets
+    EXPECT_EQ(countSessions(session_id), 2u);
+    EXPECT_EQ(countSessions(session_id), 2u);
+
+    // Removing a fabric makes the key hashes fit again
+    EXPECT_EQ(provider->RemoveFabric(kFabricCount), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(session_id), 1u);
+
+    for (FabricIndex fabric_index = 1; fabric_index < kFabricCount; fabric_index++)
+    {
+        EXPECT_EQ(provider->RemoveFabric(fabric_index), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(countSessions(session_id), 0u);
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
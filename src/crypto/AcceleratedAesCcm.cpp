@@ -0,0 +1,522 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements AES-CCM with the AES instructions of the CPU.
+ */
+
+#include <crypto/AcceleratedAesCcm.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+#define CHIP_AES_CCM_ACCEL_X86_64 1
+#define CHIP_AES_CCM_ACCEL_TARGET __attribute__((target("aes")))
+#elif defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_AES
+#define HWCAP_AES (1 << 3)
+#endif
+#endif // defined(__linux__)
+#define CHIP_AES_CCM_ACCEL_AARCH64 1
+#if defined(__clang__)
+#define CHIP_AES_CCM_ACCEL_TARGET __attribute__((target("aes")))
+#else
+#define CHIP_AES_CCM_ACCEL_TARGET __attribute__((target("+crypto")))
+#endif
+#endif
+
+namespace chip {
+namespace Crypto {
+
+#if CHIP_AES_CCM_ACCEL_X86_64 || CHIP_AES_CCM_ACCEL_AARCH64
+
+namespace {
+
+constexpr size_t kBlockLength = kAES_CCM128_Block_Length;
+
+#if CHIP_AES_CCM_ACCEL_X86_64
+
+using Block = __m128i;
+
+CHIP_AES_CCM_ACCEL_TARGET inline Block LoadBlock(const uint8_t * data)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+CHIP_AES_CCM_ACCEL_TARGET inline void StoreBlock(uint8_t * data, Block block)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(data), block);
+}
+
+CHIP_AES_CCM_ACCEL_TARGET inline Block XorBlocks(Block a, Block b)
+{
+    return _mm_xor_si128(a, b);
+}
+
+// Sets the last bytes of a counter block, which are 0 in base, to the big-endian counter.
+CHIP_AES_CCM_ACCEL_TARGET inline Block CounterBlock(Block base, uint64_t counter)
+{
+    return _mm_xor_si128(base, _mm_set_epi64x(static_cast<long long>(__builtin_bswap64(counter)), 0));
+}
+
+CHIP_AES_CCM_ACCEL_TARGET inline Block EncryptBlock(const Block * roundKeys, Block block)
+{
+    block = _mm_xor_si128(block, roundKeys[0]);
+    for (size_t i = 1; i < AcceleratedAesCcm::kNumRoundKeys - 1; i++)
+    {
+        block = _mm_aesenc_si128(block, roundKeys[i]);
+    }
+    return _mm_aesenclast_si128(block, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+}
+
+// Encrypts two independent blocks, whose rounds the CPU can run at the same time.
+CHIP_AES_CCM_ACCEL_TARGET inline void EncryptBlocks(const Block * roundKeys, Block & a, Block & b)
+{
+    a = _mm_xor_si128(a, roundKeys[0]);
+    b = _mm_xor_si128(b, roundKeys[0]);
+    for (size_t i = 1; i < AcceleratedAesCcm::kNumRoundKeys - 1; i++)
+    {
+        a = _mm_aesenc_si128(a, roundKeys[i]);
+        b = _mm_aesenc_si128(b, roundKeys[i]);
+    }
+    a = _mm_aesenclast_si128(a, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+    b = _mm_aesenclast_si128(b, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+}
+
+template <int kRcon>
+CHIP_AES_CCM_ACCEL_TARGET inline Block NextRoundKey(Block key)
+{
+    Block assist = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(key, kRcon), _MM_SHUFFLE(3, 3, 3, 3));
+    key          = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key          = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key          = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, assist);
+}
+
+CHIP_AES_CCM_ACCEL_TARGET void ExpandRoundKeys(const uint8_t * key, uint8_t (*roundKeys)[kBlockLength])
+{
+    Block roundKey = LoadBlock(key);
+    StoreBlock(roundKeys[0], roundKey);
+    roundKey = NextRoundKey<0x01>(roundKey);
+    StoreBlock(roundKeys[1], roundKey);
+    roundKey = NextRoundKey<0x02>(roundKey);
+    StoreBlock(roundKeys[2], roundKey);
+    roundKey = NextRoundKey<0x04>(roundKey);
+    StoreBlock(roundKeys[3], roundKey);
+    roundKey = NextRoundKey<0x08>(roundKey);
+    StoreBlock(roundKeys[4], roundKey);
+    roundKey = NextRoundKey<0x10>(roundKey);
+    StoreBlock(roundKeys[5], roundKey);
+    roundKey = NextRoundKey<0x20>(roundKey);
+    StoreBlock(roundKeys[6], roundKey);
+    roundKey = NextRoundKey<0x40>(roundKey);
+    StoreBlock(roundKeys[7], roundKey);
+    roundKey = NextRoundKey<0x80>(roundKey);
+    StoreBlock(roundKeys[8], roundKey);
+    roundKey = NextRoundKey<0x1b>(roundKey);
+    StoreBlock(roundKeys[9], roundKey);
+    roundKey = NextRoundKey<0x36>(roundKey);
+    StoreBlock(roundKeys[10], roundKey);
+}
+
+bool CpuHasAesInstructions()
+{
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_AES) != 0;
+}
+
+#else // CHIP_AES_CCM_ACCEL_AARCH64
+
+using Block = uint8x16_t;
+
+CHIP_AES_CCM_ACCEL_TARGET inline Block LoadBlock(const uint8_t * data)
+{
+    return vld1q_u8(data);
+}
+
+CHIP_AES_CCM_ACCEL_TARGET inline void StoreBlock(uint8_t * data, Block block)
+{
+    vst1q_u8(data, block);
+}
+
+CHIP_AES_CCM_ACCEL_TARGET inline Block XorBlocks(Block a, Block b)
+{
+    return veorq_u8(a, b);
+}
+
+// Sets the last bytes of a counter block, which are 0 in base, to the big-endian counter.
+CHIP_AES_CCM_ACCEL_TARGET inline Block CounterBlock(Block base, uint64_t counter)
+{
+    return veorq_u8(base, vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(0), vcreate_u64(__builtin_bswap64(counter)))));
+}
+
+// AESE adds the round key before substituting the bytes, so the first round key goes into the first AESE and the last one is
+// added separately.
+CHIP_AES_CCM_ACCEL_TARGET inline Block EncryptBlock(const Block * roundKeys, Block block)
+{
+    for (size_t i = 0; i < AcceleratedAesCcm::kNumRoundKeys - 2; i++)
+    {
+        block = vaesmcq_u8(vaeseq_u8(block, roundKeys[i]));
+    }
+    block = vaeseq_u8(block, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 2]);
+    return veorq_u8(block, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+}
+
+// Encrypts two independent blocks, whose rounds the CPU can run at the same time.
+CHIP_AES_CCM_ACCEL_TARGET inline void EncryptBlocks(const Block * roundKeys, Block & a, Block & b)
+{
+    for (size_t i = 0; i < AcceleratedAesCcm::kNumRoundKeys - 2; i++)
+    {
+        a = vaesmcq_u8(vaeseq_u8(a, roundKeys[i]));
+        b = vaesmcq_u8(vaeseq_u8(b, roundKeys[i]));
+    }
+    a = veorq_u8(vaeseq_u8(a, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 2]), roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+    b = veorq_u8(vaeseq_u8(b, roundKeys[AcceleratedAesCcm::kNumRoundKeys - 2]), roundKeys[AcceleratedAesCcm::kNumRoundKeys - 1]);
+}
+
+// Applies the S-box to each byte of a word.  With the word in every column, ShiftRows does not move any byte out of its column,
+// so AESE with a zero key only substitutes the bytes.
+CHIP_AES_CCM_ACCEL_TARGET inline uint32_t SubWord(uint32_t word)
+{
+    Block block = vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(word)), vdupq_n_u8(0));
+    return vgetq_lane_u32(vreinterpretq_u32_u8(block), 0);
+}
+
+CHIP_AES_CCM_ACCEL_TARGET void ExpandRoundKeys(const uint8_t * key, uint8_t (*roundKeys)[kBlockLength])
+{
+    static constexpr uint8_t kRcon[] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 };
+
+    // The words are little-endian, so RotWord is a rotation to the right.
+    uint32_t words[AcceleratedAesCcm::kNumRoundKeys * 4];
+    memcpy(words, key, kBlockLength);
+    for (size_t i = 4; i < MATTER_ARRAY_SIZE(words); i++)
+    {
+        uint32_t word = words[i - 1];
+        if (i % 4 == 0)
+        {
+            word = SubWord((word >> 8) | (word << 24)) ^ kRcon[i / 4 - 1];
+        }
+        words[i] = words[i - 4] ^ word;
+    }
+    memcpy(roundKeys, words, sizeof(words));
+    ClearSecretData(reinterpret_cast<uint8_t *>(words), sizeof(words));
+}
+
+bool CpuHasAesInstructions()
+{
+#if defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#elif defined(__APPLE__)
+    // All 64-bit Apple processors have them.
+    return true;
+#elif defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+    return true;
+#else
+    return false;
+#endif
+}
+
+#endif // CHIP_AES_CCM_ACCEL_X86_64
+
+CHIP_ERROR CheckParameters(size_t length, size_t aad_length, const uint8_t * nonce, size_t nonce_length, size_t tag_length)
+{
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce_length >= 7 && nonce_length <= 13, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length >= 4 && tag_length <= 16 && tag_length % 2 == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(static_cast<uint64_t>(aad_length) <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The length of the message has to fit in the bytes of the counter, of which there are 15 - nonce_length.
+    const size_t counterLength = kBlockLength - 1 - nonce_length;
+    VerifyOrReturnError(counterLength >= sizeof(uint64_t) || static_cast<uint64_t>(length) < (uint64_t(1) << (8 * counterLength)),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Encrypts or decrypts a message and computes the CBC-MAC of its plaintext.  Returns the full tag, encrypted, in tag.
+ */
+CHIP_AES_CCM_ACCEL_TARGET void CcmCrypt(const AcceleratedAesCcm::KeySchedule & schedule, bool encrypt, const uint8_t * input,
+                                        size_t length, const uint8_t * aad, size_t aad_length, const uint8_t * nonce,
+                                        size_t nonce_length, uint8_t * output, size_t tag_length, uint8_t (&tag)[kBlockLength])
+{
+    Block roundKeys[AcceleratedAesCcm::kNumRoundKeys];
+    for (size_t i = 0; i < AcceleratedAesCcm::kNumRoundKeys; i++)
+    {
+        roundKeys[i] = LoadBlock(schedule.mRoundKeys[i]);
+    }
+
+    const size_t counterLength = kBlockLength - 1 - nonce_length;
+    uint8_t bytes[kBlockLength];
+
+    // Counter block A_0, whose encryption encrypts the tag.
+    memset(bytes, 0, sizeof(bytes));
+    bytes[0] = static_cast<uint8_t>(counterLength - 1);
+    memcpy(&bytes[1], nonce, nonce_length);
+    const Block counterBase = LoadBlock(bytes);
+
+    // Block B_0, the first one authenticated.
+    bytes[0] = static_cast<uint8_t>((aad_length > 0 ? 0x40 : 0) | (((tag_length - 2) / 2) << 3) | (counterLength - 1));
+    uint64_t remaining = length;
+    for (size_t i = 0; i < counterLength && i < sizeof(uint64_t); i++)
+    {
+        bytes[kBlockLength - 1 - i] = static_cast<uint8_t>(remaining);
+        remaining >>= 8;
+    }
+
+    Block mac       = LoadBlock(bytes);
+    Block tagStream = counterBase;
+    EncryptBlocks(roundKeys, mac, tagStream);
+
+    // Additional data, preceded by its length.
+    if (aad_length > 0)
+    {
+        size_t headerLength;
+        memset(bytes, 0, sizeof(bytes));
+        if (aad_length < 0xFF00)
+        {
+            bytes[0]     = static_cast<uint8_t>(aad_length >> 8);
+            bytes[1]     = static_cast<uint8_t>(aad_length);
+            headerLength = 2;
+        }
+        else
+        {
+            bytes[0]     = 0xFF;
+            bytes[1]     = 0xFE;
+            bytes[2]     = static_cast<uint8_t>(aad_length >> 24);
+            bytes[3]     = static_cast<uint8_t>(aad_length >> 16);
+            bytes[4]     = static_cast<uint8_t>(aad_length >> 8);
+            bytes[5]     = static_cast<uint8_t>(aad_length);
+            headerLength = 6;
+        }
+
+        size_t offset = std::min(aad_length, kBlockLength - headerLength);
+        memcpy(&bytes[headerLength], aad, offset);
+        mac = EncryptBlock(roundKeys, XorBlocks(mac, LoadBlock(bytes)));
+
+        for (; aad_length - offset >= kBlockLength; offset += kBlockLength)
+        {
+            mac = EncryptBlock(roundKeys, XorBlocks(mac, LoadBlock(&aad[offset])));
+        }
+        if (offset < aad_length)
+        {
+            memset(bytes, 0, sizeof(bytes));
+            memcpy(bytes, &aad[offset], aad_length - offset);
+            mac = EncryptBlock(roundKeys, XorBlocks(mac, LoadBlock(bytes)));
+        }
+    }
+
+    // Message, whose last block is padded with zeros.  Blocks are encrypted with counters starting at 1.
+    uint64_t counter = 1;
+    if (encrypt)
+    {
+        for (size_t offset = 0; offset < length; offset += kBlockLength, counter++)
+        {
+            const size_t blockLength = std::min(length - offset, kBlockLength);
+            Block plaintext;
+            if (blockLength == kBlockLength)
+            {
+                plaintext = LoadBlock(&input[offset]);
+            }
+            else
+            {
+                memset(bytes, 0, sizeof(bytes));
+                memcpy(bytes, &input[offset], blockLength);
+                plaintext = LoadBlock(bytes);
+            }
+
+            Block keyStream = CounterBlock(counterBase, counter);
+            mac             = XorBlocks(mac, plaintext);
+            EncryptBlocks(roundKeys, mac, keyStream);
+
+            if (blockLength == kBlockLength)
+            {
+                StoreBlock(&output[offset], XorBlocks(plaintext, keyStream));
+            }
+            else
+            {
+                StoreBlock(bytes, XorBlocks(plaintext, keyStream));
+                memcpy(&output[offset], bytes, blockLength);
+            }
+        }
+    }
+    else if (length > 0)
+    {
+        // The key stream of each block is computed together with the CBC-MAC of the previous one.
+        Block keyStream = EncryptBlock(roundKeys, CounterBlock(counterBase, counter));
+        for (size_t offset = 0; offset < length; offset += kBlockLength)
+        {
+            const size_t blockLength = std::min(length - offset, kBlockLength);
+            Block plaintext;
+            if (blockLength == kBlockLength)
+            {
+                plaintext = XorBlocks(LoadBlock(&input[offset]), keyStream);
+                StoreBlock(&output[offset], plaintext);
+            }
+            else
+            {
+                memset(bytes, 0, sizeof(bytes));
+                memcpy(bytes, &input[offset], blockLength);
+                StoreBlock(bytes, XorBlocks(LoadBlock(bytes), keyStream));
+                memcpy(&output[offset], bytes, blockLength);
+                memset(&bytes[blockLength], 0, kBlockLength - blockLength);
+                plaintext = LoadBlock(bytes);
+            }
+
+            mac = XorBlocks(mac, plaintext);
+            if (length - offset > kBlockLength)
+            {
+                keyStream = CounterBlock(counterBase, ++counter);
+                EncryptBlocks(roundKeys, mac, keyStream);
+            }
+            else
+            {
+                mac = EncryptBlock(roundKeys, mac);
+            }
+        }
+    }
+
+    StoreBlock(tag, XorBlocks(mac, tagStream));
+    ClearSecretData(bytes);
+    ClearSecretData(reinterpret_cast<uint8_t *>(&mac), sizeof(mac));
+    ClearSecretData(reinterpret_cast<uint8_t *>(&tagStream), sizeof(tagStream));
+    ClearSecretData(reinterpret_cast<uint8_t *>(roundKeys), sizeof(roundKeys));
+}
+
+} // namespace
+
+bool AcceleratedAesCcm::IsSupported()
+{
+    static const bool sSupported = CpuHasAesInstructions();
+    return sSupported;
+}
+
+void AcceleratedAesCcm::ExpandKey(const Symmetric128BitsKeyByteArray & key, KeySchedule & schedule)
+{
+    ExpandRoundKeys(key, schedule.mRoundKeys);
+}
+
+CHIP_ERROR AcceleratedAesCcm::Encrypt(const KeySchedule & schedule, const uint8_t * plaintext, size_t plaintext_length,
+                                      const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                                      uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(plaintext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr || plaintext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    aad_length = (aad != nullptr) ? aad_length : 0;
+    ReturnErrorOnFailure(CheckParameters(plaintext_length, aad_length, nonce, nonce_length, tag_length));
+
+    uint8_t fullTag[kBlockLength];
+    CcmCrypt(schedule, /* encrypt = */ true, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext,
+             tag_length, fullTag);
+    memcpy(tag, fullTag, tag_length);
+    ClearSecretData(fullTag);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AcceleratedAesCcm::Decrypt(const KeySchedule & schedule, const uint8_t * ciphertext, size_t ciphertext_length,
+                                      const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                                      const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext)
+{
+    VerifyOrReturnError(ciphertext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr || ciphertext_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    aad_length = (aad != nullptr) ? aad_length : 0;
+    ReturnErrorOnFailure(CheckParameters(ciphertext_length, aad_length, nonce, nonce_length, tag_length));
+
+    uint8_t expectedTag[kBlockLength];
+    CcmCrypt(schedule, /* encrypt = */ false, ciphertext, ciphertext_length, aad, aad_length, nonce, nonce_length, plaintext,
+             tag_length, expectedTag);
+
+    // Compare in constant time, so as not to reveal how many bytes of the tag match.
+    uint8_t difference = 0;
+    for (size_t i = 0; i < tag_length; i++)
+    {
+        difference = static_cast<uint8_t>(difference | (expectedTag[i] ^ tag[i]));
+    }
+    ClearSecretData(expectedTag);
+
+    if (difference != 0)
+    {
+        if (ciphertext_length > 0)
+        {
+            ClearSecretData(plaintext, ciphertext_length);
+        }
+        return CHIP_ERROR_INTERNAL;
+    }
+    return CHIP_NO_ERROR;
+}
+
+#else // CHIP_AES_CCM_ACCEL_X86_64 || CHIP_AES_CCM_ACCEL_AARCH64
+
+bool AcceleratedAesCcm::IsSupported()
+{
+    return false;
+}
+
+void AcceleratedAesCcm::ExpandKey(const Symmetric128BitsKeyByteArray & key, KeySchedule & schedule) {}
+
+CHIP_ERROR AcceleratedAesCcm::Encrypt(const KeySchedule & schedule, const uint8_t * plaintext, size_t plaintext_length,
+                                      const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                                      uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+CHIP_ERROR AcceleratedAesCcm::Decrypt(const KeySchedule & schedule, const uint8_t * ciphertext, size_t ciphertext_length,
+                                      const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                                      const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+#endif // CHIP_AES_CCM_ACCEL_X86_64 || CHIP_AES_CCM_ACCEL_AARCH64
+
+CHIP_ERROR AcceleratedAesCcm::Encrypt(const Symmetric128BitsKeyByteArray & key, const uint8_t * plaintext, size_t plaintext_length,
+                                      const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                                      uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    KeySchedule schedule;
+    ExpandKey(key, schedule);
+    CHIP_ERROR err =
+        Encrypt(schedule, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext, tag, tag_length);
+    ClearSecretData(reinterpret_cast<uint8_t *>(&schedule), sizeof(schedule));
+    return err;
+}
+
+CHIP_ERROR AcceleratedAesCcm::Decrypt(const Symmetric128BitsKeyByteArray & key, const uint8_t * ciphertext,
+                                      size_t ciphertext_length, const uint8_t * aad, size_t aad_length, const uint8_t * tag,
+                                      size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext)
+{
+    KeySchedule schedule;
+    ExpandKey(key, schedule);
+    CHIP_ERROR err =
+        Decrypt(schedule, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, nonce_length, plaintext);
+    ClearSecretData(reinterpret_cast<uint8_t *>(&schedule), sizeof(schedule));
+    return err;
+}
+
+} // namespace Crypto
+} // namespace chip
@@ -0,0 +1,89 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the AES-CCM implementation that uses the AES
+ *      instructions of the CPU, enabled by CHIP_CRYPTO_AES_CCM_ACCEL.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Crypto {
+
+/**
+ * AES-128-CCM computed with the AES instructions of the CPU: AES-NI on x86-64 and the ARMv8 cryptography extensions on
+ * AArch64.  Whether the CPU has them is checked at run time, so a build that enables this still runs on CPUs that do not.
+ *
+ * The CBC-MAC of each block is computed together with the key stream of the next one, so that the two AES computations
+ * overlap in the CPU.  Nonces of 7 to 13 bytes and tags of 4 to 16 bytes (of even length) are supported, as are additional
+ * data shorter than 4 GiB and, as with OpenSSL, missing additional data (nullptr) of non-zero length, which is ignored.
+ */
+class AcceleratedAesCcm
+{
+public:
+    /**
+     * The round keys of an AES-128 key, which can be kept to encrypt or decrypt many messages with the key.
+     */
+    using KeySchedule = Aes128RoundKeys;
+
+    static constexpr size_t kNumRoundKeys = KeySchedule::kNumRoundKeys;
+
+    /**
+     * Returns whether the CPU has the instructions needed.  The other methods must not be called if it does not.
+     */
+    static bool IsSupported();
+
+    static void ExpandKey(const Symmetric128BitsKeyByteArray & key, KeySchedule & schedule);
+
+    /**
+     * Same as AES_CCM_encrypt(), with the key given by its round keys.
+     */
+    static CHIP_ERROR Encrypt(const KeySchedule & schedule, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                              size_t aad_length, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                              size_t tag_length);
+
+    /**
+     * Same as AES_CCM_decrypt(), with the key given by its round keys.  The plaintext is cleared if the tag does not match.
+     */
+    static CHIP_ERROR Decrypt(const KeySchedule & schedule, const uint8_t * ciphertext, size_t ciphertext_length,
+                              const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * nonce,
+                              size_t nonce_length, uint8_t * plaintext);
+
+    /**
+     * Same as AES_CCM_encrypt(), for a key given as raw key material, whose round keys are cleared afterwards.
+     */
+    static CHIP_ERROR Encrypt(const Symmetric128BitsKeyByteArray & key, const uint8_t * plaintext, size_t plaintext_length,
+                              const uint8_t * aad, size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                              uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * Same as AES_CCM_decrypt(), for a key given as raw key material, whose round keys are cleared afterwards.
+     */
+    static CHIP_ERROR Decrypt(const Symmetric128BitsKeyByteArray & key, const uint8_t * ciphertext, size_t ciphertext_length,
+                              const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * nonce,
+                              size_t nonce_length, uint8_t * plaintext);
+};
+
+} // namespace Crypto
+} // namespace chip
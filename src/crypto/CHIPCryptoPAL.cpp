@@ -24,6 +24,10 @@
 
 #include "SessionKeystore.h"
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+#include "AcceleratedAesCcm.h"
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
 #include <lib/core/CHIPEncoding.h>
@@ -789,6 +793,75 @@ CHIP_ERROR AES_CTR_crypt(const uint8_t * input, size_t input_length, const Aes12
     return AES_CCM_encrypt(input, input_length, nullptr, 0, key, nonce, nonce_length, output, tag, kTagLen);
 }
 
+#if !CHIP_CRYPTO_OPENSSL && !CHIP_CRYPTO_BORINGSSL
+// Backends without reusable cipher contexts use the key handle for every message, unless the round keys computed for the AES
+// instructions of the CPU can be kept instead.
+CHIP_ERROR Aes128CcmCipher::Init(const Aes128KeyHandle & key)
+{
+    Release();
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        AcceleratedAesCcm::ExpandKey(key.As<Symmetric128BitsKeyByteArray>(), mRoundKeys);
+        mHasRoundKeys = true;
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+    mKey = &key;
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmCipher::Release()
+{
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (mHasRoundKeys)
+    {
+        ClearSecretData(reinterpret_cast<uint8_t *>(&mRoundKeys), sizeof(mRoundKeys));
+        mHasRoundKeys = false;
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+    mKey = nullptr;
+}
+
+CHIP_ERROR Aes128CcmCipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                    size_t tag_length) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    // Unusual lengths are left to the general implementation, which checks them.
+    if (mHasRoundKeys && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AcceleratedAesCcm::Encrypt(mRoundKeys, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length,
+                                          ciphertext, tag, tag_length);
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR Aes128CcmCipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                    uint8_t * plaintext) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (mHasRoundKeys && nonce_length == CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES && tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AcceleratedAesCcm::Decrypt(mRoundKeys, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce,
+                                          nonce_length, plaintext);
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                           plaintext);
+}
+#endif // !CHIP_CRYPTO_OPENSSL && !CHIP_CRYPTO_BORINGSSL
+
 CHIP_ERROR GenerateCompressedFabricId(const Crypto::P256PublicKey & root_public_key, uint64_t fabric_id,
                                       MutableByteSpan & out_compressed_fabric_id)
 {
@@ -907,6 +907,75 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+/**
+ * @brief The round keys of an AES-128 key, as used by the AES instructions of the CPU (see AcceleratedAesCcm.h).
+ */
+struct Aes128RoundKeys
+{
+    static constexpr size_t kNumRoundKeys = 11;
+
+    alignas(16) uint8_t mRoundKeys[kNumRoundKeys][kAES_CCM128_Block_Length];
+};
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+/**
+ * @brief AES-CCM encryption and decryption with a key that is set up once and used for many messages.
+ *
+ * The OpenSSL and BoringSSL backends create and key their cipher contexts in Init() and reuse them for every message with
+ * a nonce of CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES and a tag of CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, instead of creating a
+ * context and expanding the key for each message.  Messages with other lengths, and all messages with the other backends,
+ * go through AES_CCM_encrypt() and AES_CCM_decrypt().
+ *
+ * With CHIP_CRYPTO_AES_CCM_ACCEL, on CPUs with AES instructions, the cipher keeps the round keys of the key instead, and
+ * uses them for the messages with these lengths.
+ *
+ * The key handle must outlive the cipher, or Release() must be called before the key is destroyed.
+ */
+class Aes128CcmCipher
+{
+public:
+    Aes128CcmCipher() = default;
+    ~Aes128CcmCipher() { Release(); }
+
+    Aes128CcmCipher(const Aes128CcmCipher &)             = delete;
+    Aes128CcmCipher & operator=(const Aes128CcmCipher &) = delete;
+
+    /**
+     * @brief Sets up the cipher to use the given key, releasing any previous one.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key);
+
+    /**
+     * @brief Releases the cipher contexts, which clears the copies of the key they hold.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt() with the key of the cipher.
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length) const;
+
+    /**
+     * @brief Same as AES_CCM_decrypt() with the key of the cipher.
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                       uint8_t * plaintext) const;
+
+private:
+    const Aes128KeyHandle * mKey = nullptr;
+    void * mEncryptContext       = nullptr;
+    void * mDecryptContext       = nullptr;
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    Aes128RoundKeys mRoundKeys;
+    bool mHasRoundKeys = false;
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
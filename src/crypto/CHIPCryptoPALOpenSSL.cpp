@@ -23,6 +23,10 @@
 #include "CHIPCryptoPALOpenSSL.h"
 #include "CHIPCryptoPAL.h"
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+#include "AcceleratedAesCcm.h"
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
 #include <type_traits>
 
 #if CHIP_CRYPTO_BORINGSSL
@@ -193,6 +197,15 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
                             error = CHIP_ERROR_INVALID_ARGUMENT);
 #endif // CHIP_CRYPTO_BORINGSSL
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        error = AcceleratedAesCcm::Encrypt(key.As<Symmetric128BitsKeyByteArray>(), plaintext, plaintext_length, aad, aad_length,
+                                           nonce, nonce_length, ciphertext, tag, tag_length);
+        ExitNow();
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
 #if CHIP_CRYPTO_BORINGSSL
     aead = EVP_aead_aes_128_ccm_matter();
 
@@ -325,6 +338,15 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
     VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        error = AcceleratedAesCcm::Decrypt(key.As<Symmetric128BitsKeyByteArray>(), ciphertext, ciphertext_length, aad, aad_length,
+                                           tag, tag_length, nonce, nonce_length, plaintext);
+        ExitNow();
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
 #if CHIP_CRYPTO_BORINGSSL
     aead = EVP_aead_aes_128_ccm_matter();
 
@@ -403,6 +425,227 @@ exit:
     return error;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+// Creates a context for the given direction with the key installed, so that only the nonce needs to be set for each message.
+// The nonce and tag lengths have to be set before the key.
+static EVP_CIPHER_CTX * _newKeyedAesCcmContext(const Aes128KeyHandle & key, int encrypt)
+{
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, encrypt) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES), nullptr) != 1 ||
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES), nullptr) != 1 ||
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, encrypt) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+}
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+CHIP_ERROR Aes128CcmCipher::Init(const Aes128KeyHandle & key)
+{
+    Release();
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        // The round keys serve both directions.
+        AcceleratedAesCcm::ExpandKey(key.As<Symmetric128BitsKeyByteArray>(), mRoundKeys);
+        mHasRoundKeys = true;
+        mKey          = &key;
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+#if CHIP_CRYPTO_BORINGSSL
+    // The same context seals and opens messages.
+    mEncryptContext = EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                                       sizeof(Symmetric128BitsKeyByteArray), CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    VerifyOrReturnError(mEncryptContext != nullptr, CHIP_ERROR_NO_MEMORY);
+    mDecryptContext = mEncryptContext;
+#else
+    mEncryptContext = _newKeyedAesCcmContext(key, 1);
+    mDecryptContext = _newKeyedAesCcmContext(key, 0);
+    if (mEncryptContext == nullptr || mDecryptContext == nullptr)
+    {
+        Release();
+        return CHIP_ERROR_NO_MEMORY;
+    }
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    mKey = &key;
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmCipher::Release()
+{
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (mHasRoundKeys)
+    {
+        ClearSecretData(reinterpret_cast<uint8_t *>(&mRoundKeys), sizeof(mRoundKeys));
+        mHasRoundKeys = false;
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(static_cast<EVP_AEAD_CTX *>(mEncryptContext));
+#else
+    // Freeing the contexts clears the key schedules they hold.
+    EVP_CIPHER_CTX_free(static_cast<EVP_CIPHER_CTX *>(mEncryptContext));
+    EVP_CIPHER_CTX_free(static_cast<EVP_CIPHER_CTX *>(mDecryptContext));
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    mEncryptContext = nullptr;
+    mDecryptContext = nullptr;
+    mKey            = nullptr;
+}
+
+CHIP_ERROR Aes128CcmCipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                    size_t tag_length) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty messages and unusual lengths are left to the general implementation.
+    if (plaintext_length == 0 || nonce_length != CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES ||
+        tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (mHasRoundKeys)
+    {
+        return AcceleratedAesCcm::Encrypt(mRoundKeys, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length,
+                                          ciphertext, tag, tag_length);
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+#if CHIP_CRYPTO_BORINGSSL
+    size_t written_tag_len = 0;
+    int result = EVP_AEAD_CTX_seal_scatter(static_cast<EVP_AEAD_CTX *>(mEncryptContext), ciphertext, tag, &written_tag_len,
+                                           tag_length, nonce, nonce_length, plaintext, plaintext_length, nullptr, 0, aad,
+                                           aad_length);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
+#else
+    auto * context   = static_cast<EVP_CIPHER_CTX *>(mEncryptContext);
+    int bytesWritten = 0;
+
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Pass in nonce, the key is already installed
+    VerifyOrReturnError(EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in plain text length
+    VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in AAD
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(
+            EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length)) == 1,
+            CHIP_ERROR_INTERNAL);
+    }
+
+    // Encrypt
+    VerifyOrReturnError(EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                                          static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
+
+    // Finalize encryption
+    VerifyOrReturnError(EVP_EncryptFinal_ex(context, ciphertext + plaintext_length, &bytesWritten) == 1, CHIP_ERROR_INTERNAL);
+
+    // Get tag
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Aes128CcmCipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                    uint8_t * plaintext) const
+{
+    VerifyOrReturnError(mKey != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Empty messages and unusual lengths are left to the general implementation.
+    if (ciphertext_length == 0 || nonce_length != CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES ||
+        tag_length != CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES)
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (mHasRoundKeys)
+    {
+        return AcceleratedAesCcm::Decrypt(mRoundKeys, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce,
+                                          nonce_length, plaintext);
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
+#if CHIP_CRYPTO_BORINGSSL
+    int result = EVP_AEAD_CTX_open_gather(static_cast<EVP_AEAD_CTX *>(mDecryptContext), plaintext, nonce, nonce_length, ciphertext,
+                                          ciphertext_length, tag, tag_length, aad, aad_length);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+#else
+    auto * context  = static_cast<EVP_CIPHER_CTX *>(mDecryptContext);
+    int bytesOutput = 0;
+
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Pass in expected tag, which the context forgets after every message
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                            const_cast<void *>(static_cast<const void *>(tag))) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in nonce, the key is already installed
+    VerifyOrReturnError(EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in cipher text length
+    VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    // Pass in aad
+    if (aad_length > 0 && aad != nullptr)
+    {
+        VerifyOrReturnError(
+            EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length)) == 1,
+            CHIP_ERROR_INTERNAL);
+    }
+
+    // Pass in ciphertext. We wont get anything if validation fails.
+    VerifyOrReturnError(EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                                          static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -23,6 +23,10 @@
 #include "CHIPCryptoPALmbedTLS.h"
 #include "CHIPCryptoPAL.h"
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+#include "AcceleratedAesCcm.h"
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
 #include <type_traits>
 
 #include <mbedtls/bignum.h>
@@ -94,6 +98,15 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
         VerifyOrExit(aad != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     }
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        error = AcceleratedAesCcm::Encrypt(key.As<Symmetric128BitsKeyByteArray>(), plaintext, plaintext_length, aad, aad_length,
+                                           nonce, nonce_length, ciphertext, tag, tag_length);
+        ExitNow();
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
     // Size of key is expressed in bits, hence the multiplication by 8.
     result = mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
                                 sizeof(Symmetric128BitsKeyByteArray) * 8);
@@ -132,6 +145,15 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_len, co
         VerifyOrExit(aad != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
     }
 
+#if CHIP_CRYPTO_AES_CCM_ACCEL
+    if (AcceleratedAesCcm::IsSupported())
+    {
+        error = AcceleratedAesCcm::Decrypt(key.As<Symmetric128BitsKeyByteArray>(), ciphertext, ciphertext_len, aad, aad_len, tag,
+                                           tag_length, nonce, nonce_length, plaintext);
+        ExitNow();
+    }
+#endif // CHIP_CRYPTO_AES_CCM_ACCEL
+
     // Size of key is expressed in bits, hence the multiplication by 8.
     result = mbedtls_ccm_setkey(&context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
                                 sizeof(Symmetric128BitsKeyByteArray) * 8);
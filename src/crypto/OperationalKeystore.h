@@ -194,7 +194,12 @@ public:
      * If true, `CASESession` may attempt to perform `SignWithOpKeypair` in the
      * background. In this case, `OperationalKeystore` should protect itself,
      * e.g. with a mutex, as the signing could occur at any time during session
-     * establishment.
+     * establishment. On platforms with several background tasks (see
+     * CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE), `SignWithOpKeypair` may also be
+     * called concurrently from several of them, for different sessions.
+     *
+     * The keypairs from `AllocateEphemeralKeypairForCASE` are then also generated
+     * and used in the background, and may be released there.
      *
      * @retval true if `SignWithOpKeypair` may be performed in the background
      * @retval false if `SignWithOpKeypair` may NOT be performed in the background
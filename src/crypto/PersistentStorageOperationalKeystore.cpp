@@ -240,6 +240,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::ActivateOpKeypairForFabric(Fabr
     // Validate public key being activated matches last generated pending keypair
     VerifyOrReturnError(mPendingKeypair->Pubkey().Matches(nocPublicKey), CHIP_ERROR_INVALID_PUBLIC_KEY);
 
+    std::lock_guard<System::Mutex> lock(mPendingKeyLock);
     mIsPendingKeypairActive = true;
 
     return CHIP_NO_ERROR;
@@ -302,16 +303,26 @@ CHIP_ERROR PersistentStorageOperationalKeystore::SignWithOpKeypair(FabricIndex f
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
-    if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
     {
-        VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
-        // We have an override key: sign with it!
-        return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        // Keep the pending keypair from being released while signing with it in the background.
+        std::lock_guard<System::Mutex> lock(mPendingKeyLock);
+        if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
+        {
+            VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
+            // We have an override key: sign with it!
+            return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        }
     }
 
+    // Signatures with the stored keypair only read the storage, so they can run concurrently.
     return SignWithStoredOpKey(fabricIndex, mStorage, message, outSignature);
 }
 
+bool PersistentStorageOperationalKeystore::SupportsSignWithOpKeypairInBackground() const
+{
+    return true;
+}
+
 Crypto::P256Keypair * PersistentStorageOperationalKeystore::AllocateEphemeralKeypairForCASE()
 {
     // DO NOT CUT AND PASTE without considering the ReleaseEphemeralKeypair().
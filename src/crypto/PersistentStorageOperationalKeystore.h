@@ -23,6 +23,10 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <system/SystemMutex.h>
+
+#include <mutex>
+
 #if CHIP_OP_KEYSTORE_ELE
 #include "EleManagerImpl.h"
 #endif
@@ -38,6 +42,11 @@ namespace chip {
  * WARNING: Ensure that any implementation that uses this one as a starting point
  *          DOES NOT have the raw key material (in usable form) passed up/down to
  *          direct storage APIs that may make copies on heap/stack without sanitization.
+ *
+ * `SignWithOpKeypair` may be called from background tasks (see `SupportsSignWithOpKeypairInBackground`):
+ * the pending keypair is then guarded by a lock, and the stored keypair is read from the
+ * storage delegate there, so that delegate must allow reads from other threads while the
+ * CHIP thread writes to it, as the KVS-backed delegate does.
  */
 class PersistentStorageOperationalKeystore : public Crypto::OperationalKeystore
 {
@@ -59,6 +68,11 @@ public:
     CHIP_ERROR Init(PersistentStorageDelegate * storage)
     {
         VerifyOrReturnError(mStorage == nullptr, CHIP_ERROR_INCORRECT_STATE);
+        if (!mIsPendingKeyLockInitialized)
+        {
+            ReturnErrorOnFailure(System::Mutex::Init(mPendingKeyLock));
+            mIsPendingKeyLockInitialized = true;
+        }
         mPendingFabricIndex       = kUndefinedFabricIndex;
         mIsExternallyOwnedKeypair = false;
         mStorage                  = storage;
@@ -89,6 +103,7 @@ public:
     void RevertPendingKeypair() override;
     CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                  Crypto::P256ECDSASignature & outSignature) const override;
+    bool SupportsSignWithOpKeypairInBackground() const override;
     Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override;
     void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override;
     CHIP_ERROR MigrateOpKeypairForFabric(FabricIndex fabricIndex, OperationalKeystore & operationalKeystore) const override;
@@ -96,6 +111,9 @@ public:
 protected:
     void ResetPendingKey()
     {
+        // A signature in the background may be using the pending keypair.
+        std::lock_guard<System::Mutex> lock(mPendingKeyLock);
+
         if (!mIsExternallyOwnedKeypair && (mPendingKeypair != nullptr))
         {
             Platform::Delete(mPendingKeypair);
@@ -117,6 +135,10 @@ protected:
     // `NewOpKeypairForFabric` if the mPendingKeypair should not be deleted when no longer in use.
     bool mIsExternallyOwnedKeypair = false;
 
+    // Held while the pending keypair is made active, used to sign, or released.
+    mutable System::Mutex mPendingKeyLock;
+    bool mIsPendingKeyLockInitialized = false;
+
 #if CHIP_OP_KEYSTORE_ELE
 private:
     std::shared_ptr<Credentials::ele::EleManagerKeystore> mEleManager = Credentials::ele::EleManagerKeystore::getInstance();
@@ -207,6 +207,11 @@ CHIP_ERROR PersistentStorageOperationalKeystore::SignWithOpKeypair(FabricIndex f
     return CHIP_NO_ERROR;
 }
 
+bool PersistentStorageOperationalKeystore::SupportsSignWithOpKeypairInBackground() const
+{
+    return false;
+}
+
 Crypto::P256Keypair * PersistentStorageOperationalKeystore::AllocateEphemeralKeypairForCASE()
 {
     return Platform::New<Crypto::P256Keypair>();
@@ -0,0 +1,274 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for AcceleratedAesCcm, comparing it
+ *      with the AES-CCM of the crypto backend.
+ */
+
+#include "AES_CCM_128_test_vectors.h"
+
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/AcceleratedAesCcm.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr uint8_t kKey[] = { 0x5e, 0xde, 0xd2, 0x44, 0xe0, 0x42, 0x47, 0x59, 0x9f, 0x3a, 0x87, 0x0e, 0x24, 0xa9, 0x2f, 0x2d };
+
+struct TestAcceleratedAesCcm : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        if (!AcceleratedAesCcm::IsSupported())
+        {
+            GTEST_SKIP() << "Skipping test: the CPU has no AES instructions";
+        }
+    }
+};
+
+TEST_F(TestAcceleratedAesCcm, TestVectors)
+{
+    int numOfTestsRan = 0;
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        Symmetric128BitsKeyByteArray key;
+        ASSERT_EQ(vector->key_len, sizeof(key));
+        memcpy(key, vector->key, sizeof(key));
+        numOfTestsRan++;
+
+        uint8_t ciphertext[64];
+        uint8_t plaintext[64];
+        uint8_t tag[kAES_CCM128_Tag_Length];
+        ASSERT_LE(vector->pt_len, sizeof(plaintext));
+
+        EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                             vector->nonce_len, ciphertext, tag, vector->tag_len),
+                  vector->result)
+            << "Test " << vector->tcId;
+        EXPECT_EQ(AcceleratedAesCcm::Decrypt(key, vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                             vector->tag_len, vector->nonce, vector->nonce_len, plaintext),
+                  vector->result)
+            << "Test " << vector->tcId;
+
+        if (vector->result == CHIP_NO_ERROR)
+        {
+            EXPECT_EQ(memcmp(ciphertext, vector->ct, vector->ct_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(memcmp(tag, vector->tag, vector->tag_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(memcmp(plaintext, vector->pt, vector->pt_len), 0) << "Test " << vector->tcId;
+
+            // In place
+            memcpy(ciphertext, vector->pt, vector->pt_len);
+            EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, ciphertext, vector->pt_len, vector->aad, vector->aad_len, vector->nonce,
+                                                 vector->nonce_len, ciphertext, tag, vector->tag_len),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(ciphertext, vector->ct, vector->ct_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(AcceleratedAesCcm::Decrypt(key, ciphertext, vector->ct_len, vector->aad, vector->aad_len, vector->tag,
+                                                 vector->tag_len, vector->nonce, vector->nonce_len, ciphertext),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(ciphertext, vector->pt, vector->pt_len), 0) << "Test " << vector->tcId;
+
+            // A wrong tag is rejected and the plaintext cleared.
+            uint8_t badTag[kAES_CCM128_Tag_Length];
+            memcpy(badTag, vector->tag, vector->tag_len);
+            badTag[vector->tag_len - 1] ^= 0x80;
+            EXPECT_EQ(AcceleratedAesCcm::Decrypt(key, vector->ct, vector->ct_len, vector->aad, vector->aad_len, badTag,
+                                                 vector->tag_len, vector->nonce, vector->nonce_len, plaintext),
+                      CHIP_ERROR_INTERNAL);
+            for (size_t i = 0; i < vector->pt_len; i++)
+            {
+                EXPECT_EQ(plaintext[i], 0);
+            }
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+// Compares with the backend for all the nonce and tag lengths the backends support, messages that end in the middle of a
+// block or not, and additional data long enough to have its length encoded on 6 bytes.
+TEST_F(TestAcceleratedAesCcm, TestSameAsBackend)
+{
+    constexpr size_t kNonceLengths[]   = { 8, 12, 13 };
+    constexpr size_t kTagLengths[]     = { 8, 12, 16 };
+    constexpr size_t kMessageLengths[] = { 0, 1, 15, 16, 17, 32, 100, 1280 };
+    constexpr size_t kAadLengths[]     = { 0, 1, 14, 16, 30, 0xFEFF, 0xFF00 };
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle keyHandle;
+    Symmetric128BitsKeyByteArray key;
+    memcpy(key, kKey, sizeof(key));
+    ASSERT_EQ(keystore.CreateKey(key, keyHandle), CHIP_NO_ERROR);
+
+    AcceleratedAesCcm::KeySchedule schedule;
+    AcceleratedAesCcm::ExpandKey(key, schedule);
+
+    Platform::ScopedMemoryBuffer<uint8_t> aad;
+    Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    Platform::ScopedMemoryBuffer<uint8_t> expectedCiphertext;
+    ASSERT_TRUE(aad.Alloc(0xFF00));
+    ASSERT_TRUE(plaintext.Alloc(1280));
+    ASSERT_TRUE(ciphertext.Alloc(1280));
+    ASSERT_TRUE(expectedCiphertext.Alloc(1280));
+    for (size_t i = 0; i < 0xFF00; i++)
+    {
+        aad[i] = static_cast<uint8_t>(i * 7);
+    }
+    for (size_t i = 0; i < 1280; i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+
+    const uint8_t nonce[13] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    for (size_t nonceLength : kNonceLengths)
+    {
+        for (size_t tagLength : kTagLengths)
+        {
+            for (size_t messageLength : kMessageLengths)
+            {
+                for (size_t aadLength : kAadLengths)
+                {
+                    uint8_t tag[kAES_CCM128_Tag_Length];
+                    uint8_t expectedTag[kAES_CCM128_Tag_Length];
+                    uint8_t * out         = messageLength > 0 ? ciphertext.Get() : nullptr;
+                    uint8_t * expectedOut = messageLength > 0 ? expectedCiphertext.Get() : nullptr;
+
+                    ASSERT_EQ(AES_CCM_encrypt(plaintext.Get(), messageLength, aad.Get(), aadLength, keyHandle, nonce, nonceLength,
+                                              expectedOut, expectedTag, tagLength),
+                              CHIP_NO_ERROR);
+                    ASSERT_EQ(AcceleratedAesCcm::Encrypt(schedule, plaintext.Get(), messageLength, aad.Get(), aadLength, nonce,
+                                                         nonceLength, out, tag, tagLength),
+                              CHIP_NO_ERROR);
+                    EXPECT_EQ(memcmp(ciphertext.Get(), expectedCiphertext.Get(), messageLength), 0)
+                        << nonceLength << " " << tagLength << " " << messageLength << " " << aadLength;
+                    EXPECT_EQ(memcmp(tag, expectedTag, tagLength), 0)
+                        << nonceLength << " " << tagLength << " " << messageLength << " " << aadLength;
+
+                    ASSERT_EQ(AcceleratedAesCcm::Decrypt(schedule, out, messageLength, aad.Get(), aadLength, tag, tagLength, nonce,
+                                                         nonceLength, out),
+                              CHIP_NO_ERROR);
+                    EXPECT_EQ(memcmp(ciphertext.Get(), plaintext.Get(), messageLength), 0);
+                }
+            }
+        }
+    }
+
+    keystore.DestroyKey(keyHandle);
+}
+
+TEST_F(TestAcceleratedAesCcm, TestInvalidParameters)
+{
+    Symmetric128BitsKeyByteArray key;
+    memcpy(key, kKey, sizeof(key));
+    const uint8_t nonce[14] = {};
+    uint8_t data[16]        = {};
+    uint8_t tag[16]         = {};
+
+    // Nonce of 6 or 14 bytes
+    EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, data, sizeof(data), nullptr, 0, nonce, 6, data, tag, 16),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, data, sizeof(data), nullptr, 0, nonce, 14, data, tag, 16),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    // Odd or too long tag
+    EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, data, sizeof(data), nullptr, 0, nonce, 13, data, tag, 15),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(AcceleratedAesCcm::Decrypt(key, data, sizeof(data), nullptr, 0, tag, 18, nonce, 13, data),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    // With a 13-byte nonce, the length of the message is encoded on 2 bytes.
+    EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, data, 0x10000, nullptr, 0, nonce, 13, data, tag, 16), CHIP_ERROR_INVALID_ARGUMENT);
+    // Missing buffers
+    EXPECT_EQ(AcceleratedAesCcm::Encrypt(key, nullptr, sizeof(data), nullptr, 0, nonce, 13, data, tag, 16),
+              CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(AcceleratedAesCcm::Decrypt(key, data, sizeof(data), nullptr, 0, nullptr, 16, nonce, 13, data),
+              CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+// A key schedule expanded once is reused for messages of typical sizes, and must give the same results as expanding the key
+// for each message.
+TEST_F(TestAcceleratedAesCcm, TestKeyScheduleReuse)
+{
+    constexpr size_t kPayloadSizes[] = { 64, 128, 256, 512, 1024, 1280 };
+    constexpr size_t kMaxPayloadSize = kPayloadSizes[MATTER_ARRAY_SIZE(kPayloadSizes) - 1];
+    constexpr uint8_t kAad[]         = { 0x00, 0x08, 0x3b, 0x5a, 0x12, 0x00, 0x00, 0x00 };
+
+    Symmetric128BitsKeyByteArray key;
+    memcpy(key, kKey, sizeof(key));
+
+    AcceleratedAesCcm::KeySchedule schedule;
+    AcceleratedAesCcm::ExpandKey(key, schedule);
+
+    Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    Platform::ScopedMemoryBuffer<uint8_t> expectedCiphertext;
+    Platform::ScopedMemoryBuffer<uint8_t> decrypted;
+    ASSERT_TRUE(plaintext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(ciphertext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(expectedCiphertext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(decrypted.Alloc(kMaxPayloadSize));
+    for (size_t i = 0; i < kMaxPayloadSize; i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+
+    uint32_t counter = 0;
+    for (size_t size : kPayloadSizes)
+    {
+        uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES] = {};
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t expectedTag[sizeof(tag)];
+        counter++;
+        memcpy(&nonce[1], &counter, sizeof(counter));
+
+        ASSERT_EQ(AcceleratedAesCcm::Encrypt(key, plaintext.Get(), size, kAad, sizeof(kAad), nonce, sizeof(nonce),
+                                             expectedCiphertext.Get(), expectedTag, sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(AcceleratedAesCcm::Encrypt(schedule, plaintext.Get(), size, kAad, sizeof(kAad), nonce, sizeof(nonce),
+                                             ciphertext.Get(), tag, sizeof(tag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertext.Get(), expectedCiphertext.Get(), size), 0) << "Size " << size;
+        EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0) << "Size " << size;
+
+        ASSERT_EQ(AcceleratedAesCcm::Decrypt(key, ciphertext.Get(), size, kAad, sizeof(kAad), tag, sizeof(tag), nonce,
+                                             sizeof(nonce), decrypted.Get()),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted.Get(), plaintext.Get(), size), 0) << "Size " << size;
+        ASSERT_EQ(AcceleratedAesCcm::Decrypt(schedule, ciphertext.Get(), size, kAad, sizeof(kAad), tag, sizeof(tag), nonce,
+                                             sizeof(nonce), decrypted.Get()),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted.Get(), plaintext.Get(), size), 0) << "Size " << size;
+    }
+
+    ClearSecretData(reinterpret_cast<uint8_t *>(&schedule), sizeof(schedule));
+}
+
+} // namespace
@@ -0,0 +1,249 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for Aes128CcmCipher, comparing it
+ *      with AES_CCM_encrypt() and AES_CCM_decrypt().
+ */
+
+#include "AES_CCM_128_test_vectors.h"
+
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+struct TestAesKey
+{
+    TestAesKey(const uint8_t * keyBytes, size_t keyLength)
+    {
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(&keyMaterial, keyBytes, keyLength);
+        EXPECT_EQ(keystore.CreateKey(keyMaterial, key), CHIP_NO_ERROR);
+    }
+
+    ~TestAesKey() { keystore.DestroyKey(key); }
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+};
+
+constexpr uint8_t kKey[] = { 0x5e, 0xde, 0xd2, 0x44, 0xe0, 0x42, 0x47, 0x59, 0x9f, 0x3a, 0x87, 0x0e, 0x24, 0xa9, 0x2f, 0x2d };
+constexpr uint8_t kAad[] = { 0x00, 0x08, 0x3b, 0x5a, 0x12, 0x00, 0x00, 0x00 };
+
+void MakeNonce(uint8_t (&nonce)[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES], uint32_t counter)
+{
+    memset(nonce, 0, sizeof(nonce));
+    memcpy(&nonce[1], &counter, sizeof(counter));
+}
+
+struct TestAesCcmCipher : public ::testing::Test
+{
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+
+#if CHIP_CRYPTO_PSA
+        psa_crypto_init();
+#endif
+    }
+
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestAesCcmCipher, TestNotInitialized)
+{
+    Aes128CcmCipher cipher;
+    uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+    uint8_t data[16] = {};
+    uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+    MakeNonce(nonce, 1);
+
+    EXPECT_FALSE(cipher.IsInitialized());
+    EXPECT_EQ(cipher.Encrypt(data, sizeof(data), kAad, sizeof(kAad), nonce, sizeof(nonce), data, tag, sizeof(tag)),
+              CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(cipher.Decrypt(data, sizeof(data), kAad, sizeof(kAad), tag, sizeof(tag), nonce, sizeof(nonce), data),
+              CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestAesCcmCipher, TestVectors)
+{
+    int numOfTestsRan = 0;
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        TestAesKey key(vector->key, vector->key_len);
+        Aes128CcmCipher cipher;
+        ASSERT_EQ(cipher.Init(key.key), CHIP_NO_ERROR);
+        numOfTestsRan++;
+
+        // For a plaintext with length = 0, the output buffer must be a nullptr (for OpenSSL)
+        Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+        Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+        uint8_t * out_ct_ptr = nullptr;
+        uint8_t * out_pt_ptr = nullptr;
+        if (vector->ct_len > 0)
+        {
+            ASSERT_TRUE(out_ct.Alloc(vector->ct_len));
+            ASSERT_TRUE(out_pt.Alloc(vector->pt_len));
+            out_ct_ptr = out_ct.Get();
+            out_pt_ptr = out_pt.Get();
+        }
+
+        Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+        ASSERT_TRUE(out_tag.Alloc(vector->tag_len));
+
+        EXPECT_EQ(cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                 out_ct_ptr, out_tag.Get(), vector->tag_len),
+                  vector->result)
+            << "Test " << vector->tcId;
+        EXPECT_EQ(cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                 vector->nonce, vector->nonce_len, out_pt_ptr),
+                  vector->result)
+            << "Test " << vector->tcId;
+
+        if (vector->result == CHIP_NO_ERROR)
+        {
+            EXPECT_EQ(memcmp(out_ct_ptr, vector->ct, vector->ct_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(memcmp(out_pt_ptr, vector->pt, vector->pt_len), 0) << "Test " << vector->tcId;
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+// The cipher is used for many messages in a row, some of which fail to decrypt, and must give the same results as
+// AES_CCM_encrypt() and AES_CCM_decrypt() for each.
+TEST_F(TestAesCcmCipher, TestReuse)
+{
+    TestAesKey key(kKey, sizeof(kKey));
+    Aes128CcmCipher cipher;
+    ASSERT_EQ(cipher.Init(key.key), CHIP_NO_ERROR);
+    EXPECT_TRUE(cipher.IsInitialized());
+
+    for (uint32_t counter = 0; counter < 32; counter++)
+    {
+        uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+        uint8_t plaintext[100];
+        uint8_t ciphertext[sizeof(plaintext)];
+        uint8_t expectedCiphertext[sizeof(plaintext)];
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t expectedTag[sizeof(tag)];
+        uint8_t decrypted[sizeof(plaintext)];
+        const size_t length = 1 + counter * 3;
+
+        MakeNonce(nonce, counter);
+        memset(plaintext, static_cast<int>(counter), sizeof(plaintext));
+
+        ASSERT_EQ(AES_CCM_encrypt(plaintext, length, kAad, sizeof(kAad), key.key, nonce, sizeof(nonce), expectedCiphertext,
+                                  expectedTag, sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(cipher.Encrypt(plaintext, length, kAad, sizeof(kAad), nonce, sizeof(nonce), ciphertext, tag, sizeof(tag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertext, expectedCiphertext, length), 0);
+        EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0);
+
+        if (counter % 2)
+        {
+            // A message that fails authentication must not affect the next ones.
+            tag[0] ^= 1;
+            EXPECT_NE(cipher.Decrypt(ciphertext, length, kAad, sizeof(kAad), tag, sizeof(tag), nonce, sizeof(nonce), decrypted),
+                      CHIP_NO_ERROR);
+            tag[0] ^= 1;
+        }
+
+        ASSERT_EQ(cipher.Decrypt(ciphertext, length, kAad, sizeof(kAad), tag, sizeof(tag), nonce, sizeof(nonce), decrypted),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, length), 0);
+    }
+
+    cipher.Release();
+    EXPECT_FALSE(cipher.IsInitialized());
+}
+
+// Messages of typical sizes, up to the largest that fits in an IPv6 MTU, span many AES blocks and must give the same results
+// as AES_CCM_encrypt() and AES_CCM_decrypt().
+TEST_F(TestAesCcmCipher, TestMessageSizes)
+{
+    constexpr size_t kPayloadSizes[] = { 64, 128, 256, 512, 1024, 1280 };
+    constexpr size_t kMaxPayloadSize = kPayloadSizes[MATTER_ARRAY_SIZE(kPayloadSizes) - 1];
+
+    TestAesKey key(kKey, sizeof(kKey));
+    Aes128CcmCipher cipher;
+    ASSERT_EQ(cipher.Init(key.key), CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    Platform::ScopedMemoryBuffer<uint8_t> expectedCiphertext;
+    Platform::ScopedMemoryBuffer<uint8_t> decrypted;
+    ASSERT_TRUE(plaintext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(ciphertext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(expectedCiphertext.Alloc(kMaxPayloadSize));
+    ASSERT_TRUE(decrypted.Alloc(kMaxPayloadSize));
+    for (size_t i = 0; i < kMaxPayloadSize; i++)
+    {
+        plaintext[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    uint32_t counter = 0;
+    for (size_t size : kPayloadSizes)
+    {
+        uint8_t nonce[CHIP_CRYPTO_AEAD_NONCE_LENGTH_BYTES];
+        uint8_t tag[CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES];
+        uint8_t expectedTag[sizeof(tag)];
+        MakeNonce(nonce, counter++);
+
+        ASSERT_EQ(AES_CCM_encrypt(plaintext.Get(), size, kAad, sizeof(kAad), key.key, nonce, sizeof(nonce),
+                                  expectedCiphertext.Get(), expectedTag, sizeof(expectedTag)),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(cipher.Encrypt(plaintext.Get(), size, kAad, sizeof(kAad), nonce, sizeof(nonce), ciphertext.Get(), tag,
+                                 sizeof(tag)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertext.Get(), expectedCiphertext.Get(), size), 0) << "Size " << size;
+        EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0) << "Size " << size;
+
+        ASSERT_EQ(cipher.Decrypt(ciphertext.Get(), size, kAad, sizeof(kAad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                 decrypted.Get()),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted.Get(), plaintext.Get(), size), 0) << "Size " << size;
+
+        // Corrupting the last block must fail authentication.
+        ciphertext[size - 1] ^= 1;
+        EXPECT_NE(cipher.Decrypt(ciphertext.Get(), size, kAad, sizeof(kAad), tag, sizeof(tag), nonce, sizeof(nonce),
+                                 decrypted.Get()),
+                  CHIP_NO_ERROR)
+            << "Size " << size;
+    }
+}
+
+} // namespace
@@ -168,6 +168,9 @@ TEST_F(TestPersistentStorageOpKeyStore, TestBasicLifeCycle)
     err = opKeystore.Init(&storageDelegate);
     EXPECT_EQ(err, CHIP_NO_ERROR);
 
+    // Signatures may be made by background tasks
+    EXPECT_TRUE(opKeystore.SupportsSignWithOpKeypairInBackground());
+
     // Can generate a key and get a CSR
     uint8_t csrBuf[kMIN_CSR_Buffer_Size];
     MutableByteSpan csrSpan{ csrBuf };
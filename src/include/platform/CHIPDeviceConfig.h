@@ -127,6 +127,17 @@
 #define CHIP_DEVICE_CONFIG_BG_TASK_PRIORITY 1
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE
+ *
+ * The number of background tasks, on platforms that can run several of them (POSIX).
+ * Background work, such as the cryptography of CASE session establishment, is then
+ * processed by up to this many tasks in parallel.
+ */
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE
+#define CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE 1
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
  *
@@ -170,10 +170,48 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     * Starts a batch of writes. Until the matching CommitBatch(), the KVS may
+     * defer making the entries added, updated or removed durable, so that they
+     * are all made durable at once.
+     *
+     * Batches may be nested, in which case the entries are made durable by
+     * the outermost CommitBatch(). Platforms that do not support batching make
+     * every write durable as soon as it is done.
+     *
+     * @return CHIP_NO_ERROR the batch was started
+     *         CHIP_ERROR_UNINITIALIZED the KVS is not initialized
+     */
+    CHIP_ERROR BeginBatch();
+
+    /**
+     * @brief
+     * Ends a batch of writes started by BeginBatch().
+     *
+     * @return CHIP_NO_ERROR the entries written during the batch are durable
+     *         CHIP_ERROR_INCORRECT_STATE no batch was started
+     *         CHIP_ERROR_PERSISTED_STORAGE_FAILED failed to write the entries.
+     */
+    CHIP_ERROR CommitBatch();
+
+    /**
+     * @brief
+     * Ends a batch of writes started by BeginBatch() without making the entries
+     * written during the batch durable. They are not rolled back, and are made
+     * durable by the next write or batch committed.
+     */
+    void AbortBatch();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
 protected:
+    // Default implementation of batching, for platforms where every write is durable on its own.
+    CHIP_ERROR _BeginBatch() { return CHIP_NO_ERROR; }
+    CHIP_ERROR _CommitBatch() { return CHIP_NO_ERROR; }
+    void _AbortBatch() {}
+
     // Construction/destruction limited to subclasses.
     KeyValueStoreManager()  = default;
     ~KeyValueStoreManager() = default;
@@ -233,6 +271,21 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline CHIP_ERROR KeyValueStoreManager::BeginBatch()
+{
+    return static_cast<ImplClass *>(this)->_BeginBatch();
+}
+
+inline CHIP_ERROR KeyValueStoreManager::CommitBatch()
+{
+    return static_cast<ImplClass *>(this)->_CommitBatch();
+}
+
+inline void KeyValueStoreManager::AbortBatch()
+{
+    static_cast<ImplClass *>(this)->_AbortBatch();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -103,6 +103,26 @@ public:
         return mKvsManager->Delete(key);
     }
 
+    CHIP_ERROR BeginBatch() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->BeginBatch();
+    }
+
+    CHIP_ERROR CommitBatch() override
+    {
+        VerifyOrReturnError(mKvsManager != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        return mKvsManager->CommitBatch();
+    }
+
+    void AbortBatch() override
+    {
+        if (mKvsManager != nullptr)
+        {
+            mKvsManager->AbortBatch();
+        }
+    }
+
 protected:
     DeviceLayer::PersistedStorage::KeyValueStoreManager * mKvsManager = nullptr;
 };
@@ -38,6 +38,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemPacketBufferCache.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -66,6 +67,10 @@ CHIP_ERROR GenericPlatformManagerImpl<ImplClass>::_InitChipStack()
     }
     SuccessOrExit(err);
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+    System::PacketBufferCache::Init();
+#endif
+
     // Initialize the CHIP system layer.
     err = SystemLayer().Init();
     if (err != CHIP_NO_ERROR)
@@ -175,6 +180,11 @@ void GenericPlatformManagerImpl<ImplClass>::_Shutdown()
 
     ChipLogProgress(DeviceLayer, "System Layer shutdown");
     SystemLayer().Shutdown();
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+    // Return the cached packet buffers of every thread to the heap before it is shut down.
+    System::PacketBufferCache::Shutdown();
+#endif
 }
 
 template <class ImplClass>
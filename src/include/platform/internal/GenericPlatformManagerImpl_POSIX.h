@@ -91,6 +91,10 @@ protected:
     CHIP_ERROR _StartEventLoopTask();
     CHIP_ERROR _StopEventLoopTask();
     CHIP_ERROR _StartChipTimer(System::Clock::Timeout duration);
+    CHIP_ERROR _PostBackgroundEvent(const ChipDeviceEvent * event);
+    void _RunBackgroundEventLoop();
+    CHIP_ERROR _StartBackgroundEventLoopTask();
+    CHIP_ERROR _StopBackgroundEventLoopTask();
     void _Shutdown();
 
 #if CHIP_STACK_LOCK_TRACKING_ENABLED
@@ -113,6 +117,19 @@ private:
     static void * EventLoopTaskMain(void * arg);
 #endif
     void ProcessDeviceEvents();
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Background events are handled by a pool of CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE threads, so that work such
+    // as the cryptography of several CASE sessions can run in parallel.  All of the members below are protected by
+    // mBackgroundEventLock.
+    pthread_mutex_t mBackgroundEventLock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mBackgroundEventCond  = PTHREAD_COND_INITIALIZER;
+    std::queue<ChipDeviceEvent> mBackgroundEventQueue;
+    pthread_t mBackgroundEventLoopTasks[CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE];
+    size_t mNumBackgroundEventLoopTasks = 0;
+    bool mShouldRunBackgroundEventLoop  = false;
+    static void * BackgroundEventLoopTaskMain(void * arg);
+#endif
 };
 
 // Instruct the compiler to instantiate the template only when explicitly told to do so.
@@ -384,6 +384,165 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    if (!(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp))
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    if (!mShouldRunBackgroundEventLoop)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        // Use foreground event loop for background events while the background tasks are not running, including while
+        // they are being stopped, so that no event is left in a queue that nothing will process.
+        return _PostEvent(event);
+    }
+    if (mBackgroundEventQueue.size() >= CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        ChipLogError(DeviceLayer, "Failed to post event to CHIP background event queue");
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    mBackgroundEventQueue.push(*event);
+    pthread_cond_signal(&mBackgroundEventCond);
+    pthread_mutex_unlock(&mBackgroundEventLock);
+    return CHIP_NO_ERROR;
+#else
+    // Use foreground event loop for background events
+    return _PostEvent(event);
+#endif
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    pthread_mutex_lock(&mBackgroundEventLock);
+    while (true)
+    {
+        // Events posted before the loop was asked to stop are still processed, so that the work they carry is
+        // never lost.
+        while (mBackgroundEventQueue.empty() && mShouldRunBackgroundEventLoop)
+        {
+            pthread_cond_wait(&mBackgroundEventCond, &mBackgroundEventLock);
+        }
+        if (mBackgroundEventQueue.empty())
+        {
+            break;
+        }
+
+        ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+        pthread_mutex_unlock(&mBackgroundEventLock);
+
+        Impl()->DispatchEvent(&event);
+
+        pthread_mutex_lock(&mBackgroundEventLock);
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+#else
+    // Use foreground event loop for background events
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    int err = 0;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    if (mNumBackgroundEventLoopTasks != 0)
+    {
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    mShouldRunBackgroundEventLoop = true;
+    while (mNumBackgroundEventLoopTasks < CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE)
+    {
+        err = pthread_create(&mBackgroundEventLoopTasks[mNumBackgroundEventLoopTasks], nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            break;
+        }
+        mNumBackgroundEventLoopTasks++;
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    if (err != 0)
+    {
+        // Stop the tasks that could be created, rather than running with fewer than configured.
+        RETURN_SAFELY_IGNORED _StopBackgroundEventLoopTask();
+    }
+    return CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mShouldRunBackgroundEventLoop = false;
+    pthread_cond_broadcast(&mBackgroundEventCond);
+    size_t numTasks = mNumBackgroundEventLoopTasks;
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    // New events now go to the foreground event loop, and the tasks finish the events already queued before exiting.
+    // A task stopping the pool cannot wait for itself.
+    int err              = 0;
+    bool stoppedFromTask = false;
+    for (size_t i = 0; i < numTasks; i++)
+    {
+        if (pthread_equal(pthread_self(), mBackgroundEventLoopTasks[i]) == 0)
+        {
+            int joinErr = pthread_join(mBackgroundEventLoopTasks[i], nullptr);
+            err         = (err == 0) ? joinErr : err;
+        }
+        else
+        {
+            pthread_detach(mBackgroundEventLoopTasks[i]);
+            stoppedFromTask = true;
+        }
+    }
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mNumBackgroundEventLoopTasks = 0;
+    // Unless a task stopped the pool and is still draining the queue itself, hand anything left over to the foreground
+    // event loop rather than dropping it.
+    while (!stoppedFromTask && !mBackgroundEventQueue.empty())
+    {
+        ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+        LogErrorOnFailure(_PostEvent(&event));
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    return CHIP_ERROR_POSIX(err);
+#else
+    // Use foreground event loop for background events
+    return CHIP_NO_ERROR;
+#endif
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+#endif
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -394,6 +553,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    LogErrorOnFailure(_StopBackgroundEventLoopTask());
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
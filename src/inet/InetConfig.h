@@ -272,6 +272,72 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS
+ *
+ *  @brief
+ *    The largest number of chained packet buffers the socket-based
+ *    implementation of UDP endpoints can send as one datagram.
+ *
+ *  @details
+ *    Each buffer of the chain is passed to sendmsg() as one element of
+ *    the I/O vector, so that the chain does not need to be copied into
+ *    a single buffer. Sending a longer chain fails with
+ *    CHIP_ERROR_MESSAGE_TOO_LONG.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS
+#define INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS 8
+#endif // INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+ *
+ *  @brief
+ *    The largest number of datagrams the socket-based implementation of
+ *    UDP endpoints reads each time its socket becomes readable.
+ *
+ *  @details
+ *    The datagrams are read with a single call to recvmmsg(), which
+ *    requires HAVE_RECVMMSG, into packet buffers of the largest size
+ *    allocated beforehand, and the buffers left unused are freed. They
+ *    are then handed together to the endpoint's batch reception
+ *    delegate, or one after the other to its reception delegate when
+ *    it has none. Without recvmmsg(), one datagram is read per event.
+ *
+ *    The buffers of a batch are held until its datagrams are handled,
+ *    so this is best left to 1 when packet buffers come from a pool
+ *    (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is not 0).
+ *
+ *    GN builds can set it with chip_inet_config_udp_socket_recv_batch_size.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+ *
+ *  @brief
+ *    The largest number of datagrams the socket-based implementation of
+ *    UDP endpoints hands to the system at once.
+ *
+ *  @details
+ *    UDPEndPoint::SendMsgs() sends its messages in batches of this size,
+ *    with one call to sendmmsg() each, which requires HAVE_SENDMMSG.
+ *    When this is greater than 1, the UDP transport also queues the
+ *    messages sent during an iteration of a select-based event loop and
+ *    sends them together at the end of the iteration.
+ *
+ *    Queued messages hold their packet buffers until the end of the
+ *    iteration, so this is best left to 1 when packet buffers come from
+ *    a pool (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is not 0).
+ *
+ *    GN builds can set it with chip_inet_config_udp_socket_send_batch_size.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
@@ -283,6 +349,26 @@
 #define HAVE_SO_BINDTODEVICE 0
 #endif
 
+/**
+ *  @def HAVE_RECVMMSG
+ *
+ *  @brief
+ *    Should be set to 1 if the recvmmsg() system call is available.
+ */
+#ifndef HAVE_RECVMMSG
+#define HAVE_RECVMMSG 0
+#endif
+
+/**
+ *  @def HAVE_SENDMMSG
+ *
+ *  @brief
+ *    Should be set to 1 if the sendmmsg() system call is available.
+ */
+#ifndef HAVE_SENDMMSG
+#define HAVE_SENDMMSG 0
+#endif
+
 /**
  *  @def INET_CONFIG_UDP_SOCKET_MREQN
  *
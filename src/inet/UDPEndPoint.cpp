@@ -121,6 +121,23 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+void UDPEndPoint::SendMsgs(const IPPacketInfo * pktInfos, const System::PacketBufferHandle * msgs, CHIP_ERROR * errors,
+                           size_t count)
+{
+    SendMsgsImpl(pktInfos, msgs, errors, count);
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+}
+
+void UDPEndPoint::SendMsgsImpl(const IPPacketInfo * pktInfos, const System::PacketBufferHandle * msgs, CHIP_ERROR * errors,
+                               size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        errors[i] = msgs[i].IsNull() ? CHIP_ERROR_INVALID_ARGUMENT : SendMsgImpl(&pktInfos[i], msgs[i].Retain());
+    }
+}
+
 void UDPEndPoint::Free()
 {
     Close();
@@ -88,6 +88,22 @@ public:
      */
     using OnReceiveErrorFunct = void (*)(UDPEndPoint * endPoint, CHIP_ERROR err, const IPPacketInfo * pktInfo);
 
+    /**
+     * Type of batch message reception event handling function.
+     *
+     * @param[in]   endPoint    The endpoint associated with the event.
+     * @param[in]   msgs        The messages received, which the function may move from.
+     * @param[in]   pktInfos    The IP information of each message.
+     * @param[in]   count       The number of messages received.
+     *
+     *  Provide a function of this type to SetOnMessagesReceived() to process
+     *  together the messages that the implementation reads for one reception
+     *  event on \c endPoint. The messages left in \c msgs are freed when the
+     *  function returns.
+     */
+    using OnMessagesReceivedFunct = void (*)(UDPEndPoint * endPoint, chip::System::PacketBufferHandle * msgs,
+                                             const IPPacketInfo * pktInfos, size_t count);
+
     /**
      * Set whether IP multicast traffic should be looped back.
      */
@@ -188,6 +204,18 @@ public:
      */
     CHIP_ERROR Listen(OnMessageReceivedFunct onMessageReceived, OnReceiveErrorFunct onReceiveError, void * appState = nullptr);
 
+    /**
+     * Set the delegate that receives the messages read for one reception event at once.
+     *
+     *  Only the socket-based implementation reads several messages per event, see
+     *  INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE. The other implementations, and this one
+     *  when no such delegate is set, pass each message to the \c OnMessageReceived
+     *  delegate given to Listen().
+     *
+     * @param[in]  onMessagesReceived  The endpoint's batch message reception event handling function delegate.
+     */
+    void SetOnMessagesReceived(OnMessagesReceivedFunct onMessagesReceived) { OnMessagesReceived = onMessagesReceived; }
+
     /**
      * Send a UDP message to the specified destination address.
      *
@@ -230,6 +258,21 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send several UDP messages, each to the destination given in its packet information.
+     *
+     *  This has the same effect as calling SendMsg() for each message in turn, except that the
+     *  socket-based implementation hands up to INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE messages
+     *  to the system at once. The messages are left in \c msgs.
+     *
+     * @param[in]   pktInfos    Source and destination information for each message.
+     * @param[in]   msgs        Packet buffers containing the messages.
+     * @param[out]  errors      The result of sending each message, as SendMsg() would return it.
+     * @param[in]   count       The number of messages.
+     */
+    void SendMsgs(const IPPacketInfo * pktInfos, const chip::System::PacketBufferHandle * msgs, CHIP_ERROR * errors,
+                  size_t count);
+
     /**
      * Close the endpoint.
      *
@@ -279,6 +322,9 @@ protected:
     /** The endpoint's message reception event handling function delegate. */
     OnMessageReceivedFunct OnMessageReceived;
 
+    /** The endpoint's batch message reception event handling function delegate. */
+    OnMessagesReceivedFunct OnMessagesReceived = nullptr;
+
     /** The endpoint's receive error event handling function delegate. */
     OnReceiveErrorFunct OnReceiveError;
 
@@ -296,6 +342,10 @@ protected:
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
 
+    // Sends the messages one at a time with SendMsgImpl().
+    virtual void SendMsgsImpl(const IPPacketInfo * pktInfos, const chip::System::PacketBufferHandle * msgs, CHIP_ERROR * errors,
+                              size_t count);
+
     /**
      * Close the endpoint and recycle its memory.
      *
@@ -277,7 +277,94 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
+struct UDPEndPointImplSockets::SendHeader
+{
+    struct msghdr mMsgHeader;
+    struct iovec mIOV[INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS];
+    SockAddr mPeerSockAddr;
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    uint8_t mControlData[256];
+#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+};
+
 CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    SendHeader sendHeader;
+    ReturnErrorOnFailure(PrepareSendHeader(aPktInfo, msg, sendHeader));
+
+    // Send IP packet.
+    // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
+    const ssize_t lenSent = sendmsg(mSocket, &sendHeader.mMsgHeader, 0);
+    if (lenSent == -1)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    size_t len = static_cast<size_t>(lenSent);
+
+    if (len != msg->TotalLength())
+    {
+        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+    }
+    return CHIP_NO_ERROR;
+}
+
+void UDPEndPointImplSockets::SendMsgsImpl(const IPPacketInfo * pktInfos, const System::PacketBufferHandle * msgs,
+                                          CHIP_ERROR * errors, size_t count)
+{
+#if HAVE_SENDMMSG
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE;
+
+    size_t next = 0;
+    while (next < count)
+    {
+        SendHeader sendHeaders[kBatchSize];
+        struct mmsghdr msgHeaders[kBatchSize];
+        size_t msgIndexes[kBatchSize];
+        size_t numHeaders = 0;
+
+        for (; next < count && numHeaders < kBatchSize; next++)
+        {
+            errors[next] = msgs[next].IsNull() ? CHIP_ERROR_INVALID_ARGUMENT
+                                               : PrepareSendHeader(&pktInfos[next], msgs[next], sendHeaders[numHeaders]);
+            if (errors[next] == CHIP_NO_ERROR)
+            {
+                memset(&msgHeaders[numHeaders], 0, sizeof(msgHeaders[numHeaders]));
+                msgHeaders[numHeaders].msg_hdr = sendHeaders[numHeaders].mMsgHeader;
+                msgIndexes[numHeaders++]       = next;
+            }
+        }
+
+        // sendmmsg() stops at the first message it fails to send, and only reports the error if that is the first message,
+        // so the remaining messages are sent again until each one is either sent or given an error.
+        size_t numSent = 0;
+        while (numSent < numHeaders)
+        {
+            // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): PrepareSendHeader ensures mSocket is valid
+            const int result = sendmmsg(mSocket, &msgHeaders[numSent], static_cast<unsigned int>(numHeaders - numSent), 0);
+            if (result <= 0)
+            {
+                errors[msgIndexes[numSent++]] = CHIP_ERROR_POSIX(result == 0 ? EIO : errno);
+                continue;
+            }
+
+            for (int i = 0; i < result; i++, numSent++)
+            {
+                const size_t index = msgIndexes[numSent];
+                if (msgHeaders[numSent].msg_len != msgs[index]->TotalLength())
+                {
+                    errors[index] = CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+                }
+            }
+        }
+    }
+#else
+    UDPEndPoint::SendMsgsImpl(pktInfos, msgs, errors, count);
+#endif // HAVE_SENDMMSG
+}
+
+CHIP_ERROR UDPEndPointImplSockets::PrepareSendHeader(const IPPacketInfo * aPktInfo, const System::PacketBufferHandle & msg,
+                                                     SendHeader & aSendHeader)
 {
     // Ensure packet buffer is not null
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
@@ -289,25 +376,30 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    // Hand the buffers of a chain to the socket as they are, rather than copying them into a single buffer.
+    struct iovec * msgIOV         = aSendHeader.mIOV;
+    size_t msgIOVCount            = 0;
+    const bool allBuffersGathered = msg.ForEachBuffer([&](const System::PacketBuffer & buffer) {
+        VerifyOrReturnValue(msgIOVCount < MATTER_ARRAY_SIZE(aSendHeader.mIOV), false);
+        msgIOV[msgIOVCount].iov_base = buffer.Start();
+        msgIOV[msgIOVCount].iov_len  = buffer.DataLength();
+        msgIOVCount++;
+        return true;
+    });
+    VerifyOrReturnError(allBuffersGathered, CHIP_ERROR_MESSAGE_TOO_LONG);
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
+    uint8_t * controlData = aSendHeader.mControlData;
+    memset(controlData, 0, sizeof(aSendHeader.mControlData));
 #endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = aSendHeader.mMsgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = msgIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(msgIOVCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
+    SockAddr & peerSockAddr = aSendHeader.mPeerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
@@ -351,7 +443,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(aSendHeader.mControlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -409,20 +501,6 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
-    // Send IP packet.
-    // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
-    if (lenSent == -1)
-    {
-        return CHIP_ERROR_POSIX(errno);
-    }
-
-    size_t len = static_cast<size_t>(lenSent);
-
-    if (len != msg->DataLength())
-    {
-        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
-    }
     return CHIP_NO_ERROR;
 }
 
@@ -565,6 +643,87 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr
     reinterpret_cast<UDPEndPointImplSockets *>(data)->HandlePendingIO(events);
 }
 
+namespace {
+
+#if HAVE_RECVMMSG
+constexpr size_t kReceiveBatchSize = INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE;
+using ReceiveHeader                = struct mmsghdr;
+#else
+constexpr size_t kReceiveBatchSize = 1;
+
+// Same layout as the struct mmsghdr of recvmmsg(), for recvmsg().
+struct ReceiveHeader
+{
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif // HAVE_RECVMMSG
+
+static_assert(kReceiveBatchSize >= 1, "INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE must be at least 1");
+
+// The buffers and socket structures of the datagrams read for one event.
+struct ReceiveBatch
+{
+    System::PacketBufferHandle mBuffers[kReceiveBatchSize];
+    IPPacketInfo mPacketInfos[kReceiveBatchSize];
+    SockAddr mPeerSockAddrs[kReceiveBatchSize];
+    uint8_t mControlData[kReceiveBatchSize][256];
+    struct iovec mIOVs[kReceiveBatchSize];
+    ReceiveHeader mHeaders[kReceiveBatchSize];
+};
+
+CHIP_ERROR GetReceivedPacketInfo(struct msghdr & msgHeader, const SockAddr & peerSockAddr, IPPacketInfo & packetInfo)
+{
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 {
     if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
@@ -574,124 +733,113 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
-    CHIP_ERROR lStatus = CHIP_NO_ERROR;
-    IPPacketInfo lPacketInfo;
-    System::PacketBufferHandle lBuffer;
+    ReceiveBatch batch;
+    size_t numBuffers = 0;
+
+    auto reportError = [this](CHIP_ERROR error) {
+        if (OnReceiveError != nullptr && error != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, error, nullptr);
+        }
+    };
+
+    for (; numBuffers < kReceiveBatchSize; numBuffers++)
+    {
+        System::PacketBufferHandle & buffer = batch.mBuffers[numBuffers];
+        buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (buffer.IsNull())
+        {
+            break;
+        }
+
+        batch.mIOVs[numBuffers].iov_base = buffer->Start();
+        batch.mIOVs[numBuffers].iov_len  = buffer->AvailableDataLength();
 
-    lPacketInfo.Clear();
-    lPacketInfo.DestPort  = mBoundPort;
-    lPacketInfo.Interface = mBoundIntfId;
+        memset(&batch.mPeerSockAddrs[numBuffers], 0, sizeof(batch.mPeerSockAddrs[numBuffers]));
+        memset(batch.mControlData[numBuffers], 0, sizeof(batch.mControlData[numBuffers]));
+        memset(&batch.mHeaders[numBuffers], 0, sizeof(batch.mHeaders[numBuffers]));
 
-    lBuffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        struct msghdr & msgHeader = batch.mHeaders[numBuffers].msg_hdr;
+        msgHeader.msg_name        = &batch.mPeerSockAddrs[numBuffers];
+        msgHeader.msg_namelen     = sizeof(batch.mPeerSockAddrs[numBuffers]);
+        msgHeader.msg_iov         = &batch.mIOVs[numBuffers];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = batch.mControlData[numBuffers];
+        msgHeader.msg_controllen  = sizeof(batch.mControlData[numBuffers]);
+    }
 
-    if (!lBuffer.IsNull())
+    if (numBuffers == 0)
     {
-        struct iovec msgIOV;
-        SockAddr lPeerSockAddr;
-        uint8_t controlData[256];
-        struct msghdr msgHeader;
+        reportError(CHIP_ERROR_NO_MEMORY);
+        return;
+    }
 
-        msgIOV.iov_base = lBuffer->Start();
-        msgIOV.iov_len  = lBuffer->AvailableDataLength();
+#if HAVE_RECVMMSG
+    int numReceived = recvmmsg(mSocket, batch.mHeaders, static_cast<unsigned int>(numBuffers), MSG_DONTWAIT, nullptr);
+#else
+    ssize_t rcvLen            = recvmsg(mSocket, &batch.mHeaders[0].msg_hdr, MSG_DONTWAIT);
+    batch.mHeaders[0].msg_len = static_cast<unsigned int>(rcvLen);
+    int numReceived           = (rcvLen == -1) ? -1 : 1;
+#endif // HAVE_RECVMMSG
 
-        memset(&lPeerSockAddr, 0, sizeof(lPeerSockAddr));
-        memset(controlData, 0, sizeof(controlData));
-        memset(&msgHeader, 0, sizeof(msgHeader));
+    if (numReceived == -1)
+    {
+        reportError(CHIP_ERROR_POSIX(errno));
+        return;
+    }
 
-        msgHeader.msg_name       = &lPeerSockAddr;
-        msgHeader.msg_namelen    = sizeof(lPeerSockAddr);
-        msgHeader.msg_iov        = &msgIOV;
-        msgHeader.msg_iovlen     = 1;
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+    // Move the datagrams that were received correctly to the front of the batch, and free the other buffers.
+    size_t numMessages = 0;
+    for (size_t i = 0; i < static_cast<size_t>(numReceived); i++)
+    {
+        System::PacketBufferHandle & buffer = batch.mBuffers[i];
+        IPPacketInfo & packetInfo           = batch.mPacketInfos[numMessages];
+        CHIP_ERROR status                   = CHIP_NO_ERROR;
 
-        ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
 
-        if (rcvLen == -1)
+        if (buffer->AvailableDataLength() < batch.mHeaders[i].msg_len)
         {
-            lStatus = CHIP_ERROR_POSIX(errno);
-        }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
-        {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+            status = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
         }
         else
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
+            status = GetReceivedPacketInfo(batch.mHeaders[i].msg_hdr, batch.mPeerSockAddrs[i], packetInfo);
         }
 
-        if (lStatus == CHIP_NO_ERROR)
+        if (status != CHIP_NO_ERROR)
         {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
+            buffer = nullptr;
+            reportError(status);
+            continue;
+        }
 
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+        buffer->SetDataLength(static_cast<uint16_t>(batch.mHeaders[i].msg_len));
+        buffer.RightSize();
+        if (i != numMessages)
+        {
+            batch.mBuffers[numMessages] = std::move(buffer);
         }
+        numMessages++;
     }
-    else
+
+    // A delegate may close the endpoint.
+    if (numMessages == 0 || mState != State::kListening)
     {
-        lStatus = CHIP_ERROR_NO_MEMORY;
+        return;
     }
 
-    if (lStatus == CHIP_NO_ERROR)
+    if (OnMessagesReceived != nullptr)
     {
-        lBuffer.RightSize();
-        OnMessageReceived(this, std::move(lBuffer), &lPacketInfo);
+        OnMessagesReceived(this, batch.mBuffers, batch.mPacketInfos, numMessages);
+        return;
     }
-    else
+
+    for (size_t i = 0; i < numMessages && mState == State::kListening && OnMessageReceived != nullptr; i++)
     {
-        if (OnReceiveError != nullptr && lStatus != CHIP_ERROR_POSIX(EAGAIN))
-        {
-            OnReceiveError(this, lStatus, nullptr);
-        }
+        OnMessageReceived(this, std::move(batch.mBuffers[i]), &batch.mPacketInfos[i]);
     }
 }
 
@@ -51,9 +51,16 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+    void SendMsgsImpl(const IPPacketInfo * pktInfos, const chip::System::PacketBufferHandle * msgs, CHIP_ERROR * errors,
+                      size_t count) override;
     void CloseImpl() override;
 
+    // The I/O vector, destination and control data of a message being sent.
+    struct SendHeader;
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
+    CHIP_ERROR PrepareSendHeader(const IPPacketInfo * aPktInfo, const chip::System::PacketBufferHandle & msg,
+                                 SendHeader & aSendHeader);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
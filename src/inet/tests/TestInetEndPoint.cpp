@@ -24,6 +24,7 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 #include <stdint.h>
@@ -41,6 +42,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <system/SystemError.h>
+#include <system/SystemStats.h>
 
 #include "TestInetCommon.h"
 #include "TestSetupSignalling.h"
@@ -378,6 +380,121 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+PacketBufferHandle gReceivedUDPMessage;
+
+void HandleUDPMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    gReceivedUDPMessage = std::move(msg);
+}
+
+// Test that a chain of packet buffers is sent as one datagram, without being copied into a single buffer.
+TEST_F(TestInetEndPoint, TestInetUDPSendChain)
+{
+    static const char kHead[] = "Hello, ";
+    static const char kTail[] = "world!";
+
+    UDPEndPointHandle testUDPEP;
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    ASSERT_EQ(gUDP.NewEndPoint(testUDPEP), CHIP_NO_ERROR);
+    ASSERT_EQ(testUDPEP->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(testUDPEP->Listen(HandleUDPMessageReceived, nullptr /*OnReceiveError*/), CHIP_NO_ERROR);
+    const uint16_t port = testUDPEP->GetBoundPort();
+
+    PacketBufferHandle buf = PacketBufferHandle::NewWithData(kHead, strlen(kHead));
+    ASSERT_FALSE(buf.IsNull());
+    buf->AddToEnd(PacketBufferHandle::NewWithData(kTail, sizeof(kTail)));
+    ASSERT_TRUE(buf->HasChainedBuffer());
+
+    SYSTEM_STATS_RESET_TOTAL(System::Stats::kPacketBuffer_BytesCopied);
+    EXPECT_EQ(testUDPEP->SendTo(loopback, port, std::move(buf)), CHIP_NO_ERROR);
+    EXPECT_TRUE(SYSTEM_STATS_TEST_TOTAL(System::Stats::kPacketBuffer_BytesCopied, 0));
+
+    for (int i = 0; i < 100 && gReceivedUDPMessage.IsNull(); i++)
+    {
+        ServiceEvents(10);
+    }
+    ASSERT_FALSE(gReceivedUDPMessage.IsNull());
+    EXPECT_FALSE(gReceivedUDPMessage->HasChainedBuffer());
+    EXPECT_EQ(gReceivedUDPMessage->DataLength(), strlen(kHead) + sizeof(kTail));
+    EXPECT_STREQ(reinterpret_cast<const char *>(gReceivedUDPMessage->Start()), "Hello, world!");
+    gReceivedUDPMessage = nullptr;
+
+    // A chain longer than can be gathered is rejected.
+    buf = PacketBufferHandle::NewWithData(kHead, strlen(kHead));
+    ASSERT_FALSE(buf.IsNull());
+    for (int i = 0; i < INET_CONFIG_UDP_SOCKET_MAX_SEND_BUFFERS; i++)
+    {
+        buf->AddToEnd(PacketBufferHandle::NewWithData(kTail, strlen(kTail)));
+    }
+    EXPECT_EQ(testUDPEP->SendTo(loopback, port, std::move(buf)), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    testUDPEP.Release();
+}
+
+size_t gNumBatchedUDPMessages = 0;
+size_t gNumUDPBatches         = 0;
+size_t gLargestUDPBatch       = 0;
+
+void HandleUDPMessagesReceived(UDPEndPoint * endPoint, PacketBufferHandle * msgs, const IPPacketInfo * pktInfos, size_t count)
+{
+    gNumBatchedUDPMessages += count;
+    gNumUDPBatches++;
+    gLargestUDPBatch = std::max(gLargestUDPBatch, count);
+}
+
+// Test that the datagrams read for one event are passed on together.
+TEST_F(TestInetEndPoint, TestInetUDPReceiveBatch)
+{
+    constexpr size_t kNumBursts     = 20;
+    constexpr size_t kDatagramsEach = 32;
+    static const char kPayload[]    = "batch";
+
+    UDPEndPointHandle receiver;
+    UDPEndPointHandle sender;
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    ASSERT_EQ(gUDP.NewEndPoint(receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(sender->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    receiver->SetOnMessagesReceived(HandleUDPMessagesReceived);
+    ASSERT_EQ(receiver->Listen(HandleUDPMessageReceived, nullptr /*OnReceiveError*/), CHIP_NO_ERROR);
+    const uint16_t port = receiver->GetBoundPort();
+
+    gNumBatchedUDPMessages = 0;
+    gNumUDPBatches         = 0;
+    gLargestUDPBatch       = 0;
+
+    for (size_t burst = 0; burst < kNumBursts; burst++)
+    {
+        for (size_t i = 0; i < kDatagramsEach; i++)
+        {
+            EXPECT_EQ(sender->SendTo(loopback, port, PacketBufferHandle::NewWithData(kPayload, sizeof(kPayload))), CHIP_NO_ERROR);
+        }
+        for (int i = 0; i < 100 && gNumBatchedUDPMessages < (burst + 1) * kDatagramsEach; i++)
+        {
+            ServiceEvents(10);
+        }
+    }
+
+    EXPECT_EQ(gNumBatchedUDPMessages, kNumBursts * kDatagramsEach);
+    EXPECT_TRUE(gReceivedUDPMessage.IsNull());
+    // Batches may be shorter when the packet buffer pool runs out.
+    EXPECT_LE(gLargestUDPBatch, static_cast<size_t>(INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE));
+#if HAVE_RECVMMSG && INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+    EXPECT_GT(gLargestUDPBatch, 1u);
+    EXPECT_LT(gNumUDPBatches, gNumBatchedUDPMessages);
+#else
+    EXPECT_EQ(gNumUDPBatches, gNumBatchedUDPMessages);
+#endif // HAVE_RECVMMSG && INET_CONFIG_UDP_SOCKET_RECV_BATCH_SIZE > 1
+
+    sender.Release();
+    receiver.Release();
+}
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT && CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
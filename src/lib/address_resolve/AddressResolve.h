@@ -227,7 +227,10 @@ public:
     /// and/or the listener.
     ///
     /// This method will return CHIP_NO_ERROR if and only if it has called
-    /// OnNodeAddressResolved.
+    /// OnNodeAddressResolved, or, for a handle whose results came from
+    /// addresses cached by the implementation, it has made the handle active
+    /// again with a new lookup whose outcome is reported to the listener as
+    /// for LookupNode.
     ///
     /// This method will return CHIP_ERROR_INCORRECT_STATE if the handle is
     /// still active.
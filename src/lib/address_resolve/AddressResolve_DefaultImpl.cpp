@@ -28,6 +28,26 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+/// Result matching the resolved node data, except for the IP address that
+/// is set by the caller for each of the addresses found.
+ResolveResult ResolveResultFor(const Dnssd::ResolvedNodeData & nodeData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    return result;
+}
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -35,6 +55,15 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mServedFromCache  = false;
+}
+
+void NodeLookupHandle::ResetForCachedResults(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                                             const NodeLookupResults & results)
+{
+    ResetForLookup(now, request);
+    mResults         = results;
+    mServedFromCache = true;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -66,6 +95,12 @@ System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timesta
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mServedFromCache && HasLookupResult())
+    {
+        // Nothing to wait for: report the cached result right away.
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -104,6 +139,13 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
+    // No DNSSD lookup runs for results from the cache, so do not wait for more.
+    if (mServedFromCache && HasLookupResult())
+    {
+        auto result = TakeLookupResult();
+        return NodeLookupAction::Success(result);
+    }
+
     // We are still within the minimal search time. Wait for more results.
     if (elapsed < mRequest.GetMinLookupTime())
     {
@@ -198,14 +240,104 @@ bool NodeLookupResults::UpdateResults(const ResolveResult & result, const Dnssd:
     return true;
 }
 
+NodeAddressCache::Entry * NodeAddressCache::Find(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.inUse && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void NodeAddressCache::Store(const PeerId & peerId, const NodeLookupResults & results, System::Clock::Timestamp now)
+{
+    Entry * entry = Find(peerId);
+    if (entry == nullptr)
+    {
+        for (auto & candidate : mEntries)
+        {
+            if (!candidate.inUse)
+            {
+                entry = &candidate;
+                break;
+            }
+            if (entry == nullptr || candidate.lastUse < entry->lastUse)
+            {
+                entry = &candidate;
+            }
+        }
+        VerifyOrReturn(entry != nullptr);
+    }
+
+    entry->peerId     = peerId;
+    entry->results    = results;
+    entry->resolvedAt = now;
+    entry->inUse      = true;
+    entry->refreshing = false;
+    Touch(*entry);
+}
+
+void NodeAddressCache::Remove(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturn(entry != nullptr);
+    *entry = Entry();
+}
+
+void NodeAddressCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+}
+
 CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLookupHandle & handle)
 {
     MATTER_LOG_NODE_LOOKUP(&request);
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
-    auto & peerId = request.GetPeerId();
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    auto & peerId                      = request.GetPeerId();
+
+    NodeAddressCache::Entry * cached = mCache.Find(peerId);
+    if (cached != nullptr && now - cached->resolvedAt < NodeAddressCache::kTimeToLive)
+    {
+        mCacheHits++;
+        mCache.Touch(*cached);
+        handle.ResetForCachedResults(now, request, cached->results);
+
+        // Past half of its lifetime, refresh the address for the next lookups
+        // without making this one wait.
+        if (!cached->refreshing && now - cached->resolvedAt >= NodeAddressCache::kTimeToLive / 2)
+        {
+            cached->refreshing = true;
+            CHIP_ERROR err     = Dnssd::Resolver::Instance().ResolveNodeId(peerId);
+            if (err != CHIP_NO_ERROR)
+            {
+                ChipLogError(Discovery, "Failed to refresh address of " ChipLogFormatPeerId ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValuePeerId(peerId), err.Format());
+                // The entry may have been updated by a synchronous callback.
+                cached = mCache.Find(peerId);
+                if (cached != nullptr)
+                {
+                    cached->refreshing = false;
+                }
+            }
+        }
+
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup of " ChipLogFormatPeerId " served from cache", ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+
+    mCacheMisses++;
+    handle.ResetForLookup(now, request);
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -216,6 +348,16 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 CHIP_ERROR Resolver::TryNextResult(Impl::NodeLookupHandle & handle)
 {
     VerifyOrReturnError(!mActiveLookups.Contains(&handle), CHIP_ERROR_INCORRECT_STATE);
+
+    // The cached entry is kept: the previous result may only have failed
+    // because the node was busy.  Once none of the cached results worked,
+    // look the node up again, in case its addresses changed; the results of
+    // that lookup also replace the cached ones.
+    if (!handle.HasLookupResult() && handle.IsServedFromCache())
+    {
+        return LookupAgain(handle);
+    }
+
     VerifyOrReturnError(handle.HasLookupResult(), CHIP_ERROR_NOT_FOUND);
 
     auto listener = handle.GetListener();
@@ -232,7 +374,7 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    LookupNoLongerNeeded(handle);
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -278,7 +420,7 @@ void Resolver::Shutdown()
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        LookupNoLongerNeeded(*current);
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -289,6 +431,8 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    mCache.Clear();
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
@@ -305,18 +449,7 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
+        ResolveResult result = ResolveResultFor(nodeData);
 
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
@@ -334,9 +467,105 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
         HandleAction(current);
     }
 
+    UpdateCache(nodeData);
+
     ReArmTimer();
 }
 
+void Resolver::UpdateCache(const Dnssd::ResolvedNodeData & nodeData)
+{
+    const PeerId & peerId            = nodeData.operationalData.peerId;
+    NodeAddressCache::Entry * cached = mCache.Find(peerId);
+    if (cached != nullptr)
+    {
+        EndRefresh(*cached);
+    }
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // The node withdrew its records: the address is no longer valid.
+        mCache.Remove(peerId);
+        return;
+    }
+
+    ResolveResult result = ResolveResultFor(nodeData);
+    NodeLookupResults found;
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+        {
+            continue;
+        }
+#endif
+        const Inet::IPAddress & address = nodeData.resolutionData.ipAddress[i];
+        result.address.SetIPAddress(address);
+        found.UpdateResults(result, Dnssd::IPAddressSorter::ScoreIpAddress(address, result.address.GetInterface()));
+    }
+
+    if (found.HasValidResult())
+    {
+        mCache.Store(peerId, found, mTimeSource.GetMonotonicTimestamp());
+    }
+}
+
+CHIP_ERROR Resolver::LookupAgain(NodeLookupHandle & handle)
+{
+    const NodeLookupRequest request = handle.GetRequest();
+    const PeerId & peerId           = request.GetPeerId();
+
+    ChipLogProgress(Discovery, "Cached addresses of " ChipLogFormatPeerId " did not work, looking it up again",
+                    ChipLogValuePeerId(peerId));
+
+    mCacheMisses++;
+    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
+    mActiveLookups.PushBack(&handle);
+    ReArmTimer();
+    return CHIP_NO_ERROR;
+}
+
+void Resolver::InvalidateCachedResult(const PeerId & peerId)
+{
+    NodeAddressCache::Entry * cached = mCache.Find(peerId);
+    VerifyOrReturn(cached != nullptr);
+
+    EndRefresh(*cached);
+    mCache.Remove(peerId);
+}
+
+void Resolver::LookupNoLongerNeeded(const NodeLookupHandle & handle)
+{
+    if (!handle.IsServedFromCache())
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    }
+}
+
+bool Resolver::IsLookupActive(const PeerId & peerId)
+{
+    for (auto & activeLookup : mActiveLookups)
+    {
+        if (!activeLookup.IsServedFromCache() && activeLookup.GetRequest().GetPeerId() == peerId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Resolver::EndRefresh(NodeAddressCache::Entry & entry)
+{
+    VerifyOrReturn(entry.refreshing);
+    entry.refreshing = false;
+
+    // Lookups still waiting for the same node keep the DNSSD lookup going.
+    if (!IsLookupActive(entry.peerId))
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(entry.peerId);
+    }
+}
+
 void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
 {
     const NodeLookupAction action = current->NextAction(mTimeSource.GetMonotonicTimestamp());
@@ -352,7 +581,7 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     NodeListener * listener = current->GetListener();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    LookupNoLongerNeeded(*current);
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -389,12 +618,15 @@ void Resolver::HandleTimer()
 
 void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error)
 {
+    InvalidateCachedResult(peerId);
+
     auto it = mActiveLookups.begin();
     while (it != mActiveLookups.end())
     {
         auto current = it;
         it++;
-        if (current->GetRequest().GetPeerId() != peerId)
+        // Lookups served from the cache already have their result and did not start this DNSSD lookup.
+        if (current->GetRequest().GetPeerId() != peerId || current->IsServedFromCache())
         {
             continue;
         }
@@ -448,9 +680,9 @@ void Resolver::ReArmTimer()
             NodeListener * listener = it->GetListener();
 
             mActiveLookups.Erase(it);
+            LookupNoLongerNeeded(*it);
             it = mActiveLookups.begin();
 
-            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
             // Callback only called after active lookup is cleared
             // This allows failure handlers to deallocate structures that may
             // contain the active lookup data as a member (intrusive lists members)
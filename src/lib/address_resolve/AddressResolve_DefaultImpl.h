@@ -16,6 +16,8 @@
  */
 #pragma once
 
+#include <array>
+
 #include <lib/address_resolve/AddressResolve.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
@@ -133,6 +135,17 @@ public:
     /// Resets internal state (i.e. best address so far)
     void ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request);
 
+    /// Sets up a request answered by the results from the address cache.
+    ///
+    /// The best result is reported on the next timer, without waiting for the
+    /// minimum lookup time, as no DNSSD lookup is done for this handle.  The
+    /// others are kept for TryNextResult.
+    void ResetForCachedResults(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                               const NodeLookupResults & results);
+
+    /// Was the handle set up by ResetForCachedResults?
+    bool IsServedFromCache() const { return mServedFromCache; }
+
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
@@ -161,6 +174,46 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mServedFromCache = false;
+};
+
+/// Keeps the addresses found for the most recently resolved nodes, best
+/// first.
+///
+/// Entries are replaced in least recently used order and are not
+/// served once older than kTimeToLive.
+class NodeAddressCache
+{
+public:
+    static constexpr size_t kSize = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
+    static constexpr System::Clock::Milliseconds32 kTimeToLive{ CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS };
+
+    struct Entry
+    {
+        PeerId peerId;
+        NodeLookupResults results;
+        System::Clock::Timestamp resolvedAt;
+        uint32_t lastUse = 0;
+        bool inUse       = false;
+        bool refreshing  = false; // a DNSSD lookup was started to refresh the entry
+    };
+
+    /// Returns the entry of the given node, whatever its age, or nullptr.
+    Entry * Find(const PeerId & peerId);
+
+    /// Marks the entry as the most recently used one.
+    void Touch(Entry & entry) { entry.lastUse = ++mUseCounter; }
+
+    /// Stores the addresses found for a node, replacing the least recently
+    /// used entry if there is no free one.
+    void Store(const PeerId & peerId, const NodeLookupResults & results, System::Clock::Timestamp now);
+
+    void Remove(const PeerId & peerId);
+    void Clear();
+
+private:
+    std::array<Entry, kSize> mEntries;
+    uint32_t mUseCounter = 0;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -181,6 +234,16 @@ public:
     void OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData) override;
     void OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERROR error) override;
 
+    /// Drops the cached addresses of the given node, so that the next lookup
+    /// of it goes through DNSSD.  Done when DNSSD fails to find the node.
+    void InvalidateCachedResult(const PeerId & peerId);
+
+    /// Number of lookups answered from the address cache.
+    uint32_t GetCacheHits() const { return mCacheHits; }
+
+    /// Number of lookups that had to go through DNSSD.
+    uint32_t GetCacheMisses() const { return mCacheMisses; }
+
 private:
     static void OnResolveTimer(System::Layer * layer, void * context) { static_cast<Resolver *>(context)->HandleTimer(); }
 
@@ -200,9 +263,30 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+    /// Keeps the addresses of a resolved node in the cache, or drops them
+    /// if the node withdrew its records.
+    void UpdateCache(const Dnssd::ResolvedNodeData & nodeData);
+
+    /// Starts a DNSSD lookup for a handle served from the cache whose
+    /// results were all tried.
+    CHIP_ERROR LookupAgain(NodeLookupHandle & handle);
+
+    /// Tells DNSSD that the lookup done for `handle` is no longer needed.
+    /// Handles served from the cache did not start any.
+    void LookupNoLongerNeeded(const NodeLookupHandle & handle);
+
+    /// Does any active lookup of the given node wait for DNSSD?
+    bool IsLookupActive(const PeerId & peerId);
+
+    /// Ends the background refresh of the given cache entry, if any.
+    void EndRefresh(NodeAddressCache::Entry & entry);
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+    NodeAddressCache mCache;
+    uint32_t mCacheHits   = 0;
+    uint32_t mCacheMisses = 0;
 };
 
 } // namespace Impl
@@ -529,8 +529,12 @@ public:
     bool IsInitialized() override { return true; }
     void Shutdown() override {}
     void SetOperationalDelegate(OperationalResolveDelegate * delegate) override {}
-    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override { return ResolveNodeIdStatus; }
-    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override {}
+    CHIP_ERROR ResolveNodeId(const PeerId & peerId) override
+    {
+        ResolveNodeIdCount++;
+        return ResolveNodeIdStatus;
+    }
+    void NodeIdResolutionNoLongerNeeded(const PeerId & peerId) override { NoLongerNeededCount++; }
     CHIP_ERROR StartDiscovery(DiscoveryType type, DiscoveryFilter filter, DiscoveryContext &) override
     {
         if (DiscoveryType::kCommissionerNode == type)
@@ -546,6 +550,8 @@ public:
     CHIP_ERROR InitStatus                  = CHIP_NO_ERROR;
     CHIP_ERROR ResolveNodeIdStatus         = CHIP_NO_ERROR;
     CHIP_ERROR DiscoverCommissionersStatus = CHIP_NO_ERROR;
+    size_t ResolveNodeIdCount              = 0;
+    size_t NoLongerNeededCount             = 0;
 };
 
 class TestAddressResolveDefaultImplWithSystemLayer : public ::testing::Test
@@ -865,4 +871,292 @@ TEST_F(TestAddressResolveDefaultImplWithSystemLayerAndNodeListener, ResolverShut
     EXPECT_EQ(expectedError, CHIP_ERROR_SHUT_DOWN);
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+/// Data reported by DNSSD when `peerId` is found at `address`.
+Dnssd::ResolvedNodeData ResolvedNodeDataFor(const PeerId & peerId, const Transport::PeerAddress & address)
+{
+    Dnssd::ResolvedNodeData resolvedData;
+    resolvedData.resolutionData.numIPs       = 1;
+    resolvedData.resolutionData.ipAddress[0] = address.GetIPAddress();
+    resolvedData.resolutionData.interfaceId  = address.GetInterface();
+    resolvedData.resolutionData.port         = address.GetPort();
+    resolvedData.operationalData.peerId      = peerId;
+    resolvedData.operationalData.hasZeroTTL  = false;
+    return resolvedData;
+}
+
+class TestAddressResolveDefaultImplCache : public TestAddressResolveDefaultImplWithSystemLayerAndNodeListener
+{
+public:
+    void SetUp() override
+    {
+        TestAddressResolveDefaultImplWithSystemLayerAndNodeListener::SetUp();
+
+        chip::Dnssd::Resolver::SetInstance(mockResolver);
+        EXPECT_SUCCESS(mResolver.Init(&mSystemLayer));
+
+        // Keep the timer instead of starting it, so that tests decide when it fires.
+        mSystemLayer.mStartTimerCallback = [this](System::Clock::Timeout, System::TimerCompleteCallback complete, void * state) {
+            mTimerCallback = complete;
+            mTimerState    = state;
+            return CHIP_NO_ERROR;
+        };
+
+        mNodeListener.SetOnNodeAddressResolved([this](const chip::PeerId & peerId, const ResolveResult & result) {
+            mResolvedCount++;
+            mResolvedAddress = result.address;
+        });
+        mNodeListener.SetOnNodeAddressResolutionFailed([this](const chip::PeerId & peerId, CHIP_ERROR reason) { mFailedCount++; });
+    }
+
+    void TearDown() override
+    {
+        mResolver.Shutdown();
+        TestAddressResolveDefaultImplWithSystemLayerAndNodeListener::TearDown();
+    }
+
+    /// Starts a lookup of `peerId` with `handle`.
+    void Lookup(const PeerId & peerId, AddressResolve::NodeLookupHandle & handle)
+    {
+        auto request = NodeLookupRequest(peerId);
+        request.SetMinLookupTime(100_ms32);
+        request.SetMaxLookupTime(200_ms32);
+
+        handle.SetListener(&mNodeListener);
+        EXPECT_SUCCESS(mResolver.LookupNode(request, handle));
+    }
+
+    /// Looks up `peerId` and lets DNSSD find it at `address`.
+    void LookupAndResolve(const PeerId & peerId, const Transport::PeerAddress & address)
+    {
+        AddressResolve::NodeLookupHandle handle;
+        Lookup(peerId, handle);
+        mClock.AdvanceMonotonic(150_ms64);
+        mResolver.OnOperationalNodeResolved(ResolvedNodeDataFor(peerId, address));
+        EXPECT_FALSE(handle.IsActive());
+    }
+
+    void FireTimer()
+    {
+        ASSERT_NE(mTimerCallback, nullptr);
+        auto callback  = mTimerCallback;
+        mTimerCallback = nullptr;
+        callback(&mSystemLayer, mTimerState);
+    }
+
+    System::Clock::Internal::RAIIMockClock mClock;
+    chip::AddressResolve::Impl::Resolver mResolver;
+    System::TimerCompleteCallback mTimerCallback = nullptr;
+    void * mTimerState                           = nullptr;
+    size_t mResolvedCount                        = 0;
+    size_t mFailedCount                          = 0;
+    Transport::PeerAddress mResolvedAddress;
+};
+
+TEST_F(TestAddressResolveDefaultImplCache, ServesCachedAddressWithoutLookingUpAgain)
+{
+    const PeerId peerId(1, 2);
+
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    EXPECT_EQ(mResolvedCount, 1u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 1u);
+    EXPECT_EQ(mResolver.GetCacheMisses(), 1u);
+
+    mClock.AdvanceMonotonic(1000_ms64);
+
+    AddressResolve::NodeLookupHandle handle;
+    Lookup(peerId, handle);
+    EXPECT_EQ(mResolver.GetCacheHits(), 1u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 1u);
+
+    // The result is reported by the next timer, not from within LookupNode.
+    EXPECT_EQ(mResolvedCount, 1u);
+    FireTimer();
+    EXPECT_EQ(mResolvedCount, 2u);
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(1));
+    EXPECT_FALSE(handle.IsActive());
+
+    // No DNSSD lookup was started for this handle, so none is stopped.
+    EXPECT_EQ(mockResolver.NoLongerNeededCount, 1u);
+}
+
+TEST_F(TestAddressResolveDefaultImplCache, RefreshesAddressInBackground)
+{
+    const PeerId peerId(1, 2);
+
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    mClock.AdvanceMonotonic(System::Clock::Milliseconds64(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS / 2));
+
+    // Past half of its lifetime, the address is still served but refreshed.
+    AddressResolve::NodeLookupHandle handle;
+    Lookup(peerId, handle);
+    EXPECT_EQ(mResolver.GetCacheHits(), 1u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+
+    FireTimer();
+    EXPECT_EQ(mResolvedCount, 2u);
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(1));
+
+    // Only one refresh runs at a time.
+    AddressResolve::NodeLookupHandle otherHandle;
+    Lookup(peerId, otherHandle);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+    FireTimer();
+    EXPECT_EQ(mResolvedCount, 3u);
+
+    // The refresh ends once DNSSD finds the node, and its address is served from then on.
+    const size_t noLongerNeededCount = mockResolver.NoLongerNeededCount;
+    mResolver.OnOperationalNodeResolved(ResolvedNodeDataFor(peerId, GetAddressWithLowScore(2)));
+    EXPECT_EQ(mockResolver.NoLongerNeededCount, noLongerNeededCount + 1);
+
+    Lookup(peerId, handle);
+    FireTimer();
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(2));
+    EXPECT_EQ(mResolver.GetCacheHits(), 3u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+}
+
+TEST_F(TestAddressResolveDefaultImplCache, DoesNotServeExpiredAddress)
+{
+    const PeerId peerId(1, 2);
+
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    mClock.AdvanceMonotonic(System::Clock::Milliseconds64(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS));
+
+    AddressResolve::NodeLookupHandle handle;
+    Lookup(peerId, handle);
+    EXPECT_EQ(mResolver.GetCacheHits(), 0u);
+    EXPECT_EQ(mResolver.GetCacheMisses(), 2u);
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+    EXPECT_TRUE(handle.IsActive());
+    EXPECT_SUCCESS(mResolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+}
+
+TEST_F(TestAddressResolveDefaultImplCache, LooksUpAgainOnceCachedAddressesWereTried)
+{
+    const PeerId peerId(1, 2);
+
+    AddressResolve::NodeLookupHandle handle;
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    Lookup(peerId, handle);
+    FireTimer();
+    EXPECT_EQ(mResolvedCount, 2u);
+
+    // A session could not be set up with the cached address, e.g. because the node was busy: the node is looked up
+    // again, and the cached address is kept meanwhile.
+    EXPECT_SUCCESS(mResolver.TryNextResult(handle));
+    EXPECT_TRUE(handle.IsActive());
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+    EXPECT_EQ(mResolver.GetCacheMisses(), 2u);
+
+    AddressResolve::NodeLookupHandle otherHandle;
+    Lookup(peerId, otherHandle);
+    EXPECT_EQ(mResolver.GetCacheHits(), 2u);
+    EXPECT_SUCCESS(mResolver.CancelLookup(otherHandle, Resolver::FailureCallback::Skip));
+
+    // The new lookup reports to the listener, and its address replaces the cached one.
+    mClock.AdvanceMonotonic(150_ms64);
+    mResolver.OnOperationalNodeResolved(ResolvedNodeDataFor(peerId, GetAddressWithLowScore(2)));
+    EXPECT_FALSE(handle.IsActive());
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(2));
+    EXPECT_EQ(mResolvedCount, 3u);
+    EXPECT_EQ(mResolver.TryNextResult(handle), CHIP_ERROR_NOT_FOUND);
+
+    Lookup(peerId, handle);
+    FireTimer();
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(2));
+    EXPECT_EQ(mResolver.GetCacheHits(), 3u);
+    EXPECT_EQ(mFailedCount, 0u);
+}
+
+#if CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS >= 2
+TEST_F(TestAddressResolveDefaultImplCache, TriesNextCachedAddress)
+{
+    const PeerId peerId(1, 2);
+
+    // DNSSD finds the node at two addresses: both are kept, best first.
+    auto resolvedData                        = ResolvedNodeDataFor(peerId, GetAddressWithLowScore(1));
+    resolvedData.resolutionData.numIPs       = 2;
+    resolvedData.resolutionData.ipAddress[1] = GetAddressWithHighScore().GetIPAddress();
+    AddressResolve::NodeLookupHandle handle;
+    Lookup(peerId, handle);
+    mClock.AdvanceMonotonic(150_ms64);
+    mResolver.OnOperationalNodeResolved(resolvedData);
+    EXPECT_EQ(mResolvedAddress, GetAddressWithHighScore());
+
+    Lookup(peerId, handle);
+    FireTimer();
+    EXPECT_EQ(mResolvedAddress, GetAddressWithHighScore());
+
+    EXPECT_SUCCESS(mResolver.TryNextResult(handle));
+    EXPECT_FALSE(handle.IsActive());
+    EXPECT_EQ(mResolvedAddress, GetAddressWithLowScore(1));
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 1u);
+
+    // Both cached addresses were tried.
+    EXPECT_SUCCESS(mResolver.TryNextResult(handle));
+    EXPECT_TRUE(handle.IsActive());
+    EXPECT_EQ(mockResolver.ResolveNodeIdCount, 2u);
+    EXPECT_SUCCESS(mResolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+
+    EXPECT_EQ(mResolvedCount, 3u);
+    EXPECT_EQ(mFailedCount, 0u);
+}
+#endif // CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS >= 2
+
+TEST_F(TestAddressResolveDefaultImplCache, InvalidatesAddress)
+{
+    const PeerId peerId(1, 2);
+    AddressResolve::NodeLookupHandle handle;
+
+    // The node withdrew its records.
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    auto goodbye                       = ResolvedNodeDataFor(peerId, GetAddressWithLowScore(1));
+    goodbye.operationalData.hasZeroTTL = true;
+    mResolver.OnOperationalNodeResolved(goodbye);
+    Lookup(peerId, handle);
+    EXPECT_EQ(mResolver.GetCacheMisses(), 2u);
+    EXPECT_SUCCESS(mResolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+
+    // DNSSD could not find the node anymore.
+    LookupAndResolve(peerId, GetAddressWithLowScore(1));
+    mResolver.OnOperationalNodeResolutionFailed(peerId, CHIP_ERROR_TIMEOUT);
+    Lookup(peerId, handle);
+    EXPECT_EQ(mResolver.GetCacheMisses(), 4u);
+    EXPECT_SUCCESS(mResolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+
+    EXPECT_EQ(mResolver.GetCacheHits(), 0u);
+    EXPECT_EQ(mFailedCount, 0u);
+}
+
+TEST_F(TestAddressResolveDefaultImplCache, ReplacesLeastRecentlyUsedAddress)
+{
+    constexpr size_t kCacheSize = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
+
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        LookupAndResolve(PeerId(1, i + 1), GetAddressWithLowScore(static_cast<uint16_t>(i + 1)));
+    }
+
+    // Use the first node again, so that the second one is the least recently used.
+    AddressResolve::NodeLookupHandle handle;
+    Lookup(PeerId(1, 1), handle);
+    FireTimer();
+    EXPECT_EQ(mResolver.GetCacheHits(), 1u);
+
+    LookupAndResolve(PeerId(1, kCacheSize + 1), GetAddressWithLowScore(static_cast<uint16_t>(kCacheSize + 1)));
+
+    Lookup(PeerId(1, 1), handle);
+    FireTimer();
+    EXPECT_EQ(mResolver.GetCacheHits(), 2u);
+
+    const size_t misses = mResolver.GetCacheMisses();
+    Lookup(PeerId(1, 2), handle);
+    EXPECT_EQ(mResolver.GetCacheMisses(), misses + 1);
+    EXPECT_SUCCESS(mResolver.CancelLookup(handle, Resolver::FailureCallback::Skip));
+}
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 } // namespace
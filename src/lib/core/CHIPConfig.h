@@ -902,8 +902,10 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
+ *      * #CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -954,6 +956,19 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS
+ *
+ * @brief Defines how long, in milliseconds, a single run of the reporting engine may spend building reports before it
+ *        yields to the event loop and schedules itself to continue with the remaining ReadHandlers.
+ *
+ * This bounds the latency that a burst of reports to many subscribers adds to other work on the event loop.  0 disables
+ * the limit.
+ */
+#ifndef CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS
+#define CHIP_IM_REPORT_ENGINE_RUN_BUDGET_MS 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -981,6 +996,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS
+ *
+ * @brief Defines the number of hash buckets in the index the reporting engine uses to find the ReadHandlers interested in
+ *        a dirty attribute path.  The index holds one entry per attribute path of every active ReadHandler.
+ *
+ * Set to 0 to disable the index and save its memory; marking a path dirty then checks the paths of every ReadHandler.
+ */
+#ifndef CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS
+#define CHIP_IM_SERVER_PATH_INDEX_NUM_BUCKETS 16
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1197,6 +1224,39 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+ *
+ * Enables copying the access control entries of a fabric, when first checked,
+ * into arrays allocated with chip::Platform::MemoryAlloc, so that access
+ * control checks do not go through the delegate for every entry, subject and
+ * target.  The copy is dropped whenever an entry of the fabric is created,
+ * updated or deleted through AccessControl.
+ *
+ * Disabled by default, as the copy costs heap memory for every fabric
+ * checked, and is wrong if the access control delegate can change its
+ * entries other than through AccessControl.  Platforms that have the memory
+ * and use such a delegate, e.g. ExampleAccessControlDelegate, can enable it.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Defines the number of recent access control decisions (for a subject, an
+ * endpoint, a cluster and a privilege) that are kept, so that the same check
+ * repeated for every attribute of a cluster does not go through the entries
+ * again.  Decisions are only kept for fabrics without device type targets, and
+ * requires CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES.
+ *
+ * Disabled (0) by default.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1330,6 +1390,23 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE
+ *
+ * @brief
+ *   Number of the most recently used CASE session resumption entries that
+ *   DefaultSessionResumptionStorage also keeps in memory, so that looking
+ *   them up does not read persistent storage.  Writes still go to persistent
+ *   storage.  Set to 0 to keep no entries in memory.
+ *
+ *   At most CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE entries are kept,
+ *   whatever the value.  Off by default, as every entry holds a shared
+ *   secret in RAM; host platforms such as Linux and Darwin enable it.
+ */
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE
+#define CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1350,6 +1427,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE
+ *
+ * @brief The number of events per event logging buffer for which the event
+ *   number, endpoint, cluster and encoded length are kept on the side.
+ *
+ * EventManagement::FetchEventsSince uses these entries to go straight to the
+ * events a reader may be interested in, without decoding the events that are
+ * older than the requested event number or belong to other clusters.  Events
+ * that do not have an entry, because more events than this are stored in a
+ * buffer, are decoded as before.  Each entry takes 16 bytes.  Setting this to 0
+ * disables the index.
+ *
+ */
+#ifndef CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE 16
+#endif /* CHIP_CONFIG_EVENT_FETCH_INDEX_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1506,6 +1601,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of recently resolved nodes for which address resolve keeps
+ *        the address found, so that looking them up again is answered
+ *        without waiting for DNSSD.  Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS
+ *
+ * @brief How long an address kept by the address resolve cache may be used,
+ *        in milliseconds.  Defaults to the TTL of operational DNSSD records.
+ *        Once half of it has elapsed, using the address also starts a DNSSD
+ *        lookup in the background to refresh it.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS 120000
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_TTL_MS
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1983,6 +2101,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MRP_ANALYTICS_ENABLED 0
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+ *
+ *  @brief
+ *    Enables code for measuring the round-trip time of MRP messages on each secure session,
+ *    and for basing retransmissions on those measurements instead of on the retransmission
+ *    intervals advertised by the peer.
+ *
+ * The measurements are only used once ReliableMessageMgr::SetAdaptiveRetransEnabled has been
+ * called; otherwise they are only reported to the ReliableMessageAnalyticsDelegate.
+ */
+
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
 /**
  *  @def CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
  *
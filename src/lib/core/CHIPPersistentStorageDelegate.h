@@ -110,6 +110,94 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Starts a batch of writes. Until the matching CommitBatch(), the implementation may
+     *   defer making the values set or deleted durable, so that all the writes of the batch
+     *   are made durable at once instead of one at a time.
+     *
+     *   Values set or deleted during a batch are visible to reads right away. Batches may be
+     *   nested, in which case the writes are made durable by the outermost CommitBatch().
+     *
+     *   Batching is only an optimization: the writes of a batch are not guaranteed to be
+     *   made durable all together, and if the device restarts before CommitBatch(), any of
+     *   them may be lost. The default implementation does nothing, so that every write is
+     *   made durable as soon as it is done.
+     *
+     *   Prefer ScopedPersistentStorageBatch over calling this directly.
+     *
+     * @return CHIP_NO_ERROR on success, in which case CommitBatch() or AbortBatch() must be
+     *         called later, or another CHIP_ERROR value from implementation on failure.
+     */
+    virtual CHIP_ERROR BeginBatch() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   Ends a batch of writes started by BeginBatch(), making the writes done since the
+     *   outermost BeginBatch() durable.
+     *
+     * @return CHIP_NO_ERROR on success, or another CHIP_ERROR value from implementation if
+     *         the writes could not be made durable.
+     */
+    virtual CHIP_ERROR CommitBatch() { return CHIP_NO_ERROR; }
+
+    /**
+     * @brief
+     *   Ends a batch of writes started by BeginBatch() without making its writes durable,
+     *   for instance when the operation doing them failed part of the way.
+     *
+     *   The writes are not rolled back: they stay visible to reads, and are made durable
+     *   by the next commit of the storage, if the device does not restart before.
+     */
+    virtual void AbortBatch() {}
+};
+
+/**
+ * Batches the writes made to a PersistentStorageDelegate until Commit() is called. Commit()
+ * must be called once all the writes succeeded, and its result checked. If the object goes
+ * out of scope without Commit(), as on an early return on error, the batch is aborted.
+ *
+ *     ScopedPersistentStorageBatch batch(storage);
+ *     ReturnErrorOnFailure(storage->SyncSetKeyValue(...));
+ *     ReturnErrorOnFailure(storage->SyncSetKeyValue(...));
+ *     return batch.Commit(); // Both values are made durable here.
+ */
+class ScopedPersistentStorageBatch
+{
+public:
+    explicit ScopedPersistentStorageBatch(PersistentStorageDelegate * storage) : mStorage(storage)
+    {
+        if ((mStorage != nullptr) && (mStorage->BeginBatch() != CHIP_NO_ERROR))
+        {
+            // Writes are then made durable one at a time.
+            mStorage = nullptr;
+        }
+    }
+
+    ~ScopedPersistentStorageBatch()
+    {
+        if (mStorage != nullptr)
+        {
+            mStorage->AbortBatch();
+        }
+    }
+
+    ScopedPersistentStorageBatch(const ScopedPersistentStorageBatch &)             = delete;
+    ScopedPersistentStorageBatch & operator=(const ScopedPersistentStorageBatch &) = delete;
+
+    /**
+     * Commits the batch. Does nothing if the batch was already committed.
+     */
+    [[nodiscard]] CHIP_ERROR Commit()
+    {
+        PersistentStorageDelegate * storage = mStorage;
+        mStorage                            = nullptr;
+        return (storage != nullptr) ? storage->CommitBatch() : CHIP_NO_ERROR;
+    }
+
+private:
+    PersistentStorageDelegate * mStorage;
 };
 
 } // namespace chip
@@ -69,6 +69,27 @@ TLVCircularBuffer::TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength
     mImplicitProfileId = kCommonProfileId;
 }
 
+/**
+ * @brief
+ *   TLVCircularBuffer constructor for a queue that already holds data
+ *
+ * This allows reading a range of the elements stored in another TLVCircularBuffer sharing the same backing store.
+ *
+ * @param[in] inBuffer       A pointer to the backing store for the queue
+ *
+ * @param[in] inBufferLength Length, in bytes, of the backing store
+ *
+ * @param[in] inHead         Initial point for the head.  The @a inHead pointer is must fall within the backing store for the
+ * circular buffer, i.e. within @a inBuffer and &(@a inBuffer[@a inBufferLength])
+ *
+ * @param[in] inDataLength   Length, in bytes, of the data stored in the queue starting at @a inHead, at most @a inBufferLength
+ */
+TLVCircularBuffer::TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead, uint32_t inDataLength) :
+    TLVCircularBuffer(inBuffer, inBufferLength, inHead)
+{
+    mQueueLength = inDataLength;
+}
+
 /**
  * @brief
  *   TLVCircularBuffer constructor
@@ -59,6 +59,7 @@ class DLL_EXPORT TLVCircularBuffer : public chip::TLV::TLVBackingStore
 public:
     TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength);
     TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead);
+    TLVCircularBuffer(uint8_t * inBuffer, uint32_t inBufferLength, uint8_t * inHead, uint32_t inDataLength);
 
     void Init(uint8_t * inBuffer, uint32_t inBufferLength);
     inline uint8_t * QueueHead() const { return mQueueHead; }
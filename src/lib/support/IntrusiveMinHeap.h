@@ -0,0 +1,262 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+
+class IntrusiveMinHeapBase;
+
+/**
+ * Hook for objects that can be put in an IntrusiveMinHeap.  An object can be in at most one heap at a time.
+ *
+ * The hook works like the auto-unlink mode of IntrusiveList: destroying an object removes it from the heap it is in.
+ */
+class IntrusiveMinHeapNode
+{
+public:
+    IntrusiveMinHeapNode() = default;
+    inline ~IntrusiveMinHeapNode();
+
+    IntrusiveMinHeapNode(const IntrusiveMinHeapNode &)             = delete;
+    IntrusiveMinHeapNode & operator=(const IntrusiveMinHeapNode &) = delete;
+
+    bool IsInHeap() const { return mHeap != nullptr; }
+
+    /// Removes the object from the heap it is in, if any.
+    inline void Unlink();
+
+private:
+    friend class IntrusiveMinHeapBase;
+
+    IntrusiveMinHeapBase * mHeap  = nullptr;
+    IntrusiveMinHeapNode * mPrev  = nullptr; // Parent for the first child, previous sibling otherwise, nullptr for the root
+    IntrusiveMinHeapNode * mChild = nullptr; // First child
+    IntrusiveMinHeapNode * mNext  = nullptr; // Next sibling
+};
+
+/**
+ * Pairing heap of IntrusiveMinHeapNode, used through IntrusiveMinHeap.
+ *
+ * Inserting an object and getting the smallest one take constant time, removing an object takes amortized logarithmic time.
+ * The heap does not allocate memory, so the number of objects it holds is only bounded by the number of objects.
+ */
+class IntrusiveMinHeapBase
+{
+public:
+    using LessFunction = bool (*)(const IntrusiveMinHeapNode & a, const IntrusiveMinHeapNode & b);
+
+    IntrusiveMinHeapBase(const IntrusiveMinHeapBase &)             = delete;
+    IntrusiveMinHeapBase & operator=(const IntrusiveMinHeapBase &) = delete;
+
+    bool Empty() const { return mRoot == nullptr; }
+    bool Contains(const IntrusiveMinHeapNode & aNode) const { return aNode.mHeap == this; }
+
+    /// Removes all objects from the heap, in linear time.
+    void Clear()
+    {
+        // Visit the tree depth first, chaining the siblings still to visit through mNext.
+        IntrusiveMinHeapNode * pending = mRoot;
+        mRoot                          = nullptr;
+        while (pending != nullptr)
+        {
+            IntrusiveMinHeapNode * node = pending;
+            pending                     = node->mNext;
+            if (node->mChild != nullptr)
+            {
+                IntrusiveMinHeapNode * last = node->mChild;
+                while (last->mNext != nullptr)
+                {
+                    last = last->mNext;
+                }
+                last->mNext = pending;
+                pending     = node->mChild;
+            }
+
+            node->mHeap  = nullptr;
+            node->mPrev  = nullptr;
+            node->mChild = nullptr;
+            node->mNext  = nullptr;
+        }
+    }
+
+protected:
+    friend class IntrusiveMinHeapNode;
+
+    explicit IntrusiveMinHeapBase(LessFunction aLess) : mLess(aLess) {}
+
+    ~IntrusiveMinHeapBase()
+    {
+        while (mRoot != nullptr)
+        {
+            Remove(*mRoot);
+        }
+    }
+
+    IntrusiveMinHeapNode * Top() const { return mRoot; }
+
+    void Insert(IntrusiveMinHeapNode & aNode)
+    {
+        VerifyOrDie(!aNode.IsInHeap());
+        aNode.mHeap = this;
+        mRoot       = Meld(mRoot, &aNode);
+    }
+
+    void Remove(IntrusiveMinHeapNode & aNode)
+    {
+        VerifyOrReturn(Contains(aNode));
+
+        IntrusiveMinHeapNode * children = MergePairs(aNode.mChild);
+        if (&aNode == mRoot)
+        {
+            mRoot = children;
+        }
+        else
+        {
+            if (aNode.mPrev->mChild == &aNode)
+            {
+                aNode.mPrev->mChild = aNode.mNext;
+            }
+            else
+            {
+                aNode.mPrev->mNext = aNode.mNext;
+            }
+            if (aNode.mNext != nullptr)
+            {
+                aNode.mNext->mPrev = aNode.mPrev;
+            }
+            mRoot = Meld(mRoot, children);
+        }
+
+        aNode.mHeap  = nullptr;
+        aNode.mPrev  = nullptr;
+        aNode.mChild = nullptr;
+        aNode.mNext  = nullptr;
+    }
+
+private:
+    // Makes the larger of two roots the first child of the other one, and returns the new root.
+    IntrusiveMinHeapNode * Meld(IntrusiveMinHeapNode * a, IntrusiveMinHeapNode * b) const
+    {
+        VerifyOrReturnValue(a != nullptr, b);
+        VerifyOrReturnValue(b != nullptr, a);
+        if (mLess(*b, *a))
+        {
+            IntrusiveMinHeapNode * smaller = b;
+            b                              = a;
+            a                              = smaller;
+        }
+
+        b->mPrev = a;
+        b->mNext = a->mChild;
+        if (a->mChild != nullptr)
+        {
+            a->mChild->mPrev = b;
+        }
+        a->mChild = b;
+        a->mPrev  = nullptr;
+        a->mNext  = nullptr;
+        return a;
+    }
+
+    // Melds a list of siblings into a single heap: first pairwise from left to right, then the pairs from right to left.
+    IntrusiveMinHeapNode * MergePairs(IntrusiveMinHeapNode * aFirst) const
+    {
+        IntrusiveMinHeapNode * pairs = nullptr;
+        while (aFirst != nullptr)
+        {
+            IntrusiveMinHeapNode * a = aFirst;
+            IntrusiveMinHeapNode * b = a->mNext;
+            aFirst                   = (b != nullptr) ? b->mNext : nullptr;
+
+            a->mPrev = a->mNext = nullptr;
+            if (b != nullptr)
+            {
+                b->mPrev = b->mNext = nullptr;
+            }
+
+            IntrusiveMinHeapNode * pair = Meld(a, b);
+            pair->mNext                 = pairs;
+            pairs                       = pair;
+        }
+
+        IntrusiveMinHeapNode * root = nullptr;
+        while (pairs != nullptr)
+        {
+            IntrusiveMinHeapNode * pair = pairs;
+            pairs                       = pair->mNext;
+            pair->mNext                 = nullptr;
+            root                        = Meld(root, pair);
+        }
+        return root;
+    }
+
+    LessFunction mLess;
+    IntrusiveMinHeapNode * mRoot = nullptr;
+};
+
+inline IntrusiveMinHeapNode::~IntrusiveMinHeapNode()
+{
+    Unlink();
+}
+
+inline void IntrusiveMinHeapNode::Unlink()
+{
+    if (mHeap != nullptr)
+    {
+        mHeap->Remove(*this);
+    }
+}
+
+/**
+ * Min-heap of objects of type T, which must derive from IntrusiveMinHeapNode, ordered by Compare.  Compare must be a default
+ * constructible function object returning whether its first argument is smaller than its second one.
+ *
+ * The heap does not own its objects.  When the key of an object in the heap changes, Update must be called to restore the
+ * heap order.
+ */
+template <typename T, typename Compare>
+class IntrusiveMinHeap : public IntrusiveMinHeapBase
+{
+public:
+    IntrusiveMinHeap() : IntrusiveMinHeapBase(&Less) {}
+
+    /// Returns the smallest object, or nullptr if the heap is empty.
+    T * Top() const { return static_cast<T *>(IntrusiveMinHeapBase::Top()); }
+
+    /// Inserts an object that is not in any heap.
+    void Insert(T & aItem) { IntrusiveMinHeapBase::Insert(aItem); }
+
+    /// Removes an object from this heap.  Does nothing if the object is not in this heap.
+    void Remove(T & aItem) { IntrusiveMinHeapBase::Remove(aItem); }
+
+    /// Moves an object to its place in this heap after its key changed, removing it from any other heap it was in.
+    void Update(T & aItem)
+    {
+        aItem.Unlink();
+        IntrusiveMinHeapBase::Insert(aItem);
+    }
+
+private:
+    static bool Less(const IntrusiveMinHeapNode & a, const IntrusiveMinHeapNode & b)
+    {
+        return Compare()(static_cast<const T &>(a), static_cast<const T &>(b));
+    }
+};
+
+} // namespace chip
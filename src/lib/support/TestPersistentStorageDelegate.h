@@ -88,6 +88,10 @@ public:
         }
 
         CHIP_ERROR err = SyncSetKeyValueInternal(key, value, size);
+        if (err == CHIP_NO_ERROR)
+        {
+            CountCommit();
+        }
 
         if (mLoggingLevel >= LoggingLevel::kLogMutationAndReads)
         {
@@ -108,6 +112,10 @@ public:
             ChipLogDetail(Test, "TestPersistentStorageDelegate::SyncDeleteKeyValue, Delete key '%s'", StringOrNullMarker(key));
         }
         CHIP_ERROR err = SyncDeleteKeyValueInternal(key);
+        if (err == CHIP_NO_ERROR)
+        {
+            CountCommit();
+        }
 
         if (mLoggingLevel >= LoggingLevel::kLogMutation)
         {
@@ -126,6 +134,31 @@ public:
         return err;
     }
 
+    CHIP_ERROR BeginBatch() override
+    {
+        mBatchDepth++;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR CommitBatch() override
+    {
+        VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+        mBatchDepth--;
+        if ((mBatchDepth == 0) && mBatchHasWrites)
+        {
+            mBatchHasWrites = false;
+            mNumCommits++;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    void AbortBatch() override
+    {
+        // The writes of the batch are left to the next commit.
+        VerifyOrReturn(mBatchDepth > 0);
+        mBatchDepth--;
+    }
+
     /**
      * @brief Adds a "poison key": a key that, if read/written, implies some bad
      *        behavior occurred.
@@ -179,6 +212,17 @@ public:
      */
     virtual bool HasKey(const std::string & key) { return (mStorage.find(key) != mStorage.end()); }
 
+    /**
+     * @return the number of times the storage would have been committed: once per successful
+     *         set or delete outside of a batch, and once per batch with at least one of them
+     */
+    virtual size_t GetNumCommits() { return mNumCommits; }
+
+    /**
+     * @return true if a batch started with BeginBatch() was not committed or aborted yet
+     */
+    virtual bool IsBatching() { return mBatchDepth > 0; }
+
     /**
      * @brief Set the logging verbosity for debugging
      *
@@ -276,10 +320,26 @@ protected:
         return CHIP_NO_ERROR;
     }
 
+    void CountCommit()
+    {
+        if (mBatchDepth > 0)
+        {
+            mBatchHasWrites = true;
+        }
+        else
+        {
+            mBatchHasWrites = false;
+            mNumCommits++;
+        }
+    }
+
     std::map<std::string, std::vector<uint8_t>> mStorage;
     std::set<std::string> mPoisonKeys;
     bool mRejectWrites         = false;
     LoggingLevel mLoggingLevel = LoggingLevel::kDisabled;
+    size_t mNumCommits         = 0;
+    unsigned mBatchDepth       = 0;
+    bool mBatchHasWrites       = false;
 };
 
 } // namespace chip
@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ctime>
+#include <set>
+#include <utility>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/IntrusiveMinHeap.h>
+
+namespace {
+
+using namespace chip;
+
+class TestIntrusiveMinHeap : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        unsigned seed = static_cast<unsigned>(std::time(nullptr));
+        printf("Running " __FILE__ " using seed %d \n", seed);
+        std::srand(seed);
+    }
+};
+
+struct HeapNode : public IntrusiveMinHeapNode
+{
+    int mKey = 0;
+};
+
+struct HeapNodeCompare
+{
+    bool operator()(const HeapNode & a, const HeapNode & b) const { return a.mKey < b.mKey; }
+};
+
+using Heap = IntrusiveMinHeap<HeapNode, HeapNodeCompare>;
+
+TEST_F(TestIntrusiveMinHeap, TestIntrusiveMinHeapRandom)
+{
+    Heap heap;
+    HeapNode nodes[100];
+    std::set<std::pair<int, HeapNode *>> reference;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        HeapNode & node = nodes[static_cast<size_t>(std::rand()) % MATTER_ARRAY_SIZE(nodes)];
+        switch (std::rand() % 4)
+        {
+        case 0: // Insert or update
+            reference.erase({ node.mKey, &node });
+            node.mKey = std::rand() % 1000;
+            heap.Update(node);
+            reference.insert({ node.mKey, &node });
+            break;
+        case 1: // Remove
+            reference.erase({ node.mKey, &node });
+            heap.Remove(node);
+            break;
+        case 2: // Remove the smallest
+            if (!reference.empty())
+            {
+                HeapNode * top = heap.Top();
+                ASSERT_NE(top, nullptr);
+                reference.erase({ top->mKey, top });
+                heap.Remove(*top);
+            }
+            break;
+        default:
+            break;
+        }
+
+        EXPECT_EQ(heap.Contains(node), reference.count({ node.mKey, &node }) == 1);
+        ASSERT_EQ(heap.Empty(), reference.empty());
+        if (!reference.empty())
+        {
+            EXPECT_EQ(heap.Top()->mKey, reference.begin()->first);
+        }
+    }
+
+    // Draining the heap visits the nodes in increasing order.
+    int previous = -1;
+    while (HeapNode * top = heap.Top())
+    {
+        EXPECT_LE(previous, top->mKey);
+        previous = top->mKey;
+        heap.Remove(*top);
+        EXPECT_FALSE(top->IsInHeap());
+    }
+}
+
+TEST_F(TestIntrusiveMinHeap, TestIntrusiveMinHeapAutoUnlink)
+{
+    Heap heap;
+    HeapNode first;
+    first.mKey = 2;
+    heap.Insert(first);
+
+    {
+        HeapNode second;
+        second.mKey = 1;
+        heap.Insert(second);
+        EXPECT_EQ(heap.Top(), &second);
+    }
+
+    EXPECT_EQ(heap.Top(), &first);
+    first.Unlink();
+    EXPECT_TRUE(heap.Empty());
+}
+
+TEST_F(TestIntrusiveMinHeap, TestIntrusiveMinHeapClear)
+{
+    Heap heap;
+    HeapNode nodes[20];
+
+    for (auto & node : nodes)
+    {
+        node.mKey = std::rand() % 10;
+        heap.Insert(node);
+    }
+    // Give the tree some depth.
+    heap.Remove(*heap.Top());
+
+    heap.Clear();
+    EXPECT_TRUE(heap.Empty());
+    for (auto & node : nodes)
+    {
+        EXPECT_FALSE(node.IsInHeap());
+    }
+
+    // The nodes can be used again.
+    heap.Insert(nodes[1]);
+    EXPECT_EQ(heap.Top(), &nodes[1]);
+}
+
+TEST_F(TestIntrusiveMinHeap, TestIntrusiveMinHeapMoveBetweenHeaps)
+{
+    Heap heap1;
+    Heap heap2;
+    HeapNode nodes[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        nodes[i].mKey = i;
+        heap1.Insert(nodes[i]);
+    }
+
+    // Update moves a node out of the heap it was in, and Remove ignores nodes of other heaps.
+    heap2.Update(nodes[0]);
+    EXPECT_TRUE(heap2.Contains(nodes[0]));
+    EXPECT_FALSE(heap1.Contains(nodes[0]));
+    heap1.Remove(nodes[0]);
+    EXPECT_TRUE(heap2.Contains(nodes[0]));
+    EXPECT_EQ(heap1.Top(), &nodes[1]);
+    EXPECT_EQ(heap2.Top(), &nodes[0]);
+}
+
+} // namespace
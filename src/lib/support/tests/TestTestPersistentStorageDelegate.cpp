@@ -341,4 +341,61 @@ TEST(TestTestPersistentStorageDelegate, TestClearStorage)
     EXPECT_EQ(size, sizeof(buf));
 }
 
+TEST(TestTestPersistentStorageDelegate, TestBatch)
+{
+    TestPersistentStorageDelegate storage;
+    static const char kValue[] = "abcd";
+
+    // Outside of a batch, every write is committed on its own
+    EXPECT_EQ(storage.SyncSetKeyValue("key1", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.SyncSetKeyValue("key2", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumCommits(), 2u);
+
+    // Writes in nested batches are committed once by the outermost batch, and are readable before
+    {
+        ScopedPersistentStorageBatch batch(&storage);
+        EXPECT_EQ(storage.SyncSetKeyValue("key3", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+        {
+            ScopedPersistentStorageBatch nestedBatch(&storage);
+            EXPECT_EQ(storage.SyncDeleteKeyValue("key1"), CHIP_NO_ERROR);
+            EXPECT_EQ(nestedBatch.Commit(), CHIP_NO_ERROR);
+        }
+        EXPECT_TRUE(storage.IsBatching());
+        EXPECT_EQ(storage.SyncSetKeyValue("key2", kValue, 1), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.GetNumCommits(), 2u);
+        EXPECT_TRUE(storage.SyncDoesKeyExist("key3"));
+        EXPECT_FALSE(storage.SyncDoesKeyExist("key1"));
+        EXPECT_EQ(batch.Commit(), CHIP_NO_ERROR);
+        EXPECT_EQ(batch.Commit(), CHIP_NO_ERROR);
+    }
+    EXPECT_FALSE(storage.IsBatching());
+    EXPECT_EQ(storage.GetNumCommits(), 3u);
+
+    // A batch going out of scope without Commit() is aborted: its writes are kept, but left to the next commit
+    {
+        ScopedPersistentStorageBatch batch(&storage);
+        EXPECT_EQ(storage.SyncSetKeyValue("key4", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    }
+    EXPECT_FALSE(storage.IsBatching());
+    EXPECT_EQ(storage.GetNumCommits(), 3u);
+    EXPECT_TRUE(storage.SyncDoesKeyExist("key4"));
+    EXPECT_EQ(storage.SyncSetKeyValue("key5", kValue, sizeof(kValue)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetNumCommits(), 4u);
+
+    // Failed writes and empty batches are not committed
+    storage.AddPoisonKey("poison");
+    {
+        ScopedPersistentStorageBatch batch(&storage);
+        EXPECT_EQ(storage.SyncSetKeyValue("poison", kValue, sizeof(kValue)), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+        EXPECT_EQ(batch.Commit(), CHIP_NO_ERROR);
+        EXPECT_FALSE(storage.IsBatching());
+    }
+    EXPECT_EQ(storage.GetNumCommits(), 4u);
+    EXPECT_EQ(storage.CommitBatch(), CHIP_ERROR_INCORRECT_STATE);
+
+    // A null storage is ignored
+    ScopedPersistentStorageBatch nullBatch(nullptr);
+    EXPECT_EQ(nullBatch.Commit(), CHIP_NO_ERROR);
+}
+
 } // namespace
@@ -51,7 +51,7 @@ namespace Messaging {
  *    prior to use.
  *
  */
-ExchangeManager::ExchangeManager() : mReliableMessageMgr(mContextPool)
+ExchangeManager::ExchangeManager()
 {
     mState = State::kState_NotInitialized;
 }
@@ -197,6 +197,11 @@ CHIP_ERROR ExchangeManager::UnregisterUMH(Protocols::Id protocolId, int16_t msgT
     return CHIP_ERROR_NO_UNSOLICITED_MESSAGE_HANDLER;
 }
 
+void ExchangeManager::OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err)
+{
+    mReliableMessageMgr.OnMessageSendFailed(msgBuf, err);
+}
+
 void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                         const SessionHandle & session, DuplicateMessage isDuplicate,
                                         System::PacketBufferHandle && msgBuf)
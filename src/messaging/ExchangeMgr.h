@@ -255,6 +255,7 @@ private:
 
     void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader, const SessionHandle & session,
                            DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override;
+    void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err) override;
     void SendStandaloneAckIfNeeded(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                    const SessionHandle & session, MessageFlags msgFlags, System::PacketBufferHandle && msgBuf);
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -76,6 +76,13 @@ public:
         // that have elapsed between when the initial message was sent and when we received
         // acknowledgment for the message.
         std::optional<System::Clock::Milliseconds64> ackLatencyMs;
+        // When eventType is kAcknowledged and round-trip times have been measured on the session (see
+        // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED), these will be populated with the smoothed round-trip time,
+        // its variation and the number of messages that may be retransmitted at the same time, including this
+        // acknowledgment.
+        std::optional<System::Clock::Milliseconds32> smoothedRttMs;
+        std::optional<System::Clock::Milliseconds32> rttVariationMs;
+        std::optional<uint8_t> retransmissionWindow;
     };
 
     virtual void OnTransmitEvent(const TransmitEvent & event) = 0;
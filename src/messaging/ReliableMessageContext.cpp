@@ -166,9 +166,9 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
     }
 
     // Replace the Pending ack message counter.
-    SetPendingPeerAckMessageCounter(messageCounter);
     using namespace System::Clock::Literals;
     mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    SetPendingPeerAckMessageCounter(messageCounter);
     return CHIP_NO_ERROR;
 }
 
@@ -207,6 +207,7 @@ void ReliableMessageContext::SetPendingPeerAckMessageCounter(uint32_t aPeerAckMe
     mPendingPeerAckMessageCounter = aPeerAckMessageCounter;
     SetAckPending(true);
     mFlags.Set(Flags::kFlagAckMessageCounterIsValid);
+    GetReliableMessageMgr()->ScheduleAck(*this);
 }
 
 } // namespace Messaging
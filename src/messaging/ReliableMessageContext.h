@@ -31,6 +31,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/ReferenceCounted.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveMinHeap.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <system/SystemLayer.h>
 #include <transport/raw/MessageHeader.h>
@@ -48,7 +49,11 @@ class ExchangeContext;
 enum class MessageFlagValues : uint32_t;
 class ReliableMessageMgr;
 
-class ReliableMessageContext
+/**
+ * While an acknowledgment is pending, the context is queued in its ReliableMessageMgr by the time the acknowledgment has to
+ * be sent as a standalone message.
+ */
+class ReliableMessageContext : public IntrusiveMinHeapNode
 {
 public:
     ReliableMessageContext();
@@ -246,6 +251,11 @@ inline void ReliableMessageContext::SetAutoRequestAck(bool autoReqAck)
 inline void ReliableMessageContext::SetAckPending(bool inAckPending)
 {
     mFlags.Set(Flags::kFlagAckPending, inAckPending);
+    if (!inAckPending)
+    {
+        // There is no standalone ack to send anymore.
+        Unlink();
+    }
 }
 
 inline bool ReliableMessageContext::IsEphemeralExchange() const
@@ -49,6 +49,9 @@ namespace chip {
 namespace Messaging {
 
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+bool ReliableMessageMgr::sAdaptiveRetransEnabled = false;
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
     ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
@@ -61,9 +64,7 @@ ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
     ec->SetWaitingForAck(false);
 }
 
-ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
-    mContextPool(contextPool), mSystemLayer(nullptr)
-{}
+ReliableMessageMgr::ReliableMessageMgr() : mSystemLayer(nullptr) {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
 
@@ -135,6 +136,15 @@ void ReliableMessageMgr::NotifyMessageSendAnalytics(const RetransTableEntry & en
     {
         auto now           = System::SystemClock().GetMonotonicTimestamp();
         event.ackLatencyMs = now - entry.initialSentTime;
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+        const auto & estimator = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate())
+        {
+            event.smoothedRttMs        = estimator.GetSmoothedRtt();
+            event.rttVariationMs       = estimator.GetRttVariation();
+            event.retransmissionWindow = estimator.GetWindow();
+        }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
     }
 
     mAnalyticsDelegate->OnTransmitEvent(event);
@@ -149,23 +159,40 @@ void ReliableMessageMgr::ExecuteActions()
     ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions at 0x" ChipLogFormatX64 "ms", ChipLogValueX64(now.count()));
 #endif
 
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
-        if (rc->IsAckPending())
-        {
-            if (rc->mNextAckTime <= now)
-            {
+    // Take everything that is due out of the queues first, so that each ack and retransmission is tried at most once
+    // per tick, like when every exchange context and retrans table entry was checked on each tick.
+    AckQueue dueAcks;
+    for (ReliableMessageContext * rc = mAckQueue.Top(); rc != nullptr && IsDue(rc->mNextAckTime, now); rc = mAckQueue.Top())
+    {
+        dueAcks.Update(*rc);
+    }
+
+    RetransQueue dueRetrans;
+    for (RetransTableEntry * entry = mRetransQueue.Top(); entry != nullptr && IsDue(entry->nextRetransTime, now);
+         entry                     = mRetransQueue.Top())
+    {
+        dueRetrans.Update(*entry);
+    }
+
+    for (ReliableMessageContext * rc = dueAcks.Top(); rc != nullptr; rc = dueAcks.Top())
+    {
+        dueAcks.Remove(*rc);
 #if defined(RMP_TICKLESS_DEBUG)
-                ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
+        ChipLogDetail(ExchangeManager, "ReliableMessageMgr::ExecuteActions sending ACK %p", rc);
 #endif
-                TEMPORARY_RETURN_IGNORED rc->SendStandaloneAckMessage();
-            }
+        TEMPORARY_RETURN_IGNORED rc->SendStandaloneAckMessage();
+
+        // An ack that could not be sent is tried again on the next tick.
+        if (rc->IsAckPending() && !rc->IsInHeap())
+        {
+            mAckQueue.Insert(*rc);
         }
-    });
+    }
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
+    for (RetransTableEntry * entry = dueRetrans.Top(); entry != nullptr; entry = dueRetrans.Top())
+    {
+        dueRetrans.Remove(*entry);
 
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
@@ -214,9 +241,19 @@ void ReliableMessageMgr::ExecuteActions()
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
             mRetransTable.ReleaseObject(entry);
 
-            return Loop::Continue;
+            continue;
         }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+        if (sendCount == 0 && !CanStartRetransmitting(session))
+        {
+            // Enough messages to this peer are being retransmitted already; wait for another timeout rather than add to the
+            // congestion.
+            CalculateNextRetransTime(*entry);
+            continue;
+        }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
         entry->sendCount++;
 
         ChipLogProgress(ExchangeManager,
@@ -227,9 +264,7 @@ void ReliableMessageMgr::ExecuteActions()
         MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
         TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -326,11 +361,23 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
     return std::chrono::duration_cast<System::Clock::Timeout>(mrpBackoffTime);
 }
 
+bool ReliableMessageMgr::AckTimeCompare::operator()(const ReliableMessageContext & a, const ReliableMessageContext & b) const
+{
+    return a.mNextAckTime < b.mNextAckTime;
+}
+
+void ReliableMessageMgr::ScheduleAck(ReliableMessageContext & rc)
+{
+    mAckQueue.Update(rc);
+}
+
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
     CalculateNextRetransTime(*entry);
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
     entry->initialSentTime = System::SystemClock().GetMonotonicTimestamp();
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     NotifyMessageSendAnalytics(*entry, entry->ec->GetSessionHandle(), ReliableMessageAnalyticsDelegate::EventType::kInitialSend);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     StartTimer();
@@ -342,6 +389,9 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+            OnRetransTableEntryAcked(*entry);
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
             auto session = entry->ec->GetSessionHandle();
             NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kAcknowledged);
@@ -423,6 +473,29 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
     return err;
 }
 
+void ReliableMessageMgr::OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err)
+{
+    mRetransTable.ForEachActiveObject([&](auto * entry) {
+        if (!entry->retainedBuf.SharesBufferWith(msgBuf))
+        {
+            return Loop::Continue;
+        }
+
+        if (MapSendError(err, entry->ec->GetExchangeId(), entry->ec->IsInitiator()) != CHIP_NO_ERROR)
+        {
+            // Using same error message for all errors to reduce code size.
+            ChipLogError(ExchangeManager,
+                         "Crit-err %" CHIP_ERROR_FORMAT " when sending CHIP MessageCounter:" ChipLogFormatMessageCounter
+                         " on exchange " ChipLogFormatExchange ", send tries: %d",
+                         err.Format(), entry->retainedBuf.GetMessageCounter(), ChipLogValueExchange(&entry->ec.Get()),
+                         entry->sendCount);
+
+            ClearRetransTable(*entry);
+        }
+        return Loop::Break;
+    });
+}
+
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
     mRetransTable.ForEachActiveObject([&](auto * entry) {
@@ -447,21 +520,18 @@ void ReliableMessageMgr::StartTimer()
     // When do we need to next wake up to send an ACK?
     System::Clock::Timestamp nextWakeTime = System::Clock::Timestamp::max();
 
-    ExecuteForAllContext([&](ReliableMessageContext * rc) {
-        if (rc->IsAckPending() && rc->mNextAckTime < nextWakeTime)
-        {
-            nextWakeTime = rc->mNextAckTime;
-        }
-    });
+    const ReliableMessageContext * rc = mAckQueue.Top();
+    if (rc != nullptr)
+    {
+        nextWakeTime = rc->mNextAckTime;
+    }
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    const RetransTableEntry * entry = mRetransQueue.Top();
+    if (entry != nullptr && entry->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = entry->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -556,8 +626,23 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
         baseTimeout = sessionHandle->GetMRPBaseTimeout();
     }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+    // Once round trips have been measured on the session, they are a better base for the retransmissions to an active peer
+    // than the interval it advertised.  An idle peer may be asleep, so its idle interval is kept.
+    if (sAdaptiveRetransEnabled && sessionHandle->IsSecureSession())
+    {
+        auto * secureSession   = sessionHandle->AsSecureSession();
+        const auto & estimator = secureSession->GetRttEstimator();
+        if (estimator.HasEstimate() && (entry.ec->HasReceivedAtLeastOneMessage() || secureSession->IsPeerActive()))
+        {
+            baseTimeout = estimator.GetRetransTimeout();
+        }
+    }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    mRetransQueue.Update(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -587,6 +672,55 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+void ReliableMessageMgr::OnRetransTableEntryAcked(const RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.ec->HasSessionHandle());
+    const auto session = entry.ec->GetSessionHandle();
+    VerifyOrReturn(session->IsSecureSession());
+
+    auto & estimator = session->AsSecureSession()->GetRttEstimator();
+    // Karn's algorithm: the ack of a retransmitted message could be for any of its transmissions, so it is no measure of the
+    // round-trip time.
+    if (entry.sendCount == 0)
+    {
+        estimator.AddSample(System::SystemClock().GetMonotonicTimestamp() - entry.initialSentTime);
+    }
+    estimator.OnAcknowledged();
+}
+
+bool ReliableMessageMgr::CanStartRetransmitting(const SessionHandle & session)
+{
+    VerifyOrReturnValue(session->IsSecureSession(), true);
+    auto & estimator = session->AsSecureSession()->GetRttEstimator();
+
+    if (sAdaptiveRetransEnabled)
+    {
+        // Messages already being retransmitted are never held back, so that they always make progress.
+        unsigned retransmitting = 0;
+        mRetransTable.ForEachActiveObject([&](auto * other) {
+            if (other->sendCount > 0 && other->ec->HasSessionHandle() && other->ec->GetSessionHandle() == session)
+            {
+                retransmitting++;
+            }
+            return (retransmitting < estimator.GetWindow()) ? Loop::Continue : Loop::Break;
+        });
+        VerifyOrReturnValue(retransmitting < estimator.GetWindow(), false);
+    }
+
+    estimator.OnRetransmission();
+    return true;
+}
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
+bool ReliableMessageMgr::IsDue(System::Clock::Timestamp deadline, System::Clock::Timestamp now)
+{
+#if CHIP_CONFIG_TEST
+    mTestNumDeadlinesChecked++;
+#endif // CHIP_CONFIG_TEST
+    return deadline <= now;
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/IntrusiveMinHeap.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageAnalyticsDelegate.h>
@@ -56,8 +57,10 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Once its message is sent, the entry is queued by its next retransmission time.
+     *
      */
-    struct RetransTableEntry
+    struct RetransTableEntry : public IntrusiveMinHeapNode
     {
         RetransTableEntry(ReliableMessageContext * rc);
         ~RetransTableEntry();
@@ -67,21 +70,21 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
-#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
-#endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED || CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
     };
 
-    ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
+    ReliableMessageMgr();
     ~ReliableMessageMgr();
 
     void Init(chip::System::Layer * systemLayer);
     void Shutdown();
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.  If an
-     * action needs to be triggered by ReliableMessageProtocol time facilities,
-     * execute that action.
+     * Send the standalone acks and retransmissions whose time has come.  Only
+     * the exchange contexts and retrans table entries that are due are
+     * visited.
      */
     void ExecuteActions();
 
@@ -148,6 +151,15 @@ public:
      */
     CHIP_ERROR SendFromRetransTable(RetransTableEntry * entry);
 
+    /**
+     *  Handle the failure of a send that the transport completed after SendPreparedMessage returned.  If the message
+     *  is in the retransmission table, the error is handled as SendFromRetransTable handles it.
+     *
+     *  @param[in]    msgBuf    The buffer that could not be sent.
+     *  @param[in]    err       The reason why it could not be sent.
+     */
+    void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err);
+
     /**
      *  Clear entries matching a specified ExchangeContext.
      *
@@ -165,10 +177,10 @@ public:
     void ClearRetransTable(RetransTableEntry & rEntry);
 
     /**
-     * Iterate through active exchange contexts and retrans table entries.
      * Determine how many ReliableMessageProtocol ticks we need to sleep before we
-     * need to physically wake the CPU to perform an action.  Set a timer to go off
-     * when we next need to wake the system.
+     * need to physically wake the CPU to perform an action, from the earliest
+     * pending ack and retransmission.  Set a timer to go off when we next need to
+     * wake the system.
      *
      */
     void StartTimer();
@@ -209,6 +221,10 @@ public:
     // Functions for testing
     int TestGetCountRetransTable();
 
+    // Number of pending acks and retransmissions whose deadline ExecuteActions
+    // compared with the current time, which is the work it does per tick.
+    size_t TestGetNumDeadlinesChecked() const { return mTestNumDeadlinesChecked; }
+
     // Enumerate the retransmission table.  Clearing an entry while enumerating
     // that entry is allowed.  F must take a RetransTableEntry as an argument
     // and return Loop::Continue or Loop::Break.
@@ -234,27 +250,78 @@ public:
      */
     static void SetAdditionalMRPBackoffTime(const Optional<System::Clock::Timeout> & additionalTime);
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+    /**
+     * Enable or disable basing the retransmissions over secure sessions on the
+     * round-trip times measured on each session.
+     *
+     * When enabled, once a message to an active peer has been acknowledged, the
+     * retransmission timeout of the session is derived from the measured
+     * round-trip times instead of the active interval advertised by the peer, and
+     * the number of messages to the peer that may be retransmitted at the same
+     * time is limited by the window of the session.  Messages to idle peers keep
+     * using the idle interval advertised by the peer.
+     *
+     * Disabled by default.  This is a static for the same reason as
+     * SetAdditionalMRPBackoffTime.
+     */
+    static void SetAdaptiveRetransEnabled(bool enabled) { sAdaptiveRetransEnabled = enabled; }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
 private:
+    friend class ReliableMessageContext;
+
+    struct AckTimeCompare
+    {
+        bool operator()(const ReliableMessageContext & a, const ReliableMessageContext & b) const;
+    };
+
+    struct RetransTimeCompare
+    {
+        bool operator()(const RetransTableEntry & a, const RetransTableEntry & b) const
+        {
+            return a.nextRetransTime < b.nextRetransTime;
+        }
+    };
+
+    using AckQueue     = IntrusiveMinHeap<ReliableMessageContext, AckTimeCompare>;
+    using RetransQueue = IntrusiveMinHeap<RetransTableEntry, RetransTimeCompare>;
+
+    /**
+     * Queues the context by the time its pending ack has to be sent, or moves it
+     * in the queue if that time changed.
+     *
+     * @param[in] rc ReliableMessageContext with a pending ack
+     */
+    void ScheduleAck(ReliableMessageContext & rc);
+
     /**
      * Calculates the next retransmission time for the entry
-     * Function sets the nextRetransTime of the entry
+     * Function sets the nextRetransTime of the entry and queues the entry by it
      *
      * @param[in,out] entry RetransTableEntry for which we need to calculate the nextRetransTime
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
-    ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
-    chip::System::Layer * mSystemLayer;
+    /**
+     * Whether an ack or retransmission with the given deadline has to be sent now.
+     */
+    bool IsDue(System::Clock::Timestamp deadline, System::Clock::Timestamp now);
 
-    /* Placeholder function to run a function for all exchanges */
-    template <typename Function>
-    void ExecuteForAllContext(Function function)
-    {
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            function(ec->GetReliableMessageContext());
-            return Loop::Continue;
-        });
-    }
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+    /**
+     * Updates the round-trip time estimate of the session of an entry whose message was just acknowledged.
+     */
+    void OnRetransTableEntryAcked(const RetransTableEntry & entry);
+
+    /**
+     * Checks whether a message that was sent once can be retransmitted now over the session, given the window of the
+     * session, and shrinks the window if so.
+     */
+    bool CanStartRetransmitting(const SessionHandle & session);
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
+    chip::System::Layer * mSystemLayer;
 
     void TicklessDebugDumpRetransTable(const char * log);
 
@@ -266,12 +333,24 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+    // Contexts with a pending ack, by the time the ack is due
+    AckQueue mAckQueue;
+    // Sent retrans table entries, by their next retransmission time
+    RetransQueue mRetransQueue;
+
+#if CHIP_CONFIG_TEST
+    size_t mTestNumDeadlinesChecked = 0;
+#endif // CHIP_CONFIG_TEST
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
     static System::Clock::Timeout sAdditionalMRPBackoffTime;
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+    static bool sAdaptiveRetransEnabled;
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
 };
 
 } // namespace Messaging
@@ -183,6 +183,54 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    The smallest retransmission timeout derived from the measured round-trip
+ *    time of a session, when CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED is set.
+ *
+ *  This keeps a few very fast round trips from making the retransmissions
+ *  faster than the peer can reasonably be expected to acknowledge.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT (100_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    The largest retransmission timeout derived from the measured round-trip
+ *    time of a session, when CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED is set.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT (5000_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW
+ *
+ *  @brief
+ *    The number of messages to a peer that may be retransmitted at the same time
+ *    before anything is known about the losses on the session, when
+ *    CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED is set.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW
+#define CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW (4)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW
+ *
+ *  @brief
+ *    The largest number of messages to a peer that may be retransmitted at the
+ *    same time, when CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED is set.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW
+#define CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW (16)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
@@ -0,0 +1,114 @@
+/*
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the per-session round-trip time estimator used by the
+ *      CHIP Reliable Messaging Protocol when CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED is set.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <stdint.h>
+
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ * Round-trip time estimate and retransmission window of the messages sent to a peer over one session.
+ *
+ * The smoothed round-trip time (SRTT) and its variation (RTTVAR) are computed as in RFC 6298, from the acknowledgements of
+ * messages that were sent only once.  The retransmission timeout is SRTT + 4 * RTTVAR, kept between
+ * CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT and CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT.
+ *
+ * The window is the number of messages to the peer that may be retransmitted at the same time.  It grows by one with every
+ * acknowledged message, up to CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW, and is halved every time a message has to be retransmitted.
+ */
+class ReliableMessageRttEstimator
+{
+public:
+    bool HasEstimate() const { return mHasEstimate; }
+
+    /**
+     * Takes into account the time it took to get a message acknowledged.  Must only be called for messages that were not
+     * retransmitted, since the acknowledgement of a retransmitted message cannot be matched to one of its transmissions.
+     */
+    void AddSample(System::Clock::Milliseconds32 rtt)
+    {
+        uint32_t sample = std::min<uint32_t>(rtt.count(), kMaxSample);
+        if (!mHasEstimate)
+        {
+            // SRTT = R, RTTVAR = R / 2
+            mScaledSrtt   = sample << kSrttShift;
+            mScaledRttVar = (sample << kRttVarShift) / 2;
+            mHasEstimate  = true;
+            return;
+        }
+
+        uint32_t srtt  = mScaledSrtt >> kSrttShift;
+        uint32_t delta = (sample > srtt) ? sample - srtt : srtt - sample;
+
+        // RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R|, then SRTT = 7/8 * SRTT + 1/8 * R
+        mScaledRttVar = mScaledRttVar - (mScaledRttVar >> kRttVarShift) + delta;
+        mScaledSrtt   = mScaledSrtt - (mScaledSrtt >> kSrttShift) + sample;
+    }
+
+    System::Clock::Milliseconds32 GetSmoothedRtt() const { return System::Clock::Milliseconds32(mScaledSrtt >> kSrttShift); }
+    System::Clock::Milliseconds32 GetRttVariation() const { return System::Clock::Milliseconds32(mScaledRttVar >> kRttVarShift); }
+
+    /**
+     * The base interval to use for retransmissions, only meaningful once HasEstimate() is true.
+     */
+    System::Clock::Milliseconds32 GetRetransTimeout() const
+    {
+        using namespace System::Clock::Literals;
+
+        // The variation is kept multiplied by 4, which is the factor RFC 6298 applies to it.
+        System::Clock::Milliseconds32 timeout(static_cast<uint32_t>(mScaledSrtt >> kSrttShift) + mScaledRttVar);
+        return std::clamp<System::Clock::Milliseconds32>(timeout, CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT,
+                                                         CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT);
+    }
+
+    uint8_t GetWindow() const { return mWindow; }
+
+    void OnAcknowledged()
+    {
+        if (mWindow < CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW)
+        {
+            mWindow++;
+        }
+    }
+
+    void OnRetransmission() { mWindow = static_cast<uint8_t>(std::max(mWindow / 2, 1)); }
+
+private:
+    static constexpr uint32_t kSrttShift   = 3; // SRTT is kept multiplied by 8
+    static constexpr uint32_t kRttVarShift = 2; // RTTVAR is kept multiplied by 4
+    static constexpr uint32_t kMaxSample   = UINT16_MAX;
+
+    uint32_t mScaledSrtt   = 0;
+    uint32_t mScaledRttVar = 0;
+    uint8_t mWindow        = CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW;
+    bool mHasEstimate      = false;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -21,7 +21,9 @@
  *      This file implements unit tests for the ReliableMessageProtocol
  *      implementation.
  */
+#include <algorithm>
 #include <queue>
+#include <vector>
 
 #include <errno.h>
 
@@ -35,8 +37,10 @@
 #include <messaging/ReliableMessageContext.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
+#include <messaging/ReliableMessageRttEstimator.h>
 #include <protocols/Protocols.h>
 #include <protocols/echo/Echo.h>
+#include <system/RAIIMockClock.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
 
@@ -373,6 +377,200 @@ TEST_F(TestReliableMessageProtocol, CheckAddClearRetrans)
     exchange->Close();
 }
 
+/**
+ * Checks the cost of a retransmission timer tick with many messages waiting for an ack.  A tick only looks at the acks and
+ * retransmissions that are due, so ticks finding nothing due cost the same whatever the number of messages in flight.
+ */
+TEST_F(TestReliableMessageProtocol, CheckTickCostWithManyMessagesInFlight)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    constexpr uint32_t kNumMessages = 500;
+#else
+    constexpr uint32_t kNumMessages = std::min<uint32_t>(CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+#endif
+    constexpr uint32_t kNumTicks = 1000;
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    // Drop every message, with retransmissions far enough away that none is due while ticking.
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = kNumMessages;
+    loopback.mDroppedMessageCount = 0;
+
+    std::vector<ExchangeContext *> exchanges;
+    for (uint32_t i = 0; i < kNumMessages; i++)
+    {
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+        exchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+            System::Clock::Timestamp(60'000), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+            System::Clock::Timestamp(60'000), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+        }));
+
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+        EXPECT_SUCCESS(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse));
+        exchanges.push_back(exchange);
+    }
+    DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumMessages));
+
+    size_t checkedBefore = rm->TestGetNumDeadlinesChecked();
+    for (uint32_t tick = 0; tick < kNumTicks; tick++)
+    {
+        rm->ExecuteActions();
+        rm->StartTimer();
+    }
+
+    // With nothing due, a tick only looks at the earliest retransmission, not at every message in flight.
+    EXPECT_LE(rm->TestGetNumDeadlinesChecked() - checkedBefore, size_t(kNumTicks));
+
+    // Nothing was retransmitted.
+    EXPECT_EQ(loopback.mSentMessageCount, kNumMessages);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kNumMessages));
+
+    for (ExchangeContext * exchange : exchanges)
+    {
+        exchange->Abort();
+    }
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
+TEST_F(TestReliableMessageProtocol, CheckRttEstimator)
+{
+    ReliableMessageRttEstimator estimator;
+    EXPECT_FALSE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetWindow(), CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW);
+
+    // The first sample gives SRTT = R and RTTVAR = R / 2.
+    estimator.AddSample(100_ms32);
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 100_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 50_ms32);
+    EXPECT_EQ(estimator.GetRetransTimeout(), 300_ms32);
+
+    // RTTVAR = 3/4 * 50 + 1/4 * |100 - 200| = 62.5, SRTT = 7/8 * 100 + 1/8 * 200 = 112.5
+    estimator.AddSample(200_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 112_ms32);
+    EXPECT_EQ(estimator.GetRttVariation(), 62_ms32);
+    EXPECT_EQ(estimator.GetRetransTimeout(), 362_ms32);
+
+    // The timeout stays within its bounds however fast or slow the round trips are.
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(1_ms32);
+    }
+    EXPECT_EQ(estimator.GetSmoothedRtt(), 1_ms32);
+    EXPECT_EQ(estimator.GetRetransTimeout(), CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT);
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(60'000_ms32);
+    }
+    EXPECT_EQ(estimator.GetRetransTimeout(), CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRANS_TIMEOUT);
+
+    // The window is halved on every retransmission, down to a single message, and grows back with every ack.
+    estimator.OnRetransmission();
+    EXPECT_EQ(estimator.GetWindow(), std::max(CHIP_CONFIG_MRP_ADAPTIVE_INITIAL_WINDOW / 2, 1));
+    for (int i = 0; i < 8; i++)
+    {
+        estimator.OnRetransmission();
+    }
+    EXPECT_EQ(estimator.GetWindow(), 1);
+    estimator.OnAcknowledged();
+    EXPECT_EQ(estimator.GetWindow(), 2);
+    for (int i = 0; i < 2 * CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW; i++)
+    {
+        estimator.OnAcknowledged();
+    }
+    EXPECT_EQ(estimator.GetWindow(), CHIP_CONFIG_MRP_ADAPTIVE_MAX_WINDOW);
+}
+
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+/**
+ * Sends messages over the loopback transport, losing one in ten, first with the retransmission interval advertised by the peer
+ * and then with the retransmission timeout derived from the measured round-trip times, and compares the delivery latencies.
+ * Time only moves when the test advances the mock clock, so the loopback round trips measure as zero and the adaptive timeout
+ * sits at CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT, well below the advertised interval.
+ */
+TEST_F(TestReliableMessageProtocol, CheckAdaptiveRetransLatencyUnderLoss)
+{
+    constexpr size_t kNumMessages = 50;
+    constexpr auto kTimeStep      = 10_ms64;
+    constexpr auto kMaxLatency    = 2000_ms64;
+
+    System::Clock::Internal::RAIIMockClock clock;
+    clock.SetMonotonic(1000_ms64);
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    auto & loopback            = GetLoopback();
+    loopback.mSentMessageCount = 0;
+
+    auto measureLatencies = [&](std::vector<System::Clock::Milliseconds64> & latencies) {
+        for (size_t i = 0; i < kNumMessages; i++)
+        {
+            ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+            ASSERT_NE(exchange, nullptr);
+            exchange->GetSessionHandle()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+                System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+                System::Clock::Timestamp(300), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+            }));
+
+            loopback.mNumMessagesToDrop   = (i % 10 == 5) ? 1 : 0;
+            loopback.mDroppedMessageCount = 0;
+
+            chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            ASSERT_FALSE(buffer.IsNull());
+
+            System::Clock::Milliseconds64 latency = 0_ms64;
+            EXPECT_SUCCESS(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)));
+            DrainAndServiceIO();
+            while (rm->TestGetCountRetransTable() != 0 && latency < kMaxLatency)
+            {
+                clock.AdvanceMonotonic(kTimeStep);
+                latency += kTimeStep;
+                DrainAndServiceIO();
+            }
+            EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+            latencies.push_back(latency);
+        }
+        std::sort(latencies.begin(), latencies.end());
+    };
+
+    std::vector<System::Clock::Milliseconds64> advertised;
+    measureLatencies(advertised);
+    ASSERT_EQ(advertised.size(), kNumMessages);
+
+    ReliableMessageMgr::SetAdaptiveRetransEnabled(true);
+    std::vector<System::Clock::Milliseconds64> adaptive;
+    measureLatencies(adaptive);
+    ReliableMessageMgr::SetAdaptiveRetransEnabled(false);
+    ASSERT_EQ(adaptive.size(), kNumMessages);
+
+    const size_t p50 = kNumMessages / 2;
+    const size_t p99 = kNumMessages * 99 / 100;
+    ChipLogProgress(Test, "Advertised interval: p50 %" PRIu64 "ms p99 %" PRIu64 "ms", advertised[p50].count(),
+                    advertised[p99].count());
+    ChipLogProgress(Test, "Measured round trips: p50 %" PRIu64 "ms p99 %" PRIu64 "ms", adaptive[p50].count(),
+                    adaptive[p99].count());
+
+    // Messages that are not lost are acknowledged before the clock moves.
+    EXPECT_EQ(advertised[p50], 0_ms64);
+    EXPECT_EQ(adaptive[p50], 0_ms64);
+
+    // Lost messages wait for the advertised interval at first, and for the much shorter adaptive timeout once round trips
+    // have been measured.
+    EXPECT_GE(advertised[p99], System::Clock::Milliseconds64(theBackoffComplianceTestVector[0].backoffMin));
+    EXPECT_GE(adaptive[p99], System::Clock::Milliseconds64(CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRANS_TIMEOUT));
+    EXPECT_LT(adaptive[p99], System::Clock::Milliseconds64(theBackoffComplianceTestVector[0].backoffMin));
+}
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_ENABLED
+
 /**
  * Tests MRP retransmission logic with the following scenario:
  *
@@ -2218,6 +2416,8 @@ TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitEven
     auto expectedMinimumAckLatencyTime = System::Clock::Milliseconds64(kTestRetryInterval * 5);
     EXPECT_GT(sixthTransmitEvent.ackLatencyMs, expectedMinimumAckLatencyTime);
     EXPECT_EQ(messageCounter, sixthTransmitEvent.messageCounter);
+    // The ack of a retransmitted message gives no round-trip time.
+    EXPECT_EQ(sixthTransmitEvent.smoothedRttMs, std::nullopt);
 }
 
 TEST_F(TestReliableMessageProtocol, CheckReliableMessageAnalyticsForTransmitFailureForEstablishedCase)
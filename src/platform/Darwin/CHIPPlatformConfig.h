@@ -74,6 +74,18 @@ extern "C" int __cxa_atexit(void (*f)(void *), void * p, void * d);
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 
+#ifndef CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE
+#define CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE 4
+#endif // CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+#define CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_COMPILED_ENTRIES
+
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 8
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+
 #ifndef CHIP_CONFIG_KVS_PATH
 #if TARGET_OS_IPHONE
 #define CHIP_CONFIG_KVS_PATH "chip.store"
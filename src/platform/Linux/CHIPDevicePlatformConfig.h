@@ -55,6 +55,16 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+ *
+ * Store the KVS in an append-only log (ChipLinuxStorageLog) instead of an INI file (ChipLinuxStorage).
+ * Set by the chip_linux_log_structured_kvs GN argument.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+#define CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS 0
+#endif
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -65,6 +75,18 @@
 #define CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE 8192
 #endif // CHIP_DEVICE_CONFIG_THREAD_TASK_STACK_SIZE
 
+#ifndef CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+#define CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING 1
+#endif
+
+#ifndef CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE
+#define CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE 4
+#endif
+
+#ifndef CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_BG_MAX_EVENT_QUEUE_SIZE 64
+#endif
+
 #ifndef CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
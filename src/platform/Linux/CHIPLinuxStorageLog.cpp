@@ -0,0 +1,577 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides the log-structured key-value store of the Linux platform.
+ */
+
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <algorithm>
+#include <array>
+#include <errno.h>
+#include <fcntl.h>
+#include <fstream>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include <inipp/inipp.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/IniEscaping.h>
+#include <lib/support/TemporaryFileStream.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr char kMagic[8] = { 'C', 'H', 'I', 'P', 'K', 'V', 'L', 1 };
+
+constexpr uint8_t kRecordTypePut    = 1;
+constexpr uint8_t kRecordTypeDelete = 2;
+constexpr uint8_t kRecordTypeCommit = 3;
+
+// Checksum (4 bytes), type (1 byte), key length (2 bytes) and value length (4 bytes), all little-endian.
+constexpr size_t kRecordHeaderSize = 11;
+
+// The value of a commit record is the offset of the first record it commits (8 bytes, little-endian).
+constexpr size_t kCommitValueSize = 8;
+
+constexpr std::array<uint32_t, 256> MakeCrc32Table()
+{
+    std::array<uint32_t, 256> table = {};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCrc32Table = MakeCrc32Table();
+
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = kCrc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+uint64_t ReadLittleEndian(const uint8_t * data, size_t size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+void WriteLittleEndian(uint8_t * data, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        data[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+// Appends a complete record to `out`.
+void EncodeRecord(std::string & out, uint8_t type, const std::string & key, const uint8_t * value, size_t valueLength)
+{
+    const size_t start = out.size();
+    out.resize(start + kRecordHeaderSize);
+    out.append(key);
+    if (valueLength > 0)
+    {
+        out.append(reinterpret_cast<const char *>(value), valueLength);
+    }
+
+    uint8_t * record = reinterpret_cast<uint8_t *>(&out[start]);
+    record[4]        = type;
+    WriteLittleEndian(&record[5], static_cast<uint32_t>(key.size()), 2);
+    WriteLittleEndian(&record[7], static_cast<uint32_t>(valueLength), 4);
+    WriteLittleEndian(&record[0], Crc32(&record[4], out.size() - start - 4), 4);
+}
+
+// Appends a commit record for the records written from `batchStart` to `out`.
+void EncodeCommitRecord(std::string & out, size_t batchStart)
+{
+    uint8_t value[kCommitValueSize];
+    WriteLittleEndian(value, batchStart, sizeof(value));
+    EncodeRecord(out, kRecordTypeCommit, std::string(), value, sizeof(value));
+}
+
+// Returns the length of the record at `offset` if it is complete and matches its checksum, or 0 otherwise.
+size_t ValidRecordLength(const std::vector<uint8_t> & contents, size_t offset)
+{
+    VerifyOrReturnValue(offset <= contents.size() && contents.size() - offset >= kRecordHeaderSize, 0);
+
+    const uint8_t * record    = &contents[offset];
+    const uint8_t type        = record[4];
+    const size_t keyLength    = static_cast<size_t>(ReadLittleEndian(&record[5], 2));
+    const size_t valueLength  = static_cast<size_t>(ReadLittleEndian(&record[7], 4));
+    const size_t recordLength = kRecordHeaderSize + keyLength + valueLength;
+    VerifyOrReturnValue(type == kRecordTypePut || type == kRecordTypeDelete || type == kRecordTypeCommit, 0);
+    VerifyOrReturnValue(type != kRecordTypeCommit || (keyLength == 0 && valueLength == kCommitValueSize), 0);
+    VerifyOrReturnValue(recordLength <= contents.size() - offset, 0);
+    VerifyOrReturnValue(Crc32(&record[4], recordLength - 4) == ReadLittleEndian(&record[0], 4), 0);
+    return recordLength;
+}
+
+// Whether the records from `offset` to `end` are all valid.
+bool AreValidRecords(const std::vector<uint8_t> & contents, size_t offset, size_t end)
+{
+    while (offset < end)
+    {
+        const size_t length = ValidRecordLength(contents, offset);
+        VerifyOrReturnValue(length > 0, false);
+        offset += length;
+    }
+    return offset == end;
+}
+
+// Whether a commit record after `offset` commits records that all start after it, i.e. whether a commit completed after the
+// records from `offset` were written.
+bool IsCommittedAfter(const std::vector<uint8_t> & contents, size_t offset)
+{
+    for (size_t at = offset + 1; at + kRecordHeaderSize + kCommitValueSize <= contents.size(); at++)
+    {
+        if (contents[at + 4] != kRecordTypeCommit || ValidRecordLength(contents, at) == 0)
+        {
+            continue;
+        }
+        const uint64_t batchStart = ReadLittleEndian(&contents[at + kRecordHeaderSize], kCommitValueSize);
+        if (batchStart > offset && batchStart <= at && AreValidRecords(contents, static_cast<size_t>(batchStart), at))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxStorageLog::Init(const char * file)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mFd.Get() != -1)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageLog::Init: Attempt to re-initialize with KVS file: %s, IGNORING.",
+                     StringOrNullMarker(file));
+        return CHIP_NO_ERROR;
+    }
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageLog::Init: Using KVS file: %s", file);
+
+    mPath.assign(file);
+    mFd = FileDescriptor(open(file, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS file %s: %s", file, strerror(errno)));
+
+    CHIP_ERROR err = Load();
+    if (err != CHIP_NO_ERROR)
+    {
+        mFd.Close();
+        mIndex.clear();
+    }
+    return err;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const Location & location = it->second;
+    outLen                    = location.mValueLength;
+    VerifyOrReturnError(location.mValueLength <= bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return ReadAt(location.mValueOffset, buf, location.mValueLength);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(key != nullptr && strlen(key) <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= UINT32_MAX && (data != nullptr || dataLen == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string keyString(key);
+    ReturnErrorOnFailure(Append(kRecordTypePut, keyString, data, dataLen));
+
+    auto it = mIndex.find(keyString);
+    if (it != mIndex.end())
+    {
+        mLiveSize -= static_cast<off_t>(RecordSize(keyString.size(), it->second.mValueLength));
+    }
+    mIndex[keyString] = { static_cast<off_t>(mFileSize - static_cast<off_t>(dataLen)), static_cast<uint32_t>(dataLen) };
+    mLiveSize += static_cast<off_t>(RecordSize(keyString.size(), dataLen));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ClearValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(Append(kRecordTypeDelete, it->first, nullptr, 0));
+    mLiveSize -= static_cast<off_t>(RecordSize(it->first.size(), it->second.mValueLength));
+    mIndex.erase(it);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Commit()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mDirty)
+    {
+        std::string record;
+        EncodeCommitRecord(record, static_cast<size_t>(mCommittedSize));
+        ReturnErrorOnFailure(AppendRaw(record));
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_WRITE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to sync KVS file %s: %s", mPath.c_str(), strerror(errno)));
+        mCommittedSize = mFileSize;
+        mDirty         = false;
+    }
+
+    if (NeedsCompaction())
+    {
+        // The writes are already durable, so failing to compact only leaves a larger file.
+        CHIP_ERROR err = CompactLocked();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Failed to compact KVS file %s: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+        }
+    }
+
+    // Once the file was replaced, the writes are only durable with its directory entry.
+    if (mDirectoryDirty)
+    {
+        ReturnErrorOnFailure(SyncDirectory());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Load()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_OPEN_FAILED);
+
+    mIndex.clear();
+    mLiveSize = 0;
+
+    std::vector<uint8_t> contents(static_cast<size_t>(st.st_size));
+    ReturnErrorOnFailure(ReadAt(0, contents.data(), contents.size()));
+
+    if (contents.size() < sizeof(kMagic) && (contents.empty() || memcmp(contents.data(), kMagic, contents.size()) == 0))
+    {
+        // New file, or one whose creation was interrupted before its header was completely written.
+        ReturnErrorOnFailure(WriteAt(mFd.Get(), 0, kMagic, sizeof(kMagic)));
+        mFileSize      = sizeof(kMagic);
+        mCommittedSize = mFileSize;
+        mBytesWritten += sizeof(kMagic);
+        VerifyOrReturnError(fdatasync(mFd.Get()) == 0, CHIP_ERROR_WRITE_FAILED);
+        mDirectoryDirty = true;
+        return SyncDirectory();
+    }
+
+    if (contents.size() < sizeof(kMagic) || memcmp(contents.data(), kMagic, sizeof(kMagic)) != 0)
+    {
+        return Convert();
+    }
+
+    // Records are only known to be on the disk once the commit record written after them is.  Those after the last commit
+    // record were either never committed, or not completely written because of a crash or power loss before the commit
+    // completed: the file may then have grown with the records' contents not reaching the disk.
+    size_t committedSize = sizeof(kMagic);
+    size_t offset        = committedSize;
+    while (size_t recordLength = ValidRecordLength(contents, offset))
+    {
+        const bool isCommit = contents[offset + 4] == kRecordTypeCommit;
+        if (isCommit && ReadLittleEndian(&contents[offset + kRecordHeaderSize], kCommitValueSize) != committedSize)
+        {
+            break;
+        }
+        offset += recordLength;
+        if (isCommit)
+        {
+            committedSize = offset;
+        }
+    }
+
+    if (committedSize != contents.size())
+    {
+        // A commit after the damaged records means that they were committed, so dropping everything from there would lose
+        // the records committed since: leave the file for recovery.
+        VerifyOrReturnError(!IsCommittedAfter(contents, committedSize), CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                            ChipLogError(DeviceLayer, "KVS file %s is corrupted after offset %u", mPath.c_str(),
+                                         static_cast<unsigned>(committedSize)));
+
+        ChipLogError(DeviceLayer, "KVS file %s: dropping %u bytes after the last commit", mPath.c_str(),
+                     static_cast<unsigned>(contents.size() - committedSize));
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(committedSize)) == 0 && fdatasync(mFd.Get()) == 0,
+                            CHIP_ERROR_WRITE_FAILED);
+    }
+
+    for (offset = sizeof(kMagic); offset < committedSize;)
+    {
+        const uint8_t * record    = &contents[offset];
+        const uint8_t type        = record[4];
+        const size_t keyLength    = static_cast<size_t>(ReadLittleEndian(&record[5], 2));
+        const size_t valueLength  = static_cast<size_t>(ReadLittleEndian(&record[7], 4));
+        const size_t recordLength = RecordSize(keyLength, valueLength);
+        offset += recordLength;
+        if (type == kRecordTypeCommit)
+        {
+            continue;
+        }
+
+        std::string key(reinterpret_cast<const char *>(&record[kRecordHeaderSize]), keyLength);
+        auto it = mIndex.find(key);
+        if (it != mIndex.end())
+        {
+            mLiveSize -= static_cast<off_t>(RecordSize(keyLength, it->second.mValueLength));
+            mIndex.erase(it);
+        }
+        if (type == kRecordTypePut)
+        {
+            mIndex[key] = { static_cast<off_t>(offset - valueLength), static_cast<uint32_t>(valueLength) };
+            mLiveSize += static_cast<off_t>(recordLength);
+        }
+    }
+    mFileSize      = static_cast<off_t>(committedSize);
+    mCommittedSize = mFileSize;
+
+    ChipLogDetail(DeviceLayer, "KVS file %s: %u keys, %u of %u bytes in use", mPath.c_str(), static_cast<unsigned>(mIndex.size()),
+                  static_cast<unsigned>(mLiveSize), static_cast<unsigned>(mFileSize));
+
+    return NeedsCompaction() ? CompactLocked() : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Convert()
+{
+    // Not a log: the file was written by ChipLinuxStorage, whose values are the base64 encoding of the data.
+    std::ifstream ifs(mPath, std::ifstream::in);
+    VerifyOrReturnError(ifs.is_open(), CHIP_ERROR_OPEN_FAILED);
+    inipp::Ini<char> ini;
+    ini.parse(ifs);
+    VerifyOrReturnError(ini.errors.empty(), CHIP_ERROR_INTEGRITY_CHECK_FAILED,
+                        ChipLogError(DeviceLayer, "KVS file %s is neither a log nor an INI file", mPath.c_str()));
+
+    std::string contents(kMagic, sizeof(kMagic));
+    for (const auto & entry : ini.sections["DEFAULT"])
+    {
+        const std::string key   = IniEscaping::UnescapeKey(entry.first);
+        const std::string value = IniEscaping::Base64ToString(entry.second);
+        EncodeRecord(contents, kRecordTypePut, key, reinterpret_cast<const uint8_t *>(value.data()), value.size());
+    }
+    EncodeCommitRecord(contents, sizeof(kMagic));
+
+    ChipLogProgress(DeviceLayer, "Converting KVS file %s from INI to log-structured", mPath.c_str());
+    TemporaryFileStream tmpFile(mPath + "-XXXXXX");
+    VerifyOrReturnError(tmpFile.IsOpen(), CHIP_ERROR_OPEN_FAILED);
+    tmpFile.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    VerifyOrReturnError(tmpFile.good() && tmpFile.DataSync(), CHIP_ERROR_WRITE_FAILED);
+
+    // Keep the INI file, so that the conversion can be undone.
+    const std::string backupPath = mPath + kIniBackupSuffix;
+    unlink(backupPath.c_str());
+    VerifyOrReturnError(link(mPath.c_str(), backupPath.c_str()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to back up KVS file %s to %s: %s", mPath.c_str(), backupPath.c_str(),
+                                     strerror(errno)));
+    VerifyOrReturnError(rename(tmpFile.GetFileName().c_str(), mPath.c_str()) == 0, CHIP_ERROR_WRITE_FAILED);
+    mDirectoryDirty = true;
+    ReturnErrorOnFailure(SyncDirectory());
+    mBytesWritten += contents.size();
+
+    mFd = FileDescriptor(open(mPath.c_str(), O_RDWR | O_CLOEXEC));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED);
+    return Load();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::CompactLocked()
+{
+    std::string contents(kMagic, sizeof(kMagic));
+    contents.reserve(sizeof(kMagic) + static_cast<size_t>(mLiveSize));
+
+    std::unordered_map<std::string, Location> index;
+    std::vector<uint8_t> value;
+    for (const auto & entry : mIndex)
+    {
+        value.resize(entry.second.mValueLength);
+        ReturnErrorOnFailure(ReadAt(entry.second.mValueOffset, value.data(), value.size()));
+        EncodeRecord(contents, kRecordTypePut, entry.first, value.data(), value.size());
+        index[entry.first] = { static_cast<off_t>(contents.size() - value.size()), entry.second.mValueLength };
+    }
+    const size_t liveSize = contents.size() - sizeof(kMagic);
+    EncodeCommitRecord(contents, sizeof(kMagic));
+
+    TemporaryFileStream tmpFile(mPath + "-XXXXXX");
+    VerifyOrReturnError(tmpFile.IsOpen(), CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpFile.GetFileName().c_str(),
+                                     strerror(errno)));
+    tmpFile.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    VerifyOrReturnError(tmpFile.good() && tmpFile.DataSync(), CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to write temp file %s: %s", tmpFile.GetFileName().c_str(),
+                                     strerror(errno)));
+
+    // Open the new file before renaming it, so that the store keeps working with the old file if that fails.
+    FileDescriptor fd(open(tmpFile.GetFileName().c_str(), O_RDWR | O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() != -1, CHIP_ERROR_OPEN_FAILED);
+    VerifyOrReturnError(rename(tmpFile.GetFileName().c_str(), mPath.c_str()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpFile.GetFileName().c_str(),
+                                     mPath.c_str(), strerror(errno)));
+
+    ChipLogDetail(DeviceLayer, "Compacted KVS file %s from %u to %u bytes", mPath.c_str(), static_cast<unsigned>(mFileSize),
+                  static_cast<unsigned>(contents.size()));
+
+    mFd             = std::move(fd);
+    mIndex          = std::move(index);
+    mFileSize       = static_cast<off_t>(contents.size());
+    mCommittedSize  = mFileSize;
+    mLiveSize       = static_cast<off_t>(liveSize);
+    mDirty          = false;
+    mDirectoryDirty = true;
+    mBytesWritten += contents.size();
+
+    // Until the rename is durable, a power loss would bring back the old file without any of the writes made to the new one.
+    return SyncDirectory();
+}
+
+CHIP_ERROR ChipLinuxStorageLog::Append(uint8_t type, const std::string & key, const uint8_t * value, size_t valueLength)
+{
+    std::string record;
+    record.reserve(RecordSize(key.size(), valueLength));
+    EncodeRecord(record, type, key, value, valueLength);
+    return AppendRaw(record);
+}
+
+CHIP_ERROR ChipLinuxStorageLog::AppendRaw(const std::string & record)
+{
+    CHIP_ERROR err = WriteAt(mFd.Get(), mFileSize, record.data(), record.size());
+    if (err != CHIP_NO_ERROR)
+    {
+        // Do not leave part of the record behind, which would hide the records written after it when loading the file.
+        if (ftruncate(mFd.Get(), mFileSize) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS file %s: %s", mPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+
+    mFileSize += static_cast<off_t>(record.size());
+    mBytesWritten += record.size();
+    mDirty = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::ReadAt(off_t offset, void * data, size_t length)
+{
+    uint8_t * bytes = static_cast<uint8_t *>(data);
+    size_t done     = 0;
+    while (done < length)
+    {
+        ssize_t rv = pread(mFd.Get(), bytes + done, length - done, offset + static_cast<off_t>(done));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_READ_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to read KVS file %s: %s", mPath.c_str(),
+                                         rv < 0 ? strerror(errno) : "unexpected end of file"));
+        done += static_cast<size_t>(rv);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::WriteAt(int fd, off_t offset, const void * data, size_t length)
+{
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    size_t done           = 0;
+    while (done < length)
+    {
+        ssize_t rv = pwrite(fd, bytes + done, length - done, offset + static_cast<off_t>(done));
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_WRITE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to write KVS file %s: %s", mPath.c_str(), strerror(errno)));
+        done += static_cast<size_t>(rv);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageLog::SyncDirectory()
+{
+    const size_t slash          = mPath.find_last_of('/');
+    const std::string directory = (slash == std::string::npos) ? "." : mPath.substr(0, std::max<size_t>(slash, 1));
+
+    FileDescriptor fd(open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() != -1 && fsync(fd.Get()) == 0, CHIP_ERROR_WRITE_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to sync directory %s: %s", directory.c_str(), strerror(errno)));
+    mDirectoryDirty = false;
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageLog::NeedsCompaction() const
+{
+    return mFileSize > kMinCompactionSize && (mFileSize - static_cast<off_t>(sizeof(kMagic))) > 2 * mLiveSize;
+}
+
+size_t ChipLinuxStorageLog::RecordSize(size_t keyLength, size_t valueLength)
+{
+    return kRecordHeaderSize + keyLength + valueLength;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
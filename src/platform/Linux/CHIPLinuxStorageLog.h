@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a log-structured key-value store for the KVS of
+ *         Linux, selected with the chip_linux_log_structured_kvs GN argument.
+ *
+ *         Each write appends a record to the file instead of rewriting the
+ *         whole file as ChipLinuxStorage does.  Where each value is in the
+ *         file is kept in memory, and the file is rewritten without the
+ *         records that were overwritten or deleted once they make up most
+ *         of it.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ * The file starts with a header, followed by records made of a checksum, a type (value written, key deleted or commit), the
+ * lengths of the key and of the value, then the key and the value.  Commit() appends a commit record giving where the records
+ * it commits start.  When opening the file, what follows the last commit record is dropped, as it was not committed or not
+ * completely written, so that the file is as it was after the last complete commit; a record that does not match its checksum
+ * before a later commit makes Init() fail, leaving the file untouched.  The file is rewritten by writing a temporary file and
+ * renaming it over the original, so that it is never left half rewritten.
+ *
+ * A file written by ChipLinuxStorage is converted when opened, and the original is kept next to it, with kIniBackupSuffix
+ * appended to its name.
+ */
+class ChipLinuxStorageLog
+{
+public:
+    /**
+     * The file is rewritten when it is larger than this, and more than half of it is taken by records that were overwritten or
+     * deleted.
+     */
+    static constexpr off_t kMinCompactionSize = 64 * 1024;
+
+    static constexpr char kIniBackupSuffix[] = ".ini-backup";
+
+    CHIP_ERROR Init(const char * file);
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+
+    /**
+     * Makes the writes since the last commit durable, and rewrites the file if needed.  Writes that were not committed are lost
+     * if the store is not committed again before it is closed.
+     */
+    CHIP_ERROR Commit();
+
+    /**
+     * Rewrites the file with only the current values.
+     */
+    CHIP_ERROR Compact();
+
+    /**
+     * Number of bytes written to files, including when rewriting them, since Init().
+     */
+    uint64_t GetBytesWritten() const { return mBytesWritten; }
+
+    off_t GetFileSize() const { return mFileSize; }
+
+private:
+    struct Location
+    {
+        off_t mValueOffset;
+        uint32_t mValueLength;
+    };
+
+    CHIP_ERROR Load();
+    CHIP_ERROR Convert();
+    CHIP_ERROR CompactLocked();
+    CHIP_ERROR Append(uint8_t type, const std::string & key, const uint8_t * value, size_t valueLength);
+    CHIP_ERROR AppendRaw(const std::string & record);
+    CHIP_ERROR ReadAt(off_t offset, void * data, size_t length);
+    CHIP_ERROR WriteAt(int fd, off_t offset, const void * data, size_t length);
+    CHIP_ERROR SyncDirectory();
+    bool NeedsCompaction() const;
+
+    static size_t RecordSize(size_t keyLength, size_t valueLength);
+
+    std::mutex mLock;
+    std::string mPath;
+    FileDescriptor mFd;
+    std::unordered_map<std::string, Location> mIndex;
+    off_t mFileSize        = 0;
+    off_t mCommittedSize   = 0; // Where the records written since the last commit start.
+    off_t mLiveSize        = 0;
+    bool mDirty            = false;
+    bool mDirectoryDirty   = false; // The file was replaced or created, and its directory was not synced since.
+    uint64_t mBytesWritten = 0;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -42,7 +42,7 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     size_t read_size;
 
     // Copy data into value buffer
-    VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(value != nullptr || value_size == 0, CHIP_ERROR_INVALID_ARGUMENT);
 
     // On linux read first without a buffer which returns the size, and then
     // use a local buffer to read the entire object, which allows partial and
@@ -71,7 +71,10 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     {
         *read_bytes_size = copy_size;
     }
-    ::memcpy(value, buf.Get() + offset_bytes, copy_size);
+    if (copy_size > 0)
+    {
+        ::memcpy(value, buf.Get() + offset_bytes, copy_size);
+    }
 
     return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
 }
@@ -79,12 +82,13 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
 CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+    std::lock_guard<std::recursive_mutex> lock(mBatchLock);
 
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
     // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    err = CommitUnlessBatching();
     SuccessOrExit(err);
 
 exit:
@@ -94,7 +98,9 @@ exit:
 CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    err            = mStorage.ClearValue(key);
+    std::lock_guard<std::recursive_mutex> lock(mBatchLock);
+
+    err = mStorage.ClearValue(key);
 
     if (err == CHIP_ERROR_KEY_NOT_FOUND)
     {
@@ -103,13 +109,75 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     SuccessOrExit(err);
 
     // Commit the value to the persistent store.
-    err = mStorage.Commit();
+    err = CommitUnlessBatching();
     SuccessOrExit(err);
 
 exit:
     return err;
 }
 
+CHIP_ERROR KeyValueStoreManagerImpl::_BeginBatch()
+{
+    // Released by the matching _CommitBatch() or _AbortBatch().
+    mBatchLock.lock();
+    mBatchDepth++;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::_CommitBatch()
+{
+    std::lock_guard<std::recursive_mutex> lock(mBatchLock);
+    VerifyOrReturnError(mBatchDepth > 0, CHIP_ERROR_INCORRECT_STATE);
+
+    // Only the thread in the batch can get here with a depth, so it holds the lock taken by _BeginBatch().
+    mBatchLock.unlock();
+    mBatchDepth--;
+    if ((mBatchDepth > 0) || (mBatchedCount == 0))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "KVS: committing %u batched writes", static_cast<unsigned>(mBatchedCount));
+    mBatchedCount = 0;
+    mCommitCount++;
+
+    CHIP_ERROR err = mStorage.Commit();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "KVS: failed to commit batched writes: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    return err;
+}
+
+void KeyValueStoreManagerImpl::_AbortBatch()
+{
+    std::lock_guard<std::recursive_mutex> lock(mBatchLock);
+    VerifyOrReturn(mBatchDepth > 0);
+
+    // The batched writes stay in mBatchedCount, so that the next commit makes them durable.
+    mBatchLock.unlock();
+    mBatchDepth--;
+    if ((mBatchDepth == 0) && (mBatchedCount > 0))
+    {
+        ChipLogProgress(DeviceLayer, "KVS: batch aborted with %u uncommitted writes", static_cast<unsigned>(mBatchedCount));
+    }
+}
+
+CHIP_ERROR KeyValueStoreManagerImpl::CommitUnlessBatching()
+{
+    // Called with mBatchLock held, so that no other thread is in a batch.
+    if (mBatchDepth > 0)
+    {
+        // Committed by the outermost _CommitBatch().
+        mBatchedCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    mBatchedCount = 0;
+    mCommitCount++;
+    return mStorage.Commit();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
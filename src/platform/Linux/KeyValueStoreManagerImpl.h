@@ -23,7 +23,11 @@
 
 #pragma once
 
+#include <platform/CHIPDeviceConfig.h>
 #include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+#include <mutex>
 
 namespace chip {
 namespace DeviceLayer {
@@ -42,8 +46,39 @@ public:
     CHIP_ERROR _Delete(const char * key);
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
+    /**
+     * @brief
+     * Batches only defer the commits of the thread that began them: other threads
+     * wait for the outermost _CommitBatch() or _AbortBatch() before they write.
+     */
+    CHIP_ERROR _BeginBatch();
+    CHIP_ERROR _CommitBatch();
+    void _AbortBatch();
+
+    /**
+     * @brief
+     * Number of times the values were committed to the file, which is once per
+     * Put or Delete outside of a batch and once per batch.
+     */
+    uint32_t GetCommitCount() const
+    {
+        std::lock_guard<std::recursive_mutex> lock(mBatchLock);
+        return mCommitCount;
+    }
+
 private:
+    CHIP_ERROR CommitUnlessBatching();
+
+#if CHIP_DEVICE_CONFIG_LINUX_LOG_STRUCTURED_KVS
+    DeviceLayer::Internal::ChipLinuxStorageLog mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
+    // Held by each write, and from _BeginBatch() until the matching _CommitBatch() or _AbortBatch().
+    mutable std::recursive_mutex mBatchLock;
+    uint32_t mBatchDepth   = 0;
+    uint32_t mBatchedCount = 0;
+    uint32_t mCommitCount  = 0;
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
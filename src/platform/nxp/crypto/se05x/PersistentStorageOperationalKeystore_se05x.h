@@ -38,6 +38,8 @@ public:
     CHIP_ERROR RemoveOpKeypairForFabric(FabricIndex fabricIndex) override;
     CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                  Crypto::P256ECDSASignature & outSignature) const override;
+    // Signatures go through the secure element session, which only the CHIP thread may use.
+    bool SupportsSignWithOpKeypairInBackground() const override { return false; }
 };
 
 } // namespace chip
@@ -29,20 +29,49 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/KeyValueStoreManager.h>
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <atomic>
+#include <chrono>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#endif
+
 using namespace chip;
 using namespace chip::DeviceLayer;
 using namespace chip::DeviceLayer::PersistedStorage;
 
 struct TestKeyValueStoreMgr : public ::testing::Test
 {
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    // The KVS of Linux is stored in a file given when initializing it, in a directory of its own so that tests running at the
+    // same time do not share it.
+    static inline char sLinuxKvsDir[] = "/tmp/chip_test_kvs_mgr-XXXXXX";
+    static inline std::string sLinuxKvsPath;
+#endif
 
     static void SetUpTestSuite()
     {
         CHIP_ERROR err = chip::Platform::MemoryInit();
         EXPECT_EQ(err, CHIP_NO_ERROR);
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+        ASSERT_NE(mkdtemp(sLinuxKvsDir), nullptr);
+        sLinuxKvsPath = std::string(sLinuxKvsDir) + "/chip_kvs";
+        err           = KeyValueStoreMgrImpl().Init(sLinuxKvsPath.c_str());
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+#endif
     }
 
-    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+    static void TearDownTestSuite()
+    {
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+        unlink(sLinuxKvsPath.c_str());
+        rmdir(sLinuxKvsDir);
+#endif
+        chip::Platform::MemoryShutdown();
+    }
 };
 
 TEST_F(TestKeyValueStoreMgr, EmptyString)
@@ -297,6 +326,95 @@ TEST_F(TestKeyValueStoreMgr, MultiRead)
 }
 #endif
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+TEST_F(TestKeyValueStoreMgr, Batch)
+{
+    static constexpr char kTestKey1[] = "batch_key_1";
+    static constexpr char kTestKey2[] = "batch_key_2";
+
+    EXPECT_EQ(KeyValueStoreMgr().CommitBatch(), CHIP_ERROR_INCORRECT_STATE);
+
+    EXPECT_EQ(KeyValueStoreMgr().BeginBatch(), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey1, uint32_t(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().BeginBatch(), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey2, uint32_t(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().CommitBatch(), CHIP_NO_ERROR);
+
+    // Values are readable before the batch is committed.
+    uint32_t readValue = 0;
+    EXPECT_EQ(KeyValueStoreMgr().Get(kTestKey2, &readValue), CHIP_NO_ERROR);
+    EXPECT_EQ(readValue, 2u);
+
+    uint32_t commitCount = KeyValueStoreMgrImpl().GetCommitCount();
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey1), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount);
+    EXPECT_EQ(KeyValueStoreMgr().CommitBatch(), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount + 1);
+
+    // The file read back holds what the batch wrote.
+    EXPECT_EQ(KeyValueStoreMgrImpl().Init(sLinuxKvsPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Get(kTestKey1, &readValue), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(KeyValueStoreMgr().Get(kTestKey2, &readValue), CHIP_NO_ERROR);
+    EXPECT_EQ(readValue, 2u);
+
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey2), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount + 2);
+
+    // The writes of an aborted batch are made durable by the next commit.
+    EXPECT_EQ(KeyValueStoreMgr().BeginBatch(), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey1, uint32_t(3)), CHIP_NO_ERROR);
+    KeyValueStoreMgr().AbortBatch();
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount + 2);
+    EXPECT_EQ(KeyValueStoreMgr().CommitBatch(), CHIP_ERROR_INCORRECT_STATE);
+    EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey2, uint32_t(4)), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount + 3);
+
+    EXPECT_EQ(KeyValueStoreMgrImpl().Init(sLinuxKvsPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Get(kTestKey1, &readValue), CHIP_NO_ERROR);
+    EXPECT_EQ(readValue, 3u);
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey1), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey2), CHIP_NO_ERROR);
+}
+#endif
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+TEST_F(TestKeyValueStoreMgr, BatchFromOtherThread)
+{
+    static constexpr char kTestKey1[] = "batch_thread_key_1";
+    static constexpr char kTestKey2[] = "batch_thread_key_2";
+
+    uint32_t commitCount = KeyValueStoreMgrImpl().GetCommitCount();
+    std::atomic<bool> started{ false };
+    std::atomic<bool> written{ false };
+
+    EXPECT_EQ(KeyValueStoreMgr().BeginBatch(), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey1, uint32_t(1)), CHIP_NO_ERROR);
+
+    std::thread writer([&] {
+        started = true;
+        EXPECT_EQ(KeyValueStoreMgr().Put(kTestKey2, uint32_t(2)), CHIP_NO_ERROR);
+        written = true;
+    });
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    // The write of the other thread waits for the batch, rather than being deferred by it.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(written);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount);
+
+    EXPECT_EQ(KeyValueStoreMgr().CommitBatch(), CHIP_NO_ERROR);
+    writer.join();
+    EXPECT_TRUE(written);
+    EXPECT_EQ(KeyValueStoreMgrImpl().GetCommitCount(), commitCount + 2);
+
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey1), CHIP_NO_ERROR);
+    EXPECT_EQ(KeyValueStoreMgr().Delete(kTestKey2), CHIP_NO_ERROR);
+}
+#endif
+
 #ifdef __ZEPHYR__
 TEST_F(TestKeyValueStoreMgr, DoFactoryReset)
 {
@@ -0,0 +1,396 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the log-structured KVS of Linux.
+ */
+
+#include <algorithm>
+#include <fcntl.h>
+#include <fstream>
+#include <iterator>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageLog.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+off_t FileSize(const char * path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? st.st_size : -1;
+}
+
+std::string FileContents(const char * path)
+{
+    std::ifstream file(path, std::ifstream::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+void CorruptByte(const char * path, off_t offset)
+{
+    int fd = open(path, O_WRONLY);
+    ASSERT_GE(fd, 0);
+    EXPECT_EQ(pwrite(fd, "x", 1, offset), 1);
+    close(fd);
+}
+
+// Zeroes `length` bytes from `offset`, growing the file if needed, as when the file grew but the data written did not reach the
+// disk.
+void ZeroBytes(const char * path, off_t offset, size_t length)
+{
+    int fd = open(path, O_WRONLY);
+    ASSERT_GE(fd, 0);
+    const std::string zeros(length, '\0');
+    EXPECT_EQ(pwrite(fd, zeros.data(), zeros.size(), offset), static_cast<ssize_t>(zeros.size()));
+    close(fd);
+}
+
+void ExpectValue(ChipLinuxStorageLog & storage, const char * key, const void * expected, size_t expectedLength)
+{
+    uint8_t buf[256];
+    size_t length = 0;
+    ASSERT_EQ(storage.ReadValueBin(key, buf, sizeof(buf), length), CHIP_NO_ERROR) << key;
+    EXPECT_EQ(length, expectedLength) << key;
+    EXPECT_EQ(memcmp(buf, expected, expectedLength), 0) << key;
+}
+
+struct TestLinuxStorageLog : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    // Each test uses files of its own, so that tests running at the same time do not share them.
+    void SetUp() override
+    {
+        ASSERT_NE(mkdtemp(mDir), nullptr);
+        mLogPath       = std::string(mDir) + "/chip_kvs";
+        mIniBackupPath = mLogPath + ChipLinuxStorageLog::kIniBackupSuffix;
+    }
+
+    void TearDown() override
+    {
+        unlink(mLogPath.c_str());
+        unlink(mIniBackupPath.c_str());
+        rmdir(mDir);
+    }
+
+    char mDir[64] = "/tmp/chip_test_storage_log-XXXXXX";
+    std::string mLogPath;
+    std::string mIniBackupPath;
+};
+
+TEST_F(TestLinuxStorageLog, TestReadWrite)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+
+    const uint8_t value1[] = { 1, 2, 3 };
+    const uint8_t value2[] = { 4, 5, 6, 7 };
+    uint8_t buf[4];
+    size_t length = 0;
+
+    EXPECT_EQ(storage.ReadValueBin("a", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ClearValue("a"), CHIP_ERROR_KEY_NOT_FOUND);
+
+    EXPECT_EQ(storage.WriteValueBin("a", value1, sizeof(value1)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("b", value1, sizeof(value1)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("empty", nullptr, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("a", value2, sizeof(value2)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+    ExpectValue(storage, "a", value2, sizeof(value2));
+    ExpectValue(storage, "empty", "", 0);
+    EXPECT_EQ(storage.ReadValueBin("b", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ReadValueBin("a", buf, 2, length), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(length, sizeof(value2));
+
+    // The same values are read back from the file.
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(reopened, "a", value2, sizeof(value2));
+    ExpectValue(reopened, "empty", "", 0);
+    EXPECT_EQ(reopened.ReadValueBin("b", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+// A last commit that was not completely written, as after a power loss, is dropped.  A corrupted record followed by a commit
+// makes opening the file fail instead, so that the records committed after it are not lost.
+TEST_F(TestLinuxStorageLog, TestRecovery)
+{
+    const uint8_t value1[] = { 1, 2, 3 };
+    const uint8_t value2[] = { 4, 5, 6, 7 };
+    off_t completeSize;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", value1, sizeof(value1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        completeSize = storage.GetFileSize();
+        EXPECT_EQ(storage.WriteValueBin("a", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    // Cut the second commit short.
+    ASSERT_EQ(truncate(mLogPath.c_str(), completeSize + 5), 0);
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "a", value1, sizeof(value1));
+        EXPECT_EQ(storage.GetFileSize(), completeSize);
+        EXPECT_EQ(FileSize(mLogPath.c_str()), completeSize);
+
+        // Writing after the recovery works.
+        EXPECT_EQ(storage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "a", value1, sizeof(value1));
+        ExpectValue(storage, "b", value2, sizeof(value2));
+    }
+
+    // The last commit record does not match its checksum, as when the file grew before the record reached the disk.
+    CorruptByte(mLogPath.c_str(), FileSize(mLogPath.c_str()) - 1);
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "a", value1, sizeof(value1));
+        uint8_t buf[4];
+        size_t length;
+        EXPECT_EQ(storage.ReadValueBin("b", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+        EXPECT_EQ(FileSize(mLogPath.c_str()), completeSize);
+
+        EXPECT_EQ(storage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+
+    // The value of the first record no longer matches its checksum, and the commit of "b" follows it.
+    const size_t valueOffset = FileContents(mLogPath.c_str()).find(std::string(value1, value1 + sizeof(value1)));
+    ASSERT_LT(valueOffset, static_cast<size_t>(completeSize));
+    CorruptByte(mLogPath.c_str(), static_cast<off_t>(valueOffset));
+    const std::string corrupted = FileContents(mLogPath.c_str());
+    {
+        ChipLinuxStorageLog storage;
+        EXPECT_EQ(storage.Init(mLogPath.c_str()), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+    }
+    EXPECT_EQ(FileContents(mLogPath.c_str()), corrupted);
+}
+
+// The file grew but the records appended, and their commit record, did not reach the disk and read back as zeros.
+TEST_F(TestLinuxStorageLog, TestZeroFilledTail)
+{
+    const uint8_t value1[] = { 1, 2, 3 };
+    const uint8_t value2[] = { 4, 5, 6, 7 };
+    off_t completeSize;
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", value1, sizeof(value1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        completeSize = storage.GetFileSize();
+    }
+    ZeroBytes(mLogPath.c_str(), completeSize, 140);
+
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "a", value1, sizeof(value1));
+        EXPECT_EQ(FileSize(mLogPath.c_str()), completeSize);
+
+        // A batch of several records, of which only the commit record reached the disk.
+        EXPECT_EQ(storage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("c", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("a"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+    }
+    ZeroBytes(mLogPath.c_str(), completeSize, 20);
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "a", value1, sizeof(value1));
+    uint8_t buf[4];
+    size_t length;
+    EXPECT_EQ(storage.ReadValueBin("b", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(storage.ReadValueBin("c", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(FileSize(mLogPath.c_str()), completeSize);
+}
+
+// Writes that were not committed are not kept.
+TEST_F(TestLinuxStorageLog, TestUncommittedWrites)
+{
+    const uint8_t value1[] = { 1, 2, 3 };
+    const uint8_t value2[] = { 4, 5, 6, 7 };
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", value1, sizeof(value1)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("a", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "a", value1, sizeof(value1));
+    uint8_t buf[4];
+    size_t length;
+    EXPECT_EQ(storage.ReadValueBin("b", buf, sizeof(buf), length), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+// A file whose creation was interrupted while writing its header is started over.
+TEST_F(TestLinuxStorageLog, TestShortHeader)
+{
+    const uint8_t value[] = { 1, 2, 3 };
+    {
+        ChipLinuxStorageLog storage;
+        ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(truncate(mLogPath.c_str(), 3), 0);
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.WriteValueBin("a", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(reopened, "a", value, sizeof(value));
+}
+
+TEST_F(TestLinuxStorageLog, TestCompaction)
+{
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t value[200];
+    memset(value, 0x5a, sizeof(value));
+    EXPECT_EQ(storage.WriteValueBin("kept", value, sizeof(value)), CHIP_NO_ERROR);
+
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        memcpy(value, &i, sizeof(i));
+        ASSERT_EQ(storage.WriteValueBin("counter", value, sizeof(value)), CHIP_NO_ERROR);
+        ASSERT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        // The overwritten values are dropped once they take more than half of the file.
+        ASSERT_LE(storage.GetFileSize(), ChipLinuxStorageLog::kMinCompactionSize + 2 * static_cast<off_t>(sizeof(value) + 32));
+    }
+    EXPECT_EQ(storage.GetFileSize(), FileSize(mLogPath.c_str()));
+
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(reopened, "counter", value, sizeof(value));
+    memset(value, 0x5a, sizeof(value));
+    ExpectValue(reopened, "kept", value, sizeof(value));
+
+    EXPECT_EQ(reopened.Compact(), CHIP_NO_ERROR);
+    ExpectValue(reopened, "kept", value, sizeof(value));
+    EXPECT_LT(reopened.GetFileSize(), static_cast<off_t>(3 * sizeof(value)));
+}
+
+// A file written by ChipLinuxStorage is converted, and kept as a backup.
+TEST_F(TestLinuxStorageLog, TestConvertIni)
+{
+    const uint8_t value1[] = { 0, 1, 2, '=', '\n' };
+    const uint8_t value2[] = { 0xff };
+    {
+        ChipLinuxStorage iniStorage;
+        ASSERT_EQ(iniStorage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(iniStorage.WriteValueBin("a key=with [chars]", value1, sizeof(value1)), CHIP_NO_ERROR);
+        EXPECT_EQ(iniStorage.WriteValueBin("b", value2, sizeof(value2)), CHIP_NO_ERROR);
+        EXPECT_EQ(iniStorage.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "a key=with [chars]", value1, sizeof(value1));
+    ExpectValue(storage, "b", value2, sizeof(value2));
+
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(reopened, "b", value2, sizeof(value2));
+
+    ChipLinuxStorage backup;
+    ASSERT_EQ(backup.Init(mIniBackupPath.c_str()), CHIP_NO_ERROR);
+    uint8_t buf[sizeof(value1)];
+    size_t length = 0;
+    EXPECT_EQ(backup.ReadValueBin("a key=with [chars]", buf, sizeof(buf), length), CHIP_NO_ERROR);
+    EXPECT_EQ(length, sizeof(value1));
+    EXPECT_EQ(memcmp(buf, value1, sizeof(value1)), 0);
+}
+
+// With a store holding many values, as with large fabric, group and scene tables, each put and commit only appends its records
+// to the file, and rewriting the file once most of it is overwritten records at most doubles the bytes written.  The INI file
+// KVS rewrites the whole file, more than kNumKeys * kValueSize bytes, for each commit.
+TEST_F(TestLinuxStorageLog, TestBytesWritten)
+{
+    constexpr size_t kNumKeys      = 500;
+    constexpr size_t kValueSize    = 128;
+    constexpr uint32_t kNumUpdates = 2000;
+
+    uint8_t value[kValueSize];
+    memset(value, 0xa5, sizeof(value));
+    char key[32];
+
+    ChipLinuxStorageLog storage;
+    ASSERT_EQ(storage.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    for (size_t i = 0; i < kNumKeys; i++)
+    {
+        snprintf(key, sizeof(key), "f/1/k/%u", static_cast<unsigned>(i));
+        ASSERT_EQ(storage.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(storage.Commit(), CHIP_NO_ERROR);
+
+    // Overwritten records never take more than half of the file once it is larger than kMinCompactionSize.
+    const uint64_t bytesBefore = storage.GetBytesWritten();
+    const off_t maxFileSize    = std::max(ChipLinuxStorageLog::kMinCompactionSize, 2 * storage.GetFileSize());
+    for (uint32_t i = 0; i < kNumUpdates; i++)
+    {
+        snprintf(key, sizeof(key), "f/1/k/%u", static_cast<unsigned>((i * 7) % kNumKeys));
+        memcpy(value, &i, sizeof(i));
+        ASSERT_EQ(storage.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+        ASSERT_EQ(storage.Commit(), CHIP_NO_ERROR);
+        ASSERT_LE(storage.GetFileSize(), maxFileSize);
+    }
+
+    // Each put appends a value record and a commit record, both much smaller than twice the value.
+    EXPECT_LE((storage.GetBytesWritten() - bytesBefore) / kNumUpdates, 4 * kValueSize);
+
+    ChipLinuxStorageLog reopened;
+    ASSERT_EQ(reopened.Init(mLogPath.c_str()), CHIP_NO_ERROR);
+    snprintf(key, sizeof(key), "f/1/k/%u", static_cast<unsigned>(((kNumUpdates - 1) * 7) % kNumKeys));
+    ExpectValue(reopened, key, value, sizeof(value));
+}
+
+} // namespace
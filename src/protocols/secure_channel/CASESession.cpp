@@ -369,6 +369,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->CancelWork();
+        mSendSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -889,17 +894,8 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     switch (nextStep.Get<Step>())
     {
     case Step::kSendSigma2: {
-
-        System::PacketBufferHandle msgR2;
-        EncodeSigma2Inputs encodeSigma2;
-
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
-        SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
-
-        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
-        SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
-
-        mDelegate->OnSessionEstablishmentStarted();
+        // Sigma2 is sent, and the delegate notified, by SendSigma2c, possibly once the work done in the background completes.
+        SuccessOrExit(err = SendSigma2a());
         break;
     }
     case Step::kSendSigma2Resume: {
@@ -1155,39 +1151,159 @@ CHIP_ERROR CASESession::SendSigma2Resume(System::PacketBufferHandle && msgR2Resu
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
+CHIP_ERROR CASESession::SendSigma2a()
 {
+    MATTER_TRACE_SCOPE("SendSigma2", "CASESession");
 
-    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
+    auto helper = WorkHelper<SendSigma2Data>::Create(*this, &SendSigma2b, &CASESession::SendSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    {
+        auto & data = helper->mData;
 
-    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
+        VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        data.fabricIndex = mFabricIndex;
+        data.fabricTable = nullptr;
+        data.keystore    = nullptr;
+
+        {
+            const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+            auto * keystore = mFabricsTable->GetOperationalKeystore();
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            {
+                // NOTE: used to generate the ephemeral key, derive the shared secret and sign in background.
+                data.keystore = keystore;
+            }
+            else
+            {
+                // NOTE: used to do all of it in foreground.
+                data.fabricTable = mFabricsTable;
+            }
+        }
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
-    VerifyOrReturnError(icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(data.icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.icaCert = MutableByteSpan{ data.icacBuf.Get(), kMaxCHIPCertLength };
 
-    chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
-    VerifyOrReturnError(nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        VerifyOrReturnError(data.nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.nocCert = MutableByteSpan{ data.nocBuf.Get(), kMaxCHIPCertLength };
 
-    MutableByteSpan icaCert{ icacBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, data.icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, data.nocCert));
 
-    MutableByteSpan nocCert{ nocBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, nocCert));
+        // The keypair is only allocated here: generating it is part of the work.
+        data.ephemeralKeyAllocator = mFabricsTable;
+        data.ephemeralKey          = mFabricsTable->AllocateEphemeralKeypairForCASE();
+        VerifyOrReturnError(data.ephemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
 
-    // Fill in the random value
-    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
+        data.remotePubKey = mRemotePubKey;
 
+        if (data.keystore != nullptr)
+        {
+            ReturnErrorOnFailure(helper->ScheduleWork());
+            mSendSigma2Helper = helper;
+            mExchangeCtxt.Value()->WillSendMessage();
+            mState = State::kSendSigma2Pending;
+        }
+        else
+        {
+            ReturnErrorOnFailure(helper->DoWork());
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data, bool & cancel)
+{
     // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
-    outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
+    ReturnErrorOnFailure(data.ephemeralKey->Initialize(ECPKeyTarget::ECDH));
 
     // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
+    ReturnErrorOnFailure(data.ephemeralKey->ECDH_derive_secret(data.remotePubKey, data.sharedSecret));
+
+    // Construct Sigma2 TBS Data
+    size_t msgR2SignedLen = EstimateStructOverhead(kMaxCHIPCertLength,     // responderNoc
+                                                   kMaxCHIPCertLength,     // responderICAC
+                                                   kP256_PublicKey_Length, // responderEphPubKey
+                                                   kP256_PublicKey_Length  // InitiatorEphPubKey
+    );
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+    VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+    MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
+
+    ReturnErrorOnFailure(ConstructTBSData(data.nocCert, data.icaCert,
+                                          ByteSpan(data.ephemeralKey->Pubkey(), data.ephemeralKey->Pubkey().Length()),
+                                          ByteSpan(data.remotePubKey, data.remotePubKey.Length()), msgR2SignedSpan));
+
+    // Generate a Signature
+    if (data.keystore != nullptr)
+    {
+        // Recommended case: delegate to operational keystore
+        ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, msgR2SignedSpan, data.tbsData2Signature));
+    }
+    else
+    {
+        // Legacy case: delegate to fabric table fabric info
+        ReturnErrorOnFailure(data.fabricTable->SignWithOpKeypair(data.fabricIndex, msgR2SignedSpan, data.tbsData2Signature));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    System::PacketBufferHandle msgR2;
+    EncodeSigma2Inputs encodeSigma2;
+
+    VerifyOrDieWithMsg(data.keystore == nullptr || mState == State::kSendSigma2Pending, SecureChannel, "Bad internal state.");
+
+    SuccessOrExit(err = status);
+
+    // The session owns the ephemeral keypair from now on, and releases it in Clear().
+    mEphemeralKey     = data.ephemeralKey;
+    data.ephemeralKey = nullptr;
+    mSharedSecret     = data.sharedSecret;
+
+    SuccessOrExit(err = PrepareSigma2(data, encodeSigma2));
+    SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
+
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
+    SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
+
+    mDelegate->OnSessionEstablishmentStarted();
+
+exit:
+    mSendSigma2Helper.reset();
+
+    // If data.keystore is set, processing occurred in the background, so if an error occurred,
+    // need to send status report (normally occurs in HandleSigma1_and_SendSigma2), and discard
+    // exchange and abort pending establish (normally occurs in OnMessageReceived).
+    if (data.keystore != nullptr && err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
+}
+
+CHIP_ERROR CASESession::PrepareSigma2(SendSigma2Data & data, EncodeSigma2Inputs & outSigma2Data)
+{
+    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
+
+    VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_INTERNAL);
+    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
+
+    // Fill in the random value
+    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
+
+    outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
 
     uint8_t msgSalt[kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length];
 
@@ -1198,29 +1314,10 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
     AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
     ReturnErrorOnFailure(DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
 
-    // Construct Sigma2 TBS Data
-    P256ECDSASignature tbsData2Signature;
-    {
-        size_t msgR2SignedLen = EstimateStructOverhead(kMaxCHIPCertLength,     // responderNoc
-                                                       kMaxCHIPCertLength,     // responderICAC
-                                                       kP256_PublicKey_Length, // responderEphPubKey
-                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
-        );
-
-        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-        VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-        MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
-
-        ReturnErrorOnFailure(ConstructTBSData(nocCert, icaCert, ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msgR2SignedSpan));
-
-        // Generate a Signature
-        ReturnErrorOnFailure(mFabricsTable->SignWithOpKeypair(mFabricIndex, msgR2SignedSpan, tbsData2Signature));
-    }
     // Construct Sigma2 TBE Data
-    size_t msgR2SignedEncLen = EstimateStructOverhead(nocCert.size(),                             // responderNoc
-                                                      icaCert.size(),                             // responderICAC
-                                                      tbsData2Signature.Length(),                 // signature
+    size_t msgR2SignedEncLen = EstimateStructOverhead(data.nocCert.size(),                        // responderNoc
+                                                      data.icaCert.size(),                        // responderICAC
+                                                      data.tbsData2Signature.Length(),            // signature
                                                       SessionResumptionStorage::kResumptionIdSize // resumptionID
     );
 
@@ -1234,28 +1331,28 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
 
     ReturnErrorOnFailure(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerContainerType));
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *nocCert.data() ^= 0xFF);
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *icaCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2NOC, *data.nocCert.data() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2ICAC, *data.icaCert.data() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), nocCert));
-    if (!icaCert.empty())
+    ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderNOC), data.nocCert));
+    if (!data.icaCert.empty())
     {
-        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), icaCert));
+        ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), data.icaCert));
     }
 
     // We are now done with ICAC and NOC certs so we can release the memory.
     {
-        icacBuf.Free();
-        icaCert = MutableByteSpan{};
+        data.icacBuf.Free();
+        data.icaCert = MutableByteSpan{};
 
-        nocBuf.Free();
-        nocCert = MutableByteSpan{};
+        data.nocBuf.Free();
+        data.nocCert = MutableByteSpan{};
     }
 
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *tbsData2Signature.Bytes() ^= 0xFF);
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *data.tbsData2Signature.Bytes() ^= 0xFF);
 
-    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
-                                            static_cast<uint32_t>(tbsData2Signature.Length())));
+    ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), data.tbsData2Signature.ConstBytes(),
+                                            static_cast<uint32_t>(data.tbsData2Signature.Length())));
 
     // Generate a new resumption ID
     ReturnErrorOnFailure(DRBG_get_bytes(mNewResumptionId.data(), mNewResumptionId.size()));
@@ -2646,6 +2743,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mSendSigma2Helper && mSendSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "SendSigma2Helper was unable to schedule the AfterWorkCallback");
+        mSendSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2673,6 +2777,8 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma1:
     case State::kSentSigma1Resume:
         return SessionEstablishmentStage::kSentSigma1;
+    case State::kSendSigma2Pending:
+        return SessionEstablishmentStage::kReceivedSigma1;
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
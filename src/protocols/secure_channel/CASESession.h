@@ -182,6 +182,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kSendSigma2Pending   = 10,
     };
 
     State GetState() { return mState; }
@@ -290,6 +291,39 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct SendSigma2Data
+    {
+        ~SendSigma2Data()
+        {
+            // Still set if the work failed or was canceled, before the session could take over the keypair.
+            if (ephemeralKey != nullptr)
+            {
+                ephemeralKeyAllocator->ReleaseEphemeralKeypair(ephemeralKey);
+            }
+        }
+
+        FabricIndex fabricIndex;
+
+        // Use one or the other
+        const FabricTable * fabricTable;
+        const Crypto::OperationalKeystore * keystore;
+
+        // Allocated in the foreground, generated along with the shared secret, then handed over to the session.
+        FabricTable * ephemeralKeyAllocator = nullptr;
+        Crypto::P256Keypair * ephemeralKey  = nullptr;
+
+        Crypto::P256PublicKey remotePubKey;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
+        MutableByteSpan icaCert;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
+        MutableByteSpan nocCert;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -493,7 +527,10 @@ private:
     CHIP_ERROR TryResumeSession(SessionResumptionStorage::ConstResumptionIdView resumptionId, ByteSpan resume1MIC,
                                 ByteSpan initiatorRandom);
 
-    CHIP_ERROR PrepareSigma2(EncodeSigma2Inputs & output);
+    CHIP_ERROR SendSigma2a();
+    static CHIP_ERROR SendSigma2b(SendSigma2Data & data, bool & cancel);
+    CHIP_ERROR SendSigma2c(SendSigma2Data & data, CHIP_ERROR status);
+    CHIP_ERROR PrepareSigma2(SendSigma2Data & data, EncodeSigma2Inputs & output);
     CHIP_ERROR PrepareSigma2Resume(EncodeSigma2ResumeInputs & output);
     CHIP_ERROR SendSigma2(System::PacketBufferHandle && msg_R2);
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
@@ -514,8 +551,8 @@ private:
     CHIP_ERROR DeriveSigmaKey(const ByteSpan & salt, const ByteSpan & info, AutoReleaseSessionKey & key) const;
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
-    CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
-                                const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
+    static CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
+                                       const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
     CHIP_ERROR ConstructSaltSigma3(const ByteSpan & ipk, MutableByteSpan & salt);
 
     CHIP_ERROR ConstructSigmaResumeKey(const ByteSpan & initiatorRandom, const ByteSpan & resumptionID, const ByteSpan & skInfo,
@@ -585,6 +622,7 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<SendSigma2Data>> mSendSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
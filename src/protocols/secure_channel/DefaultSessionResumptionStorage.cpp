@@ -17,7 +17,10 @@
 
 #include <protocols/secure_channel/DefaultSessionResumptionStorage.h>
 
+#include <algorithm>
+
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 
 namespace chip {
@@ -25,18 +28,44 @@ namespace chip {
 CHIP_ERROR DefaultSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+    CacheEntry * entry = FindCacheEntry(node);
+    if (entry != nullptr)
+    {
+        ++mCacheHits;
+        Touch(*entry);
+        resumptionId = entry->mResumptionId;
+        sharedSecret = entry->mSharedSecret;
+        peerCATs     = entry->mPeerCATs;
+        return CHIP_NO_ERROR;
+    }
+
+    ++mCacheMisses;
     ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+    UpdateCache(node, ConstResumptionIdView(resumptionId.data()), sharedSecret, peerCATs);
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
                                                                Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
 {
+    CacheEntry * entry = FindCacheEntry(resumptionId);
+    if (entry != nullptr)
+    {
+        ++mCacheHits;
+        Touch(*entry);
+        node         = entry->mNode;
+        sharedSecret = entry->mSharedSecret;
+        peerCATs     = entry->mPeerCATs;
+        return CHIP_NO_ERROR;
+    }
+
+    ++mCacheMisses;
     ReturnErrorOnFailure(FindNodeByResumptionId(resumptionId, node));
     ResumptionIdStorage tmpResumptionId;
-    ReturnErrorOnFailure(FindByScopedNodeId(node, tmpResumptionId, sharedSecret, peerCATs));
+    ReturnErrorOnFailure(LoadState(node, tmpResumptionId, sharedSecret, peerCATs));
     VerifyOrReturnError(std::equal(tmpResumptionId.begin(), tmpResumptionId.end(), resumptionId.begin(), resumptionId.end()),
                         CHIP_ERROR_KEY_NOT_FOUND);
+    UpdateCache(node, resumptionId, sharedSecret, peerCATs);
     return CHIP_NO_ERROR;
 }
 
@@ -49,6 +78,27 @@ CHIP_ERROR DefaultSessionResumptionStorage::FindNodeByResumptionId(ConstResumpti
 CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
 {
+    CacheEntry * entry = FindCacheEntry(node);
+    if (entry != nullptr)
+    {
+        // The node is already in the index and its previous resumption ID is known, so save in place without reading
+        // persistent storage.  Removal of the old link is best effort, as below.
+        CHIP_ERROR err = DeleteLink(ConstResumptionIdView(entry->mResumptionId.data()));
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            ChipLogError(SecureChannel,
+                         "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                         ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node.GetNodeId()), err.Format());
+        }
+        // The entry no longer matches persistent storage if saving fails.
+        ClearCacheEntry(*entry);
+        ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+        ReturnErrorOnFailure(SaveLink(resumptionId, node));
+        UpdateCache(node, resumptionId, sharedSecret, peerCATs);
+        return CHIP_NO_ERROR;
+    }
+
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
 
@@ -86,6 +136,7 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
             }
             ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
             ReturnErrorOnFailure(SaveLink(resumptionId, node));
+            UpdateCache(node, resumptionId, sharedSecret, peerCATs);
             return CHIP_NO_ERROR;
         }
     }
@@ -102,12 +153,19 @@ CHIP_ERROR DefaultSessionResumptionStorage::Save(const ScopedNodeId & node, Cons
 
     index.mNodes[index.mSize++] = node;
     ReturnErrorOnFailure(SaveIndex(index));
+    UpdateCache(node, resumptionId, sharedSecret, peerCATs);
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 {
+    CacheEntry * entry = FindCacheEntry(node);
+    if (entry != nullptr)
+    {
+        ClearCacheEntry(*entry);
+    }
+
     SessionIndex index;
     ReturnErrorOnFailure(LoadIndex(index));
 
@@ -183,6 +241,14 @@ CHIP_ERROR DefaultSessionResumptionStorage::Delete(const ScopedNodeId & node)
 
 CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
 {
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUse != 0 && entry.mNode.GetFabricIndex() == fabricIndex)
+        {
+            ClearCacheEntry(entry);
+        }
+    }
+
     CHIP_ERROR stickyErr = CHIP_NO_ERROR;
     size_t found         = 0;
     SessionIndex index;
@@ -254,4 +320,59 @@ CHIP_ERROR DefaultSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
     return stickyErr;
 }
 
+DefaultSessionResumptionStorage::CacheEntry * DefaultSessionResumptionStorage::FindCacheEntry(const ScopedNodeId & node)
+{
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUse != 0 && entry.mNode == node)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+DefaultSessionResumptionStorage::CacheEntry * DefaultSessionResumptionStorage::FindCacheEntry(ConstResumptionIdView resumptionId)
+{
+    for (auto & entry : mCache)
+    {
+        if (entry.mLastUse != 0 &&
+            std::equal(entry.mResumptionId.begin(), entry.mResumptionId.end(), resumptionId.begin(), resumptionId.end()))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void DefaultSessionResumptionStorage::UpdateCache(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                  const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    CacheEntry * entry = FindCacheEntry(node);
+    if (entry == nullptr)
+    {
+        // Take a free entry if there is one, and otherwise the least recently used one.
+        for (auto & candidate : mCache)
+        {
+            if (entry == nullptr || candidate.mLastUse < entry->mLastUse)
+            {
+                entry = &candidate;
+            }
+        }
+        VerifyOrReturn(entry != nullptr);
+    }
+
+    entry->mNode = node;
+    std::copy(resumptionId.begin(), resumptionId.end(), entry->mResumptionId.begin());
+    entry->mSharedSecret = sharedSecret;
+    entry->mPeerCATs     = peerCATs;
+    Touch(*entry);
+}
+
+void DefaultSessionResumptionStorage::ClearCacheEntry(CacheEntry & entry)
+{
+    entry.mLastUse = 0;
+    entry.mSharedSecret.Clear();
+}
+
 } // namespace chip
@@ -19,6 +19,9 @@
 
 #include <protocols/secure_channel/SessionResumptionStorage.h>
 
+#include <algorithm>
+#include <array>
+
 namespace chip {
 
 /**
@@ -29,12 +32,23 @@ namespace chip {
  *   The implementation saves 2 maps:
  *     * <FabricIndex, PeerNodeId>   => <ResumptionId, ShareSecret, PeerCATs>
  *     * <ResumptionId>              => <FabricIndex, PeerNodeId>
+ *
+ *   The kMemoryCacheSize most recently used entries are also kept in memory, so that resuming
+ *   a session with a recent peer does not read persistent storage.  Every change is written through to persistent storage, which
+ *   must not be modified other than through this object.
  */
 class DefaultSessionResumptionStorage : public SessionResumptionStorage
 {
 public:
     using ResumptionIdView = FixedSpan<uint8_t, kResumptionIdSize>;
 
+    /**
+     * Number of entries kept in memory: CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE, but no more than persistent storage
+     * holds (CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE).
+     */
+    static constexpr size_t kMemoryCacheSize =
+        std::min<size_t>(CHIP_CONFIG_CASE_SESSION_RESUME_MEMORY_CACHE_SIZE, CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE);
+
     struct SessionIndex
     {
         size_t mSize;
@@ -53,6 +67,13 @@ public:
     CHIP_ERROR Delete(const ScopedNodeId & node);
     CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
 
+    /**
+     * Numbers of the lookups, by node or by resumption ID, that were answered from memory (hits) and that had to read
+     * persistent storage (misses).
+     */
+    uint32_t GetCacheHits() const { return mCacheHits; }
+    uint32_t GetCacheMisses() const { return mCacheMisses; }
+
 protected:
     CHIP_ERROR virtual SaveIndex(const SessionIndex & index) = 0;
     CHIP_ERROR virtual LoadIndex(SessionIndex & index)       = 0;
@@ -66,6 +87,29 @@ protected:
     CHIP_ERROR virtual LoadState(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)             = 0;
     CHIP_ERROR virtual DeleteState(const ScopedNodeId & node)                                                    = 0;
+
+private:
+    struct CacheEntry
+    {
+        // 0 for a free entry; otherwise, the higher, the more recently used.
+        uint64_t mLastUse = 0;
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        Crypto::P256ECDHDerivedSecret mSharedSecret;
+        CATValues mPeerCATs;
+    };
+
+    CacheEntry * FindCacheEntry(const ScopedNodeId & node);
+    CacheEntry * FindCacheEntry(ConstResumptionIdView resumptionId);
+    void UpdateCache(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                     const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs);
+    void Touch(CacheEntry & entry) { entry.mLastUse = ++mCacheUseCounter; }
+    static void ClearCacheEntry(CacheEntry & entry);
+
+    std::array<CacheEntry, kMemoryCacheSize> mCache;
+    uint64_t mCacheUseCounter = 0;
+    uint32_t mCacheHits       = 0;
+    uint32_t mCacheMisses     = 0;
 };
 
 } // namespace chip
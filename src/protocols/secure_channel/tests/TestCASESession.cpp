@@ -24,6 +24,9 @@
 
 #include <stdarg.h>
 
+#include <condition_variable>
+#include <mutex>
+
 #include <pw_unit_test/framework.h>
 
 #include "credentials/tests/CHIPCert_test_vectors.h"
@@ -46,6 +49,11 @@
 #include <messaging/tests/MessagingContext.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/CASESession.h>
+#include <system/SystemClock.h>
+
+// Whether background work is processed by several tasks at once, so that the Sigma2 work of several CASE sessions can overlap.
+#define CASE_TEST_PARALLEL_BACKGROUND_WORK                                                                                         \
+    (CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && CHIP_DEVICE_CONFIG_BG_TASK_POOL_SIZE > 1)
 
 using namespace chip;
 using namespace Credentials;
@@ -233,21 +241,102 @@ public:
 
     void RevertPendingKeypair() override {}
 
+    void SetSignInBackground(bool signInBackground) { mSignInBackground = signInBackground; }
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSignInBackground; }
+
     CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                  Crypto::P256ECDSASignature & outSignature) const override
     {
-        VerifyOrReturnError(mKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
-        VerifyOrReturnError(fabricIndex == mSingleFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
-        return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+        std::unique_lock<std::mutex> lock(mSignersLock);
+        mNumSigners++;
+        mMaxConcurrentSigners = std::max(mMaxConcurrentSigners, mNumSigners);
+        if (mAwaitConcurrentSigner)
+        {
+            // Give another background task the chance to start signing too, without ever blocking for good.
+            mSignersCond.notify_all();
+            mSignersCond.wait_for(lock, std::chrono::seconds(1), [this] { return mMaxConcurrentSigners > 1; });
+        }
+        lock.unlock();
+
+        CHIP_ERROR err = SignWithOpKeypairSerialized(fabricIndex, message, outSignature);
+
+        lock.lock();
+        mNumSigners--;
+        return err;
+#else
+        return SignWithOpKeypairSerialized(fabricIndex, message, outSignature);
+#endif
+    }
+
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+    // When set, each signer waits until another one signs at the same time, so that the background tasks are seen
+    // working concurrently.
+    void SetAwaitConcurrentSigner(bool awaitConcurrentSigner) { mAwaitConcurrentSigner = awaitConcurrentSigner; }
+
+    size_t GetMaxConcurrentSigners() const
+    {
+        std::lock_guard<std::mutex> lock(mSignersLock);
+        return mMaxConcurrentSigners;
+    }
+
+    void ResetMaxConcurrentSigners()
+    {
+        std::lock_guard<std::mutex> lock(mSignersLock);
+        mMaxConcurrentSigners = 0;
     }
+#endif
 
     Crypto::P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<Crypto::P256Keypair>(); }
 
     void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override { Platform::Delete<Crypto::P256Keypair>(keypair); }
 
 protected:
+    // Signs with the keypair, which may only be used by one task at a time.
+    CHIP_ERROR SignWithOpKeypairSerialized(FabricIndex fabricIndex, const ByteSpan & message,
+                                           Crypto::P256ECDSASignature & outSignature) const
+    {
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+        std::lock_guard<std::mutex> lock(mKeypairLock);
+#endif
+        VerifyOrReturnError(mKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(fabricIndex == mSingleFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
+        return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+    }
+
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+    bool mSignInBackground         = false;
+
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+    mutable std::mutex mKeypairLock;
+    mutable std::mutex mSignersLock;
+    mutable std::condition_variable mSignersCond;
+    mutable size_t mNumSigners           = 0;
+    mutable size_t mMaxConcurrentSigners = 0;
+    bool mAwaitConcurrentSigner          = false;
+#endif
+};
+
+// Hands each Sigma1 received to the next of several responders, so that they establish sessions concurrently.
+class TestCASEResponderPool : public Messaging::UnsolicitedMessageHandler
+{
+public:
+    TestCASEResponderPool(CASESession * responders, size_t numResponders) :
+        mResponders(responders), mNumResponders(numResponders)
+    {}
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        VerifyOrReturnError(mNextResponder < mNumResponders, CHIP_ERROR_NO_MEMORY);
+        newDelegate = &mResponders[mNextResponder++];
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    CASESession * mResponders;
+    size_t mNumResponders;
+    size_t mNextResponder = 0;
 };
 
 #if CHIP_CONFIG_SLOW_CRYPTO
@@ -544,6 +633,114 @@ TEST_F(TestCASESession, SecurePairingHandshakeTest)
     SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
 }
 
+TEST_F(TestCASESession, SecurePairingHandshakeBackgroundSigma2Test)
+{
+    // The accessory generates its ephemeral key, derives the shared secret and signs Sigma2 in the background.
+    gDeviceOperationalKeystore.SetSignInBackground(true);
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    gDeviceOperationalKeystore.SetSignInBackground(false);
+}
+
+// Checks that every handshake completes when several initiators establish sessions with the accessory at the same time,
+// over several rounds that reuse the sessions, with the accessory's Sigma2 work done in the foreground, then in the
+// background.  Where background work is processed by several tasks (CASE_TEST_PARALLEL_BACKGROUND_WORK), also checks
+// that the Sigma2 work of several sessions actually runs concurrently.
+TEST_F(TestCASESession, ConcurrentHandshakes)
+{
+    // Each handshake uses an unauthenticated session on either side, and both sides share the pool here.
+    constexpr size_t kNumConcurrentHandshakes = CHIP_CONFIG_UNAUTHENTICATED_CONNECTION_POOL_SIZE / 2;
+    constexpr uint32_t kNumRounds             = 10;
+
+    EXPECT_SUCCESS(chip::DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask());
+
+    for (bool signInBackground : { false, true })
+    {
+        gDeviceOperationalKeystore.SetSignInBackground(signInBackground);
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+        gDeviceOperationalKeystore.SetAwaitConcurrentSigner(signInBackground);
+        gDeviceOperationalKeystore.ResetMaxConcurrentSigners();
+#endif
+
+        size_t numEstablished = 0;
+
+        for (uint32_t round = 0; round < kNumRounds; round++)
+        {
+            TemporarySessionManager sessionManager(*this);
+            TestCASESecurePairingDelegate delegateCommissioner;
+            TestCASESecurePairingDelegate delegateAccessory;
+            CASESession pairingCommissioners[kNumConcurrentHandshakes];
+            CASESession pairingAccessories[kNumConcurrentHandshakes];
+            TestCASEResponderPool responderPool(pairingAccessories, kNumConcurrentHandshakes);
+
+            EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                                    &responderPool),
+                      CHIP_NO_ERROR);
+
+            for (CASESession & pairingAccessory : pairingAccessories)
+            {
+                pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+                EXPECT_EQ(pairingAccessory.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr,
+                                                                          &delegateAccessory, ScopedNodeId(), NullOptional),
+                          CHIP_NO_ERROR);
+            }
+
+            for (CASESession & pairingCommissioner : pairingCommissioners)
+            {
+                pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+                ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+                EXPECT_EQ(pairingCommissioner.EstablishSession(
+                              sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex },
+                              contextCommissioner, nullptr, nullptr, &delegateCommissioner, NullOptional),
+                          CHIP_NO_ERROR);
+            }
+
+            // Work done in background tasks completes asynchronously.
+            const System::Clock::Timestamp deadline = System::SystemClock().GetMonotonicTimestamp() + System::Clock::Seconds16(10);
+            while (delegateCommissioner.mNumPairingComplete + delegateCommissioner.mNumPairingErrors < kNumConcurrentHandshakes &&
+                   System::SystemClock().GetMonotonicTimestamp() < deadline)
+            {
+                ServiceEvents();
+            }
+
+            EXPECT_EQ(delegateAccessory.mNumPairingComplete, kNumConcurrentHandshakes);
+            EXPECT_EQ(delegateCommissioner.mNumPairingComplete, kNumConcurrentHandshakes);
+            EXPECT_EQ(delegateAccessory.mNumPairingErrors, 0u);
+            EXPECT_EQ(delegateCommissioner.mNumPairingErrors, 0u);
+            numEstablished += delegateCommissioner.mNumPairingComplete;
+
+            EXPECT_SUCCESS(
+                GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1));
+        }
+
+        EXPECT_EQ(numEstablished, kNumRounds * kNumConcurrentHandshakes);
+
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+        // Signing in the foreground is serialized by the CHIP task, while the background tasks sign for several sessions
+        // at once.
+        if (signInBackground)
+        {
+            EXPECT_GE(gDeviceOperationalKeystore.GetMaxConcurrentSigners(), 2u);
+        }
+        else
+        {
+            EXPECT_EQ(gDeviceOperationalKeystore.GetMaxConcurrentSigners(), 1u);
+        }
+#endif
+    }
+
+    gDeviceOperationalKeystore.SetSignInBackground(false);
+#if CASE_TEST_PARALLEL_BACKGROUND_WORK
+    gDeviceOperationalKeystore.SetAwaitConcurrentSigner(false);
+#endif
+    EXPECT_SUCCESS(chip::DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask());
+}
+
 TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
 {
     // TODO: Add cases for mismatching IPK config between initiator/responder
@@ -389,3 +389,168 @@ TEST(TestDefaultSessionResumptionStorage, TestDeleteAll)
         }
     }
 }
+
+TEST(TestDefaultSessionResumptionStorage, TestMemoryCache)
+{
+    constexpr size_t kCacheSize = chip::DefaultSessionResumptionStorage::kMemoryCacheSize;
+    if (kCacheSize == 0)
+    {
+        GTEST_SKIP() << "Skipping test: no session resumption entries are kept in memory";
+    }
+
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    chip::TestPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(sessionStorage.Init(&storage));
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } vectors[CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE];
+
+    EXPECT_SUCCESS(sharedSecret.SetLength(sharedSecret.Capacity()));
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(vectors); ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(vectors[i].resumptionId.data(), vectors[i].resumptionId.size()), CHIP_NO_ERROR);
+        *vectors[i].resumptionId.data() = static_cast<uint8_t>(i);
+        vectors[i].node = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i % 3 + 1));
+        EXPECT_EQ(sessionStorage.Save(vectors[i].node, vectors[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    // Make every read of persistent storage fail: only the most recently saved entries can still be found.
+    for (auto & vector : vectors)
+    {
+        storage.AddPoisonKey(chip::SimpleSessionResumptionStorage::GetStorageKey(vector.node).KeyName());
+        storage.AddPoisonKey(chip::SimpleSessionResumptionStorage::GetStorageKey(vector.resumptionId).KeyName());
+    }
+    for (size_t i = 0; i < MATTER_ARRAY_SIZE(vectors); ++i)
+    {
+        chip::ScopedNodeId outNode;
+        chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+        chip::CATValues outCats;
+        CHIP_ERROR err = sessionStorage.FindByResumptionId(vectors[i].resumptionId, outNode, outSharedSecret, outCats);
+        if (i + kCacheSize >= MATTER_ARRAY_SIZE(vectors))
+        {
+            EXPECT_EQ(err, CHIP_NO_ERROR);
+            EXPECT_EQ(outNode, vectors[i].node);
+            EXPECT_EQ(memcmp(outSharedSecret.ConstBytes(), sharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+        }
+        else
+        {
+            EXPECT_NE(err, CHIP_NO_ERROR);
+        }
+    }
+    EXPECT_EQ(sessionStorage.GetCacheHits(), kCacheSize);
+    EXPECT_EQ(sessionStorage.GetCacheMisses(), MATTER_ARRAY_SIZE(vectors) - kCacheSize);
+    storage.ClearPoisonKeys();
+
+    // An entry read from persistent storage replaces the least recently used one.  Nothing is ever evicted when the memory
+    // cache holds as many entries as persistent storage.
+    chip::SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+    chip::CATValues outCats;
+    if (kCacheSize < MATTER_ARRAY_SIZE(vectors))
+    {
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[0].node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outResumptionId, vectors[0].resumptionId);
+        EXPECT_EQ(sessionStorage.GetCacheMisses(), MATTER_ARRAY_SIZE(vectors) - kCacheSize + 1);
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[0].node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(sessionStorage.GetCacheHits(), kCacheSize + 1);
+        const size_t evicted = MATTER_ARRAY_SIZE(vectors) - kCacheSize;
+        EXPECT_EQ(sessionStorage.FindByScopedNodeId(vectors[evicted].node, outResumptionId, outSharedSecret, outCats),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(sessionStorage.GetCacheMisses(), MATTER_ARRAY_SIZE(vectors) - kCacheSize + 2);
+    }
+
+    // Saving a new resumption ID for a cached node writes it through to persistent storage and drops the old link.
+    auto & updated             = vectors[MATTER_ARRAY_SIZE(vectors) - 1];
+    const auto oldResumptionId = updated.resumptionId;
+    updated.resumptionId[1] ^= 0xff;
+    EXPECT_EQ(sessionStorage.Save(updated.node, updated.resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    EXPECT_FALSE(storage.HasKey(chip::SimpleSessionResumptionStorage::GetStorageKey(oldResumptionId).KeyName()));
+
+    // Every entry can be found by another storage object, which only reads persistent storage.
+    chip::SimpleSessionResumptionStorage otherSessionStorage;
+    EXPECT_SUCCESS(otherSessionStorage.Init(&storage));
+    for (auto & vector : vectors)
+    {
+        chip::ScopedNodeId outNode;
+        EXPECT_EQ(otherSessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+        EXPECT_EQ(outNode, vector.node);
+    }
+
+    // Deleting a fabric removes its entries from memory as well.
+    EXPECT_EQ(sessionStorage.DeleteAll(updated.node.GetFabricIndex()), CHIP_NO_ERROR);
+    EXPECT_NE(sessionStorage.FindByScopedNodeId(updated.node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+}
+
+// Resumes sessions as the responder of CASESession does: looks up the resumption ID of the Sigma1, then saves the new
+// resumption ID.  Once used, peers that fit in the memory cache are always served from memory, while cycling through more
+// peers than the cache holds always misses, as the least recently used entry is the next one needed.
+TEST(TestDefaultSessionResumptionStorage, TestRepeatedResumption)
+{
+    constexpr size_t kNumPeers    = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE;
+    constexpr size_t kCacheSize   = chip::DefaultSessionResumptionStorage::kMemoryCacheSize;
+    constexpr uint32_t kNumRounds = 4;
+
+    chip::SimpleSessionResumptionStorage sessionStorage;
+    chip::TestPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(sessionStorage.Init(&storage));
+    chip::Crypto::P256ECDHDerivedSecret sharedSecret;
+    struct
+    {
+        chip::SessionResumptionStorage::ResumptionIdStorage resumptionId;
+        chip::ScopedNodeId node;
+    } peers[kNumPeers];
+
+    EXPECT_SUCCESS(sharedSecret.SetLength(sharedSecret.Capacity()));
+    EXPECT_EQ(chip::Crypto::DRBG_get_bytes(sharedSecret.Bytes(), sharedSecret.Length()), CHIP_NO_ERROR);
+    for (size_t i = 0; i < kNumPeers; ++i)
+    {
+        EXPECT_EQ(chip::Crypto::DRBG_get_bytes(peers[i].resumptionId.data(), peers[i].resumptionId.size()), CHIP_NO_ERROR);
+        peers[i].node = chip::ScopedNodeId(static_cast<chip::NodeId>(i + 1), static_cast<chip::FabricIndex>(i % 3 + 1));
+        EXPECT_EQ(sessionStorage.Save(peers[i].node, peers[i].resumptionId, sharedSecret, chip::CATValues{}), CHIP_NO_ERROR);
+    }
+
+    auto resume = [&](size_t workingSet, uint32_t numRounds) {
+        for (size_t i = 0; i < workingSet * numRounds; ++i)
+        {
+            auto & peer = peers[i % workingSet];
+            chip::ScopedNodeId outNode;
+            chip::Crypto::P256ECDHDerivedSecret outSharedSecret;
+            chip::CATValues outCats;
+            EXPECT_EQ(sessionStorage.FindByResumptionId(peer.resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+            EXPECT_EQ(outNode, peer.node);
+            EXPECT_EQ(memcmp(outSharedSecret.ConstBytes(), sharedSecret.ConstBytes(), sharedSecret.Length()), 0);
+            peer.resumptionId[0]++;
+            EXPECT_EQ(sessionStorage.Save(outNode, peer.resumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+        }
+    };
+
+    if (kCacheSize > 0)
+    {
+        resume(kCacheSize, 1);
+        const uint32_t hits   = sessionStorage.GetCacheHits();
+        const uint32_t misses = sessionStorage.GetCacheMisses();
+        resume(kCacheSize, kNumRounds);
+        EXPECT_EQ(sessionStorage.GetCacheHits() - hits, kNumRounds * kCacheSize);
+        EXPECT_EQ(sessionStorage.GetCacheMisses(), misses);
+    }
+
+    resume(kNumPeers, 1);
+    const uint32_t hits   = sessionStorage.GetCacheHits();
+    const uint32_t misses = sessionStorage.GetCacheMisses();
+    resume(kNumPeers, kNumRounds);
+    if (kCacheSize < kNumPeers)
+    {
+        EXPECT_EQ(sessionStorage.GetCacheHits(), hits);
+        EXPECT_EQ(sessionStorage.GetCacheMisses() - misses, kNumRounds * kNumPeers);
+    }
+    else
+    {
+        EXPECT_EQ(sessionStorage.GetCacheHits() - hits, kNumRounds * kNumPeers);
+        EXPECT_EQ(sessionStorage.GetCacheMisses(), misses);
+    }
+}
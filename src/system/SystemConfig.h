@@ -119,6 +119,10 @@
     "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT && ( CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK || CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LWIP )"
 #endif
 
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && (CHIP_SYSTEM_CONFIG_USE_LIBEV || !CHIP_SYSTEM_CONFIG_USE_SOCKETS)
+#error "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_EPOLL && (CHIP_SYSTEM_CONFIG_USE_LIBEV || !CHIP_SYSTEM_CONFIG_USE_SOCKETS)"
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL && (CHIP_SYSTEM_CONFIG_USE_LIBEV || !CHIP_SYSTEM_CONFIG_USE_SOCKETS)
+
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK)
 #error "FORBIDDEN: CHIP_SYSTEM_CONFIG_MULTICAST_HOMING CAN ONLY BE USED WITH SOCKET IMPL OR Network.framework IMPL"
 #endif
@@ -412,6 +416,56 @@
 #error "See CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM"
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_TYPE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE
+ *
+ *  @brief
+ *      When packet buffers are allocated from the heap (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0), keep freed buffers
+ *      for reuse instead of returning them to the heap (1), or not (0).
+ *
+ *      Buffers are rounded up to one of two sizes, CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE or
+ *      \c PacketBuffer::kMaxSizeWithoutReserve, and freed buffers of those sizes are kept in a magazine of the freeing thread,
+ *      then in a depot shared by all threads.  Larger buffers are not cached.
+ *
+ *      Only worth enabling where the heap serializes allocations behind a global lock.  Heaps that already cache freed
+ *      blocks per thread, such as glibc malloc, gain nothing from it, so it stays off by default on every platform.
+ *
+ *      GN builds can set it with chip_system_config_packetbuffer_cache.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE
+ *
+ *  @brief
+ *      The allocation size, reserve included, of the small packet buffers kept by CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE 256
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE
+ *
+ *  @brief
+ *      The number of freed packet buffers of each size each thread keeps when CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE is set.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE 8
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_DEPOT_SIZE
+ *
+ *  @brief
+ *      The number of freed packet buffers of each size shared by all threads when CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE is set.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_DEPOT_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_DEPOT_SIZE 32
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_DEPOT_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX
  *
@@ -531,6 +585,30 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+ *
+ *  @brief
+ *      Use chip::System::TimerHeap instead of chip::System::TimerList to hold the pending timers of event loops that support it.
+ *
+ *      TimerList keeps timers in a sorted singly-linked list, so starting or cancelling a timer costs O(n). TimerHeap keeps them
+ *      in a pairing heap and indexes them by callback, which makes those operations O(log n) at the cost of a few extra pointers
+ *      per timer. This is worthwhile for devices (e.g. bridges) that keep hundreds of timers pending.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS
+ *
+ *  @brief
+ *      Number of hash buckets TimerHeap uses to look up timers by callback. Must be a power of two.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS 64
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
@@ -682,6 +760,18 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_VALID_REAL_TIME_THRESHOLD 946684800
 #endif // CHIP_SYSTEM_CONFIG_VALID_REAL_TIME_THRESHOLD
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_EPOLL
+ *
+ *  @brief
+ *      Use the Linux epoll-based System::Layer implementation (LayerImplEpoll).
+ *
+ *  This is set by the build system when chip_system_config_event_loop is "Epoll".
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_EPOLL
+#define CHIP_SYSTEM_CONFIG_USE_EPOLL 0
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
  *
@@ -690,10 +780,12 @@ struct LwIPEvent;
  *
  *  Use the POSIX pipe() function to create an anonymous data stream.
  *
- *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS).
+ *  Defaults to enabled if the system is using sockets (except for Zephyr RTOS, and for the epoll event loop, which
+ *  uses an eventfd instead).
  */
 #ifndef CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
-#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !defined(__ZEPHYR__) && !defined(__MBED__)
+#if (CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK) && !defined(__ZEPHYR__) && !defined(__MBED__) &&  \
+    !CHIP_SYSTEM_CONFIG_USE_EPOLL
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 1
 #else
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 0
@@ -56,6 +56,7 @@ namespace chip {
 namespace System {
 
 class Layer;
+class LayerSelectLoop;
 using TimerCompleteCallback = void (*)(Layer * aLayer, void * appState);
 
 /**
@@ -220,6 +221,11 @@ public:
         return ScheduleLambdaBridge(std::move(bridge));
     }
 
+    /**
+     * Returns this layer as a LayerSelectLoop if it is one, so that event loop handlers can be added to it, or nullptr.
+     */
+    virtual LayerSelectLoop * AsSelectLoop() { return nullptr; }
+
 private:
     CriticalFailure ScheduleLambdaBridge(LambdaBridge && bridge);
 
@@ -347,6 +353,8 @@ public:
     virtual void AddLoopHandler(EventLoopHandler & handler)    = 0;
     virtual void RemoveLoopHandler(EventLoopHandler & handler) = 0;
 
+    LayerSelectLoop * AsSelectLoop() override { return this; }
+
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     virtual void SetLibEvLoop(struct ev_loop * aLibEvLoopP) = 0;
     virtual struct ev_loop * GetLibEvLoop()                 = 0;
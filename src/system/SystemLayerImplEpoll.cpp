@@ -0,0 +1,332 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+namespace {
+
+CHIP_ERROR AddToEpoll(int epollFd, int fd, uint64_t tag)
+{
+    struct epoll_event event = {};
+    event.events             = EPOLLIN;
+    event.data.u64           = tag;
+    VerifyOrReturnError(::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) == 0, CHIP_ERROR_POSIX(errno));
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    ReturnErrorOnFailure(LayerImplSelect::Init());
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    mEpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    SuccessOrExit(err = AddToEpoll(mEpollFd, mWakeEvent.GetReadFD(), kWakeEventTag));
+    SuccessOrExit(err = AddToEpoll(mEpollFd, mTimerFd, kTimerFdTag));
+
+    mTimerFdArmed    = false;
+    mReadyEventCount = 0;
+    for (auto & events : mRegisteredEvents)
+    {
+        events = 0;
+    }
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        Shutdown();
+    }
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    LayerImplSelect::Shutdown();
+
+    if (mTimerFd >= 0)
+    {
+        ::close(mTimerFd);
+        mTimerFd = -1;
+    }
+    if (mEpollFd >= 0)
+    {
+        ::close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingRead(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::RequestCallbackOnPendingWrite(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingRead(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    ReturnErrorOnFailure(LayerImplSelect::ClearCallbackOnPendingWrite(token));
+    return UpdateSocketWatch(*reinterpret_cast<SocketWatch *>(token));
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    if (watch != nullptr && watch->mFD >= 0)
+    {
+        auto & registered = mRegisteredEvents[watch - mSocketWatchPool];
+        if (registered != 0)
+        {
+            // This fails harmlessly if the socket has already been closed, which also removes it from the epoll set.
+            (void) ::epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+            registered = 0;
+        }
+    }
+
+    return LayerImplSelect::StopWatchingSocket(tokenInOut);
+}
+
+CHIP_ERROR LayerImplEpoll::UpdateSocketWatch(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto & registered = mRegisteredEvents[&watch - mSocketWatchPool];
+    uint32_t wanted   = (watch.mPendingIO.Has(SocketEventFlags::kRead) ? static_cast<uint32_t>(EPOLLIN) : 0u) |
+        (watch.mPendingIO.Has(SocketEventFlags::kWrite) ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+    VerifyOrReturnError(wanted != registered, CHIP_NO_ERROR);
+
+    // Sockets without any requested events are left out of the epoll set entirely, since epoll would otherwise
+    // still report error and hang-up conditions on them.
+    int op = (wanted == 0) ? EPOLL_CTL_DEL : ((registered == 0) ? EPOLL_CTL_ADD : EPOLL_CTL_MOD);
+
+    struct epoll_event event = {};
+    event.events             = wanted;
+    event.data.u64           = static_cast<uint64_t>(&watch - mSocketWatchPool);
+    VerifyOrReturnError(::epoll_ctl(mEpollFd, op, watch.mFD, &event) == 0, CHIP_ERROR_POSIX(errno));
+
+    registered = wanted;
+    return CHIP_NO_ERROR;
+}
+
+void LayerImplEpoll::ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timeout sleepTime)
+{
+    VerifyOrReturn(!mTimerFdArmed || mTimerFdAwakenTime != awakenTime);
+
+    const Clock::Microseconds64 sleepTimeUs = sleepTime;
+
+    struct itimerspec spec = {};
+    spec.it_value.tv_sec   = static_cast<time_t>(sleepTimeUs.count() / kMicrosecondsPerSecond);
+    spec.it_value.tv_nsec  = static_cast<long>((sleepTimeUs.count() % kMicrosecondsPerSecond) * kNanosecondsPerMicrosecond);
+
+    if (::timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+
+        // Fall back to the epoll_wait() timeout.
+        mTimerFdArmed = false;
+        mEpollTimeout = static_cast<int>(std::min<Clock::Milliseconds64::rep>(
+            Clock::Milliseconds64(std::chrono::ceil<Clock::Milliseconds64>(sleepTime)).count(), INT32_MAX));
+        return;
+    }
+
+    mTimerFdArmed      = true;
+    mTimerFdAwakenTime = awakenTime;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    const Clock::Timestamp awakenTime  = PrepareAwakenTime(currentTime);
+
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+    Clock::ToTimeval(sleepTime, mNextTimeout);
+
+    if (sleepTime == Clock::kZero)
+    {
+        mEpollTimeout = 0;
+    }
+    else
+    {
+        mEpollTimeout = -1;
+        ArmTimerFd(awakenTime, sleepTime);
+    }
+
+    // EventSources are described in terms of fd_sets, so when any are registered WaitForEvents() select()s on their
+    // descriptors together with the epoll descriptor.
+    mMaxFd = -1;
+
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSelected.mReadSet);
+    FD_ZERO(&mSelected.mWriteSet);
+    FD_ZERO(&mSelected.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    for (auto & source : mSources)
+    {
+        source.PrepareEvents(mMaxFd, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet, mNextTimeout);
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    mReadyEventCount = 0;
+
+    if (mSources.Empty())
+    {
+        mSelectResult = ::epoll_wait(mEpollFd, mReadyEvents, kMaxReadyEvents, mEpollTimeout);
+        if (mSelectResult > 0)
+        {
+            mReadyEventCount = mSelectResult;
+        }
+        return;
+    }
+
+    FD_SET(mEpollFd, &mSelected.mReadSet);
+    mSelectResult = select(std::max(mMaxFd, mEpollFd) + 1, &mSelected.mReadSet, &mSelected.mWriteSet, &mSelected.mErrorSet,
+                           &mNextTimeout);
+    if (mSelectResult > 0 && FD_ISSET(mEpollFd, &mSelected.mReadSet))
+    {
+        mReadyEventCount = std::max(::epoll_wait(mEpollFd, mReadyEvents, kMaxReadyEvents, 0), 0);
+    }
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+    for (int i = 0; i < mReadyEventCount; i++)
+    {
+        if (mReadyEvents[i].data.u64 == kWakeEventTag)
+        {
+            mWakeEvent.Confirm();
+        }
+        else if (mReadyEvents[i].data.u64 == kTimerFdTag)
+        {
+            uint64_t expirations;
+            (void) ::read(mTimerFd, &expirations, sizeof(expirations));
+            mTimerFdArmed = false;
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    HandleExpiredTimers();
+
+    for (int i = 0; i < mReadyEventCount; i++)
+    {
+        const uint64_t tag = mReadyEvents[i].data.u64;
+        if (tag >= static_cast<uint64_t>(kSocketWatchMax))
+        {
+            continue;
+        }
+
+        // A timer or an earlier socket callback may have stopped watching this socket in the meantime.
+        SocketWatch & w = mSocketWatchPool[tag];
+        if (w.mFD == kInvalidFd || w.mCallback == nullptr)
+        {
+            continue;
+        }
+
+        // Report error and hang-up conditions through the requested events, as select() would.
+        uint32_t ready = mReadyEvents[i].events;
+        if (ready & (EPOLLERR | EPOLLHUP))
+        {
+            ready |= mRegisteredEvents[tag];
+        }
+
+        SocketEvents events;
+        if (ready & EPOLLIN)
+        {
+            events.Set(SocketEventFlags::kRead);
+        }
+        if (ready & EPOLLOUT)
+        {
+            events.Set(SocketEventFlags::kWrite);
+        }
+        if (events.HasAny())
+        {
+            w.mCallback(events, w.mCallbackData);
+        }
+    }
+
+    if (mSelectResult >= 0)
+    {
+        for (auto & source : mSources)
+        {
+            source.ProcessEvents(mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
+        }
+    }
+
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+} // namespace System
+} // namespace chip
@@ -0,0 +1,97 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
+#error "SystemLayerImplEpoll.h requires CHIP_SYSTEM_CONFIG_USE_EPOLL"
+#endif // !CHIP_SYSTEM_CONFIG_USE_EPOLL
+
+#include <sys/epoll.h>
+
+#include <system/SystemLayerImplSelect.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * System::Layer implementation built on Linux epoll.
+ *
+ * Timers, scheduled work, EventLoopHandlers and EventSources behave as in LayerImplSelect, which this class extends.
+ * Watched sockets, the wake event and a timerfd armed for the earliest timer are instead registered with an epoll
+ * instance when their interest changes, rather than being copied into fd_sets on every loop iteration.  Waiting
+ * therefore costs O(ready descriptors) and is not limited to FD_SETSIZE.
+ *
+ * Socket watches are level-triggered so that, as with select(), a callback that leaves data unread is invoked again
+ * on the next iteration.
+ */
+class LayerImplEpoll : public LayerImplSelect
+{
+public:
+    LayerImplEpoll() = default;
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+
+    // LayerSelectLoop overrides.
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+
+private:
+    // epoll_event.data.u64 holds the index of the watch in mSocketWatchPool, or one of these tags.
+    static constexpr uint64_t kWakeEventTag = kSocketWatchMax;
+    static constexpr uint64_t kTimerFdTag   = kSocketWatchMax + 1;
+    static constexpr int kMaxReadyEvents    = kSocketWatchMax + 2;
+
+    CHIP_ERROR UpdateSocketWatch(SocketWatch & watch);
+    void ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timeout sleepTime);
+
+    int mEpollFd = -1;
+    int mTimerFd = -1;
+
+    // Timeout passed to epoll_wait(): 0 when something is already due, -1 when the timerfd will wake the loop.
+    int mEpollTimeout = -1;
+    bool mTimerFdArmed = false;
+    Clock::Timestamp mTimerFdAwakenTime;
+
+    // Events currently registered with epoll for each entry of mSocketWatchPool; 0 if not registered.
+    uint32_t mRegisteredEvents[kSocketWatchMax] = {};
+
+    struct epoll_event mReadyEvents[kMaxReadyEvents];
+    int mReadyEventCount = 0;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
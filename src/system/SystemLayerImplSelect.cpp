@@ -84,7 +84,7 @@ void LayerImplSelect::Shutdown()
 
     EventSourceClear();
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
-    TimerList::Node * timer;
+    TimerQueue::Node * timer;
     while ((timer = mTimerList.PopEarliest()) != nullptr)
     {
         if (ev_is_active(&timer->mLibEvTimer))
@@ -150,7 +150,7 @@ CriticalFailure LayerImplSelect::StartTimer(Clock::Timeout delay, TimerCompleteC
 
     CancelTimer(onComplete, appState);
 
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
@@ -226,14 +226,14 @@ void LayerImplSelect::CancelTimer(TimerCompleteCallback onComplete, void * appSt
 
     VerifyOrReturn(mLayerState.IsInitialized());
 
-    TimerList::Node * timer = mTimerList.Remove(onComplete, appState);
+    TimerQueue::Node * timer = mTimerList.Remove(onComplete, appState);
     if (timer == nullptr)
     {
         // The timer was not in our "will fire in the future" list, but it might
         // be in the "we're about to fire these" chunk we already grabbed from
         // that list.  Check for it there too, and if found there we still want
         // to cancel it.
-        timer = mExpiredTimers.Remove(onComplete, appState);
+        timer = static_cast<TimerQueue::Node *>(mExpiredTimers.Remove(onComplete, appState));
     }
     VerifyOrReturn(timer != nullptr);
 
@@ -257,7 +257,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
     // schedule as timer with no delay, but do NOT cancel previous timers with same onComplete/appState!
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
     VerifyOrDie(mLibEvLoopP != nullptr);
     ev_timer_init(&timer->mLibEvTimer, &LayerImplSelect::HandleLibEvTimer, 1, 0);
@@ -292,7 +292,7 @@ CriticalFailure LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete,
     // timer, but just make sure we don't cancel existing timers with the same
     // callback and appState, so ScheduleWork invocations don't stomp on each
     // other.
-    TimerList::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
     VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
 
     if (mTimerList.Add(timer) == timer)
@@ -546,14 +546,11 @@ void LayerImplSelect::EventSourceClear()
     mSources.Clear();
 }
 
-void LayerImplSelect::PrepareEvents()
+Clock::Timestamp LayerImplSelect::PrepareAwakenTime(Clock::Timestamp currentTime)
 {
-    assertChipStackLockedByCurrentThread();
-
-    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
-    Clock::Timestamp awakenTime        = currentTime + kDefaultMinSleepPeriod;
+    Clock::Timestamp awakenTime = currentTime + kDefaultMinSleepPeriod;
 
-    TimerList::Node * timer = mTimerList.Earliest();
+    TimerQueue::Node * timer = mTimerList.Earliest();
     if (timer)
     {
         awakenTime = std::min(awakenTime, timer->AwakenTime());
@@ -575,6 +572,16 @@ void LayerImplSelect::PrepareEvents()
         }
     }
 
+    return awakenTime;
+}
+
+void LayerImplSelect::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    const Clock::Timestamp awakenTime  = PrepareAwakenTime(currentTime);
+
     const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
     Clock::ToTimeval(sleepTime, mNextTimeout);
 
@@ -647,15 +654,7 @@ void LayerImplSelect::HandleEvents()
     mHandleSelectThread = pthread_self();
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
-    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
-    // since that could result in infinite handling of new timers blocking any other progress.
-    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
-    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
-    TimerList::Node * timer = nullptr;
-    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
-    {
-        mTimerPool.Invoke(timer);
-    }
+    HandleExpiredTimers();
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     // Process socket events, if any
@@ -683,6 +682,28 @@ void LayerImplSelect::HandleEvents()
         }
     }
 
+    HandleLoopHandlers();
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplSelect::HandleExpiredTimers()
+{
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(static_cast<TimerQueue::Node *>(timer));
+    }
+}
+
+void LayerImplSelect::HandleLoopHandlers()
+{
     // Call HandleEvents for active loop handlers
     auto loopIter = mLoopHandlers.begin();
     while (loopIter != mLoopHandlers.end())
@@ -693,17 +714,13 @@ void LayerImplSelect::HandleEvents()
             loop.HandleEvents();
         }
     }
-
-#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
-    mHandleSelectThread = PTHREAD_NULL;
-#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 }
 
 #if CHIP_SYSTEM_CONFIG_USE_LIBEV
 
 void LayerImplSelect::HandleLibEvTimer(EV_P_ struct ev_timer * t, int revents)
 {
-    TimerList::Node * timer = static_cast<TimerList::Node *>(t->data);
+    TimerQueue::Node * timer = static_cast<TimerQueue::Node *>(t->data);
     VerifyOrDie(timer != nullptr);
     LayerImplSelect * layerP = dynamic_cast<LayerImplSelect *>(timer->mCallback.mSystemLayer);
     VerifyOrDie(layerP != nullptr);
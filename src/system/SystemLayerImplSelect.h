@@ -206,6 +206,22 @@ public:
     void EventSourceClear();
 
 protected:
+    /**
+     * Return the time by which the event loop must wake up to service the earliest timer or
+     * EventLoopHandler, activating pending EventLoopHandlers and calling their PrepareEvents() on the way.
+     */
+    Clock::Timestamp PrepareAwakenTime(Clock::Timestamp currentTime);
+
+    /**
+     * Invoke the callbacks of all timers that have expired.
+     */
+    void HandleExpiredTimers();
+
+    /**
+     * Call HandleEvents() on all active EventLoopHandlers.
+     */
+    void HandleLoopHandlers();
+
     IntrusiveList<EventSource> mSources;
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS
     static SocketEvents SocketEventsFromFDs(int socket, const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds);
@@ -230,8 +246,8 @@ protected:
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 #endif
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
@@ -265,7 +281,9 @@ protected:
 #endif
 };
 
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
 using LayerImpl = LayerImplSelect;
+#endif // !CHIP_SYSTEM_CONFIG_USE_EPOLL
 
 } // namespace System
 } // namespace chip
@@ -58,6 +58,10 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+#include <system/SystemPacketBufferCache.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -161,6 +165,7 @@ void PacketBufferHandle::InternalRightSize()
     newBuffer->ref           = 1;
     newBuffer->alloc_size    = usedSize;
     memcpy(newStart, start, usedSize);
+    SYSTEM_STATS_ADD_TO_TOTAL(chip::System::Stats::kPacketBuffer_BytesCopied, usedSize);
 
     PacketBuffer::Free(mBuffer);
     mBuffer = newBuffer;
@@ -338,6 +343,7 @@ void PacketBuffer::CompactHead()
     if (this->payload != kStart)
     {
         memmove(kStart, this->payload, this->len);
+        SYSTEM_STATS_ADD_TO_TOTAL(chip::System::Stats::kPacketBuffer_BytesCopied, this->len);
         this->payload = kStart;
     }
 
@@ -353,6 +359,7 @@ void PacketBuffer::CompactHead()
             lMoveLength = lAvailLength;
 
         memcpy(static_cast<uint8_t *>(this->payload) + this->len, lNextPacket.payload, lMoveLength);
+        SYSTEM_STATS_ADD_TO_TOTAL(chip::System::Stats::kPacketBuffer_BytesCopied, lMoveLength);
 
         lNextPacket.payload = static_cast<uint8_t *>(lNextPacket.payload) + lMoveLength;
         lAvailLength        = lAvailLength - lMoveLength;
@@ -466,6 +473,7 @@ bool PacketBuffer::EnsureReservedSize(uint16_t aReservedSize)
     // Cast is safe because aReservedSize > kCurrentReservedSize.
     const uint16_t kMoveLength = static_cast<uint16_t>(aReservedSize - kCurrentReservedSize);
     memmove(static_cast<uint8_t *>(this->payload) + kMoveLength, this->payload, this->len);
+    SYSTEM_STATS_ADD_TO_TOTAL(chip::System::Stats::kPacketBuffer_BytesCopied, this->len);
     payload = static_cast<uint8_t *>(this->payload) + kMoveLength;
 
     return true;
@@ -640,6 +648,17 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     UNLOCK_BUF_POOL();
 
+#elif CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+    // Round the allocation up to its size class, so that the buffer can be kept for reuse when it is freed.
+    const size_t lClassSize = PacketBufferCache::GetClassSize(lAllocSize);
+    lPacket                 = PacketBufferCache::Take(lClassSize);
+    if (lPacket == nullptr)
+    {
+        // lClassSize is at most kMaxSizeWithoutReserve, and sumOfSizes already fits in a size_t.
+        const size_t lBlockSize = (lClassSize != 0) ? PacketBuffer::kStructureSize + lClassSize : static_cast<size_t>(sumOfSizes);
+        lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+    }
+
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
@@ -662,7 +681,9 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     lPacket->len = lPacket->tot_len = 0;
     lPacket->next                   = nullptr;
     lPacket->ref                    = 1;
-#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+    lPacket->alloc_size = (lClassSize != 0) ? lClassSize : lAllocSize;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
     lPacket->alloc_size = lAllocSize;
 #endif
 
@@ -725,11 +746,19 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+#endif
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+            const size_t lAllocSize = aPacket->alloc_size;
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+            if (!PacketBufferCache::Put(aPacket, lAllocSize))
+            {
+                chip::Platform::MemoryFree(aPacket);
+            }
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -824,6 +853,7 @@ PacketBufferHandle PacketBufferHandle::CloneData() const
         }
         clone.mBuffer->tot_len = clone.mBuffer->len = original->len;
         memcpy(clone->ReserveStart(), original->ReserveStart(), originalDataSize + originalReservedSize);
+        SYSTEM_STATS_ADD_TO_TOTAL(chip::System::Stats::kPacketBuffer_BytesCopied, originalDataSize + originalReservedSize);
 
         if (cloneHead.IsNull())
         {
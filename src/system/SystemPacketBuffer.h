@@ -599,6 +599,27 @@ public:
      */
     void Advance() { *this = Hold(mBuffer->ChainedBuffer()); }
 
+    /**
+     * Call a function with each buffer of the chain, in order, without taking references to them, e.g. to gather their data for
+     * scatter/gather I/O. The iteration stops early if the function returns false.
+     *
+     *  @param[in] aFunction - function called with a `const PacketBuffer &` for each buffer, returning whether to continue.
+     *
+     *  @return     true if the function was called with every buffer of the chain, false if it stopped the iteration.
+     */
+    template <typename Function>
+    bool ForEachBuffer(Function && aFunction) const
+    {
+        for (const PacketBuffer * buffer = mBuffer; buffer != nullptr; buffer = buffer->ChainedBuffer())
+        {
+            if (!aFunction(*buffer))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Export a raw PacketBuffer pointer.
      *
@@ -0,0 +1,287 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the cache of freed heap packet buffers.
+ */
+
+#include <system/SystemPacketBufferCache.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+
+#include <lib/support/CHIPMem.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <atomic>
+#include <mutex>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr size_t kNumClasses              = 2;
+constexpr size_t kClassSizes[kNumClasses] = { CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE,
+                                              PacketBuffer::kMaxSizeWithoutReserve };
+constexpr size_t kMagazineSize            = CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE;
+constexpr size_t kDepotSize               = CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_DEPOT_SIZE;
+
+static_assert(kClassSizes[0] < kClassSizes[1],
+              "CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE must be smaller than the largest packet buffer");
+
+std::atomic<uint64_t> sHits{ 0 };
+std::atomic<uint64_t> sMisses{ 0 };
+std::atomic<size_t> sCached{ 0 };
+std::atomic<size_t> sHighWaterMark{ 0 };
+
+// Each slot holds a buffer or nullptr.  A buffer is stored by swapping it into an empty slot and taken by swapping nullptr
+// into the slot, so a buffer is only ever owned by one thread.
+std::atomic<PacketBuffer *> sDepot[kNumClasses][kDepotSize];
+
+// Cleared by PacketBufferCache::Shutdown(), after which freed buffers go straight back to the heap.
+std::atomic<bool> sEnabled{ true };
+
+void OnCached()
+{
+    size_t cached        = sCached.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t highWaterMark = sHighWaterMark.load(std::memory_order_relaxed);
+    while (cached > highWaterMark &&
+           !sHighWaterMark.compare_exchange_weak(highWaterMark, cached, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+void OnUncached()
+{
+    sCached.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool PushToDepot(size_t aClass, PacketBuffer * aBuffer)
+{
+    for (auto & slot : sDepot[aClass])
+    {
+        PacketBuffer * expected = nullptr;
+        if (slot.load(std::memory_order_relaxed) == nullptr &&
+            slot.compare_exchange_strong(expected, aBuffer, std::memory_order_release, std::memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+PacketBuffer * PopFromDepot(size_t aClass)
+{
+    for (auto & slot : sDepot[aClass])
+    {
+        if (slot.load(std::memory_order_relaxed) != nullptr)
+        {
+            PacketBuffer * buffer = slot.exchange(nullptr, std::memory_order_acquire);
+            if (buffer != nullptr)
+            {
+                return buffer;
+            }
+        }
+    }
+    return nullptr;
+}
+
+struct Magazine
+{
+    PacketBuffer * mBuffers[kMagazineSize];
+    size_t mCount;
+};
+
+struct ThreadCache;
+
+// The caches of all live threads, so that PacketBufferCache::Shutdown() can empty them.  Only taken when a thread first uses
+// the cache, when it exits and at shutdown.
+std::mutex sThreadCachesLock;
+ThreadCache * sThreadCaches = nullptr;
+
+struct ThreadCache
+{
+    Magazine mMagazines[kNumClasses] = {};
+    ThreadCache * mPrev              = nullptr;
+    ThreadCache * mNext              = nullptr;
+
+    ThreadCache()
+    {
+        std::lock_guard<std::mutex> lock(sThreadCachesLock);
+        mNext = sThreadCaches;
+        if (mNext != nullptr)
+        {
+            mNext->mPrev = this;
+        }
+        sThreadCaches = this;
+    }
+
+    // The buffers of a thread that exits are left to the other threads.  After shutdown the magazines are already empty,
+    // and nothing is freed.
+    ~ThreadCache()
+    {
+        std::lock_guard<std::mutex> lock(sThreadCachesLock);
+        if (sEnabled.load(std::memory_order_relaxed))
+        {
+            Flush(/* aKeepInDepot = */ true);
+        }
+        (mPrev != nullptr ? mPrev->mNext : sThreadCaches) = mNext;
+        if (mNext != nullptr)
+        {
+            mNext->mPrev = mPrev;
+        }
+    }
+
+    void Flush(bool aKeepInDepot)
+    {
+        for (size_t i = 0; i < kNumClasses; i++)
+        {
+            Magazine & magazine = mMagazines[i];
+            while (magazine.mCount > 0)
+            {
+                PacketBuffer * buffer = magazine.mBuffers[--magazine.mCount];
+                if (!aKeepInDepot || !PushToDepot(i, buffer))
+                {
+                    OnUncached();
+                    chip::Platform::MemoryFree(buffer);
+                }
+            }
+        }
+    }
+};
+
+thread_local ThreadCache sThreadCache;
+
+size_t ClassIndex(size_t aClassSize)
+{
+    for (size_t i = 0; i < kNumClasses; i++)
+    {
+        if (kClassSizes[i] == aClassSize)
+        {
+            return i;
+        }
+    }
+    return kNumClasses;
+}
+
+} // namespace
+
+size_t PacketBufferCache::GetClassSize(size_t aAllocSize)
+{
+    for (size_t classSize : kClassSizes)
+    {
+        if (aAllocSize <= classSize)
+        {
+            return classSize;
+        }
+    }
+    return 0;
+}
+
+PacketBuffer * PacketBufferCache::Take(size_t aClassSize)
+{
+    const size_t index = ClassIndex(aClassSize);
+    if (index == kNumClasses)
+    {
+        return nullptr;
+    }
+
+    PacketBuffer * buffer = nullptr;
+    Magazine & magazine   = sThreadCache.mMagazines[index];
+    if (magazine.mCount > 0)
+    {
+        buffer = magazine.mBuffers[--magazine.mCount];
+    }
+    else
+    {
+        buffer = PopFromDepot(index);
+    }
+
+    if (buffer == nullptr)
+    {
+        sMisses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    sHits.fetch_add(1, std::memory_order_relaxed);
+    OnUncached();
+    return buffer;
+}
+
+bool PacketBufferCache::Put(PacketBuffer * aBuffer, size_t aAllocSize)
+{
+    const size_t index = ClassIndex(aAllocSize);
+    if (index == kNumClasses || !sEnabled.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    Magazine & magazine = sThreadCache.mMagazines[index];
+    if (magazine.mCount < kMagazineSize)
+    {
+        magazine.mBuffers[magazine.mCount++] = aBuffer;
+    }
+    else if (!PushToDepot(index, aBuffer))
+    {
+        return false;
+    }
+
+    OnCached();
+    return true;
+}
+
+void PacketBufferCache::Init()
+{
+    sEnabled.store(true, std::memory_order_relaxed);
+}
+
+void PacketBufferCache::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(sThreadCachesLock);
+    sEnabled.store(false, std::memory_order_relaxed);
+
+    for (ThreadCache * cache = sThreadCaches; cache != nullptr; cache = cache->mNext)
+    {
+        cache->Flush(/* aKeepInDepot = */ false);
+    }
+
+    for (size_t i = 0; i < kNumClasses; i++)
+    {
+        PacketBuffer * buffer;
+        while ((buffer = PopFromDepot(i)) != nullptr)
+        {
+            OnUncached();
+            chip::Platform::MemoryFree(buffer);
+        }
+    }
+}
+
+PacketBufferCache::Stats PacketBufferCache::GetStats()
+{
+    Stats stats;
+    stats.mHits          = sHits.load(std::memory_order_relaxed);
+    stats.mMisses        = sMisses.load(std::memory_order_relaxed);
+    stats.mCached        = sCached.load(std::memory_order_relaxed);
+    stats.mHighWaterMark = sHighWaterMark.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
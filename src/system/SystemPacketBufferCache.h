@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the cache of freed heap packet buffers enabled by
+ *      CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE.
+ */
+
+#pragma once
+
+#include <system/SystemPacketBufferInternal.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+
+namespace chip {
+namespace System {
+
+class PacketBuffer;
+
+/**
+ * Keeps freed heap packet buffers of a few allocation sizes (size classes) so that PacketBufferHandle::New can reuse them
+ * instead of going back to the heap.
+ *
+ * Each thread has a magazine of buffers per size class, which only that thread touches.  A buffer freed while the magazine
+ * of its thread is full goes to the depot of its size class, shared by all threads, and an allocation that finds the magazine
+ * of its thread empty takes a buffer from the depot.  The depot is a fixed array of slots, each updated with a single atomic
+ * exchange, so no lock is needed.  Buffers that fit in neither are returned to the heap, and the buffers in the magazines of a
+ * thread go to the depot or the heap when the thread exits.
+ *
+ * Shutdown() returns every cached buffer to the heap and stops caching until Init() is called, so that no buffer is left to be
+ * freed by a thread that outlives chip::Platform::MemoryShutdown().
+ */
+class PacketBufferCache
+{
+public:
+    struct Stats
+    {
+        uint64_t mHits;        ///< Allocations that reused a cached buffer
+        uint64_t mMisses;      ///< Allocations of a size class that found no cached buffer
+        size_t mCached;        ///< Buffers currently cached
+        size_t mHighWaterMark; ///< Largest number of buffers cached at once
+    };
+
+    /**
+     * Returns the allocation size, reserve included, of the size class of buffers of at least aAllocSize bytes, or 0 if such
+     * buffers are not cached.
+     */
+    static size_t GetClassSize(size_t aAllocSize);
+
+    /**
+     * Takes a cached buffer of the given size class, or returns nullptr if there is none.  The buffer still has to be
+     * initialized.
+     */
+    static PacketBuffer * Take(size_t aClassSize);
+
+    /**
+     * Keeps a freed buffer with the given allocation size for reuse.  Returns false if the buffer was not kept and must be
+     * returned to the heap.
+     */
+    static bool Put(PacketBuffer * aBuffer, size_t aAllocSize);
+
+    /**
+     * Starts caching freed buffers again after Shutdown().  Caching is on until Shutdown() is first called.
+     */
+    static void Init();
+
+    /**
+     * Returns the buffers of the depot and of the magazines of all threads to the heap, and frees the buffers released
+     * afterwards straight to the heap until Init() is called.
+     *
+     * Must not be called while other threads allocate or free packet buffers.
+     */
+    static void Shutdown();
+
+    static Stats GetStats();
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
@@ -117,6 +117,17 @@
 #define CHIP_SYSTEM_PACKETBUFFER_HAS_CHECK 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+ *
+ * True if freed heap packet buffers are kept for reuse by PacketBufferCache.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE 0
+#endif
+
 // Sanity checks
 
 #if (CHIP_SYSTEM_CONFIG_USE_LWIP + CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP + CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL) != 1
@@ -57,14 +57,29 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
     "Platform events",
 };
 
+static const Label sTotalStrings[chip::System::Stats::kNumTotals] = {
+    "Packet buffer bytes copied",
+};
+
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
+total_t sTotals[kNumTotals];
 
 const Label * GetStrings()
 {
     return sStatsStrings;
 }
 
+const Label * GetTotalStrings()
+{
+    return sTotalStrings;
+}
+
+total_t * GetTotals()
+{
+    return sTotals;
+}
+
 count_t * GetResourcesInUse()
 {
     return sResourcesInUse;
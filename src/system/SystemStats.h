@@ -93,6 +93,20 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+/**
+ * Running totals, which unlike the resources in use above only ever grow (until reset).
+ */
+enum
+{
+    kPacketBuffer_BytesCopied, // Bytes of packet data copied or moved within or between packet buffers
+    kNumTotals
+};
+
+typedef uint64_t total_t;
+
+total_t * GetTotals();
+const Label * GetTotalStrings();
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
@@ -137,6 +151,18 @@ const Label * GetStrings();
         chip::System::Stats::GetResourcesInUse()[entry] = 0;                                                                       \
     } while (0)
 
+#define SYSTEM_STATS_ADD_TO_TOTAL(entry, count)                                                                                    \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetTotals()[entry] += (count);                                                                        \
+    } while (0)
+
+#define SYSTEM_STATS_RESET_TOTAL(entry)                                                                                            \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetTotals()[entry] = 0;                                                                               \
+    } while (0)
+
 #if CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()                                                                                     \
     do                                                                                                                             \
@@ -150,6 +176,7 @@ const Label * GetStrings();
 // Additional macros for testing.
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (chip::System::Stats::GetResourcesInUse()[entry] == (expected))
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (chip::System::Stats::GetHighWatermarks()[entry] == (expected))
+#define SYSTEM_STATS_TEST_TOTAL(entry, expected) (chip::System::Stats::GetTotals()[entry] == (expected))
 #define SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(entry)                                                                      \
     do                                                                                                                             \
     {                                                                                                                              \
@@ -166,10 +193,15 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_RESET(entry)
 
+#define SYSTEM_STATS_ADD_TO_TOTAL(entry, count)
+
+#define SYSTEM_STATS_RESET_TOTAL(entry)
+
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (true)
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (true)
+#define SYSTEM_STATS_TEST_TOTAL(entry, expected) (true)
 #define SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(entry)
 
 #endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
@@ -178,5 +178,161 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+bool TimerHeap::Node::IsBefore(const Node & other) const
+{
+    if (AwakenTime() != other.AwakenTime())
+    {
+        return AwakenTime() < other.AwakenTime();
+    }
+    return mSequence < other.mSequence;
+}
+
+TimerHeap::Node ** TimerHeap::Bucket(void * appState)
+{
+    // Application states are usually object pointers, so drop the alignment bits before mixing.
+    uint64_t key    = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) >> 3;
+    uint32_t folded = static_cast<uint32_t>(key) ^ static_cast<uint32_t>(key >> 32);
+    return &mBuckets[((folded * 2654435769u) >> 16) & (kBucketCount - 1)];
+}
+
+TimerHeap::Node * TimerHeap::Find(TimerCompleteCallback onComplete, void * appState)
+{
+    Node * found = nullptr;
+    for (Node * timer = *Bucket(appState); timer != nullptr; timer = timer->mNextInBucket)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || timer->IsBefore(*found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+void TimerHeap::Unlink(Node * node)
+{
+    *node->mPrevInBucket = node->mNextInBucket;
+    if (node->mNextInBucket != nullptr)
+    {
+        node->mNextInBucket->mPrevInBucket = node->mPrevInBucket;
+    }
+    node->mNextInBucket = nullptr;
+    node->mPrevInBucket = nullptr;
+
+    mHeap.Remove(*node);
+}
+
+TimerHeap::Node * TimerHeap::Add(Node * add)
+{
+    VerifyOrDie(add->mPrevInBucket == nullptr);
+
+    add->mSequence = mNextSequence++;
+    mHeap.Insert(*add);
+
+    Node ** bucket     = Bucket(add->GetCallback().GetAppState());
+    add->mNextInBucket = *bucket;
+    if (*bucket != nullptr)
+    {
+        (*bucket)->mPrevInBucket = &add->mNextInBucket;
+    }
+    *bucket            = add;
+    add->mPrevInBucket = bucket;
+
+    return mHeap.Top();
+}
+
+TimerHeap::Node * TimerHeap::Remove(Node * remove)
+{
+    if (remove != nullptr && mHeap.Contains(*remove))
+    {
+        Unlink(remove);
+    }
+    return mHeap.Top();
+}
+
+TimerHeap::Node * TimerHeap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Unlink(timer);
+    }
+    return timer;
+}
+
+TimerHeap::Node * TimerHeap::PopEarliest()
+{
+    Node * earliest = mHeap.Top();
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+    }
+    return earliest;
+}
+
+TimerHeap::Node * TimerHeap::PopIfEarlier(Clock::Timestamp t)
+{
+    if (mHeap.Empty() || !(mHeap.Top()->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerHeap::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    TimerList::Node * last = nullptr;
+
+    Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        timer->mNextTimer = nullptr;
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+
+    return out;
+}
+
+void TimerHeap::Clear()
+{
+    for (auto & bucket : mBuckets)
+    {
+        Node * timer = bucket;
+        while (timer != nullptr)
+        {
+            Node * next          = timer->mNextInBucket;
+            timer->mNextInBucket = nullptr;
+            timer->mPrevInBucket = nullptr;
+            timer                = next;
+        }
+        bucket = nullptr;
+    }
+    mHeap.Clear();
+}
+
+Clock::Timeout TimerHeap::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+
+        if (currentTime < timer->AwakenTime())
+        {
+            return Clock::Timeout(timer->AwakenTime() - currentTime);
+        }
+    }
+    return Clock::kZero;
+}
+
 } // namespace System
 } // namespace chip
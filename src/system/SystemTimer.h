@@ -29,6 +29,7 @@
 
 // Include dependent headers
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveMinHeap.h>
 #include <lib/support/Pool.h>
 
 #include <system/SystemClock.h>
@@ -186,9 +187,141 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerHeap;
+
     Node * mEarliestTimer;
 };
 
+/**
+ * Set of `Timer`s ordered by expiration time, kept in an IntrusiveMinHeap.
+ *
+ * This offers the same operations as TimerList, but adding or removing a timer costs O(log n) amortized rather than O(n), and
+ * timers are additionally indexed by application state so that Remove(onComplete, appState) and GetRemainingTime() only visit
+ * timers sharing a hash bucket. As with TimerList, timers with equal expiration times come out in the order they were added.
+ */
+class TimerHeap
+{
+public:
+    class Node : public TimerList::Node, public IntrusiveMinHeapNode
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerHeap;
+
+        struct Before
+        {
+            bool operator()(const Node & a, const Node & b) const { return a.IsBefore(b); }
+        };
+
+        bool IsBefore(const Node & other) const;
+
+        uint64_t mSequence = 0;
+
+        // Hash bucket links. mPrevInBucket points at whichever link refers to this node, and is nullptr when the node
+        // is not in a heap.
+        Node * mNextInBucket  = nullptr;
+        Node ** mPrevInBucket = nullptr;
+    };
+
+    TimerHeap() = default;
+
+    /**
+     * Add a timer to the heap
+     *
+     * @return  The new earliest timer in the heap. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the heap, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the heap, or nullptr if the heap is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the heap contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if the heap is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the heap, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mHeap.Top(); }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mHeap.Empty(); }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, as a list ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the earliest timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr size_t kBucketCount = CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS;
+    static_assert(kBucketCount > 0 && (kBucketCount & (kBucketCount - 1)) == 0,
+                  "CHIP_SYSTEM_CONFIG_TIMER_HEAP_BUCKETS must be a power of two");
+
+    Node ** Bucket(void * appState);
+    Node * Find(TimerCompleteCallback onComplete, void * appState);
+    void Unlink(Node * node);
+
+    IntrusiveMinHeap<Node, Node::Before> mHeap;
+    Node * mBuckets[kBucketCount] = {};
+    uint64_t mNextSequence        = 0;
+
+    // Not defined; the bucket links of queued nodes point into this object.
+    TimerHeap(const TimerHeap &)             = delete;
+    TimerHeap & operator=(const TimerHeap &) = delete;
+};
+
+/**
+ * Container for pending timers in event loops that can use either TimerList or TimerHeap,
+ * as selected by CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP.
+ */
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+using TimerQueue = TimerHeap;
+#else
+using TimerQueue = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -23,10 +23,13 @@
  *      structure for network packet buffer management.
  */
 
+#include <algorithm>
 #include <errno.h>
+#include <future>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -39,6 +42,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <system/SystemPacketBuffer.h>
+#include <system/SystemPacketBufferCache.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP
 #include <lwip/init.h>
@@ -171,6 +175,9 @@ public:
 
     void CheckAddRef();
     void CheckAddToEnd();
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+    void CheckCacheReuse();
+#endif
     void CheckCompactHead();
     void CheckConsume();
     void CheckConsumeHead();
@@ -1744,5 +1751,141 @@ TEST_F(TestSystemPacketBuffer, CheckPacketBufferWriter)
     EXPECT_EQ(memcmp(yayBuffer->Start(), kPayload, sizeof kPayload), 0);
 }
 
+#if CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+
+TEST_F_FROM_FIXTURE(TestSystemPacketBuffer, CheckCacheReuse)
+{
+    constexpr size_t kSmallSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_SMALL_SIZE;
+
+    PacketBufferCache::Shutdown();
+    PacketBufferCache::Init();
+    const PacketBufferCache::Stats initial = PacketBufferCache::GetStats();
+    EXPECT_EQ(initial.mCached, 0u);
+
+    // Buffers are rounded up to their size class.
+    PacketBufferHandle smallHandle = PacketBufferHandle::New(10, 0);
+    PacketBufferHandle largeHandle = PacketBufferHandle::New(kSmallSize + 1, 0);
+    ASSERT_FALSE(smallHandle.IsNull());
+    ASSERT_FALSE(largeHandle.IsNull());
+    EXPECT_EQ(smallHandle->AllocSize(), kSmallSize);
+    EXPECT_EQ(largeHandle->AllocSize(), PacketBuffer::kMaxSizeWithoutReserve);
+
+    PacketBuffer * smallBuffer = smallHandle.mBuffer;
+    PacketBuffer * largeBuffer = largeHandle.mBuffer;
+    smallHandle                = nullptr;
+    largeHandle                = nullptr;
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 2u);
+
+    // A freed buffer is reused, and fully reinitialized, by the next allocation of its size class.
+    largeHandle = PacketBufferHandle::New(PacketBuffer::kMaxSize);
+    smallHandle = PacketBufferHandle::New(kSmallSize - 10, 10);
+    EXPECT_EQ(largeHandle.mBuffer, largeBuffer);
+    EXPECT_EQ(smallHandle.mBuffer, smallBuffer);
+    EXPECT_EQ(largeHandle->ReservedSize(), PacketBuffer::kDefaultHeaderReserve);
+    EXPECT_EQ(smallHandle->ReservedSize(), 10u);
+    EXPECT_EQ(smallHandle->DataLength(), 0u);
+    EXPECT_EQ(smallHandle->ref, 1);
+    EXPECT_FALSE(smallHandle->HasChainedBuffer());
+
+    PacketBufferCache::Stats stats = PacketBufferCache::GetStats();
+    EXPECT_EQ(stats.mHits, initial.mHits + 2);
+    EXPECT_EQ(stats.mMisses, initial.mMisses + 2);
+    EXPECT_EQ(stats.mCached, 0u);
+    EXPECT_GE(stats.mHighWaterMark, 2u);
+
+    // A buffer freed by a thread that exits is left to the other threads.
+    std::thread([&smallHandle] { smallHandle = nullptr; }).join();
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 1u);
+    smallHandle = PacketBufferHandle::New(10, 0);
+    EXPECT_EQ(smallHandle.mBuffer, smallBuffer);
+
+    smallHandle = nullptr;
+    largeHandle = nullptr;
+    PacketBufferCache::Shutdown();
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 0u);
+    PacketBufferCache::Init();
+}
+
+TEST_F(TestSystemPacketBuffer, CheckCacheShutdown)
+{
+    PacketBufferHandle handle = PacketBufferHandle::New(10, 0);
+    ASSERT_FALSE(handle.IsNull());
+
+    // The buffer stays in the magazine of a thread that is still running at shutdown.
+    std::promise<void> freed;
+    std::promise<void> shutDown;
+    std::thread thread([&] {
+        handle = nullptr;
+        freed.set_value();
+        shutDown.get_future().wait();
+    });
+    freed.get_future().wait();
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 1u);
+
+    // Shutdown returns the buffers cached by every thread to the heap.
+    PacketBufferCache::Shutdown();
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 0u);
+
+    // After shutdown, freed buffers go straight back to the heap, and threads that exit have nothing left to free.
+    handle = PacketBufferHandle::New(10, 0);
+    EXPECT_FALSE(handle.IsNull());
+    handle = nullptr;
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 0u);
+    shutDown.set_value();
+    thread.join();
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 0u);
+
+    PacketBufferCache::Init();
+    handle = PacketBufferHandle::New(10, 0);
+    ASSERT_FALSE(handle.IsNull());
+    handle = nullptr;
+    EXPECT_EQ(PacketBufferCache::GetStats().mCached, 1u);
+
+    PacketBufferCache::Shutdown();
+    PacketBufferCache::Init();
+}
+
+// A few threads that each keep no more buffers at a time than their magazine holds, as the messaging layer does, only go to the
+// heap for their first buffers.
+TEST_F(TestSystemPacketBuffer, CheckCacheManyThreads)
+{
+    constexpr size_t kThreads    = 4;
+    constexpr size_t kIterations = 1000;
+    constexpr size_t kBatch      = std::min<size_t>(4, CHIP_SYSTEM_CONFIG_PACKETBUFFER_CACHE_MAGAZINE_SIZE);
+
+    PacketBufferCache::Shutdown();
+    PacketBufferCache::Init();
+    const PacketBufferCache::Stats initial = PacketBufferCache::GetStats();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kThreads; i++)
+    {
+        threads.emplace_back([] {
+            for (size_t j = 0; j < kIterations; j++)
+            {
+                PacketBufferHandle handles[kBatch];
+                for (auto & handle : handles)
+                {
+                    handle = PacketBufferHandle::New(PacketBuffer::kMaxSize);
+                    VerifyOrDie(!handle.IsNull());
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    const PacketBufferCache::Stats stats = PacketBufferCache::GetStats();
+    EXPECT_EQ((stats.mHits - initial.mHits) + (stats.mMisses - initial.mMisses), kThreads * kIterations * kBatch);
+    EXPECT_LE(stats.mMisses - initial.mMisses, kThreads * kBatch);
+
+    PacketBufferCache::Shutdown();
+    PacketBufferCache::Init();
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_HAS_CACHE
+
 } // namespace System
 } // namespace chip
@@ -0,0 +1,263 @@
+/*
+ *
+ *    Copyright (c) 2025 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for the socket watch API of the select-loop based
+ *      <tt>chip::System::LayerImpl</tt> (select or epoll, depending on the build).
+ *
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/ErrorStr.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
+#include <system/SystemConfig.h>
+#include <system/SystemError.h>
+#include <system/SystemLayerImpl.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::System;
+using namespace chip::System::Clock::Literals;
+
+#if !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
+namespace {
+
+struct WatchState
+{
+    SocketEvents lastEvents;
+    int callbackCount = 0;
+};
+
+void HandleSocketEvents(SocketEvents events, intptr_t data)
+{
+    auto * state      = reinterpret_cast<WatchState *>(data);
+    state->lastEvents = events;
+    state->callbackCount++;
+}
+
+void HandleTimeout(Layer * aLayer, void * aAppState) {}
+
+void CountTimeout(Layer * aLayer, void * aAppState)
+{
+    ++*static_cast<int *>(aAppState);
+}
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        EXPECT_SUCCESS(mLayer.Init());
+    }
+
+    static void TearDownTestSuite()
+    {
+        mLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(pipe(mPipe), 0);
+        ASSERT_EQ(fcntl(mPipe[0], F_SETFL, O_NONBLOCK), 0);
+        ASSERT_EQ(fcntl(mPipe[1], F_SETFL, O_NONBLOCK), 0);
+    }
+
+    void TearDown() override
+    {
+        close(mPipe[0]);
+        close(mPipe[1]);
+    }
+
+    // Runs a single iteration of the event loop.  A short timer bounds the wait when no socket is ready.
+    static void ServiceEvents()
+    {
+        EXPECT_SUCCESS(mLayer.StartTimer(10_ms32, HandleTimeout, nullptr));
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+        mLayer.CancelTimer(HandleTimeout, nullptr);
+    }
+
+    void WriteByte()
+    {
+        const uint8_t byte = 0x5A;
+        ASSERT_EQ(write(mPipe[1], &byte, sizeof(byte)), static_cast<ssize_t>(sizeof(byte)));
+    }
+
+    void ReadByte()
+    {
+        uint8_t byte;
+        ASSERT_EQ(read(mPipe[0], &byte, sizeof(byte)), static_cast<ssize_t>(sizeof(byte)));
+    }
+
+    static LayerImpl mLayer;
+    int mPipe[2];
+};
+
+LayerImpl TestSystemSocketWatch::mLayer;
+
+TEST_F(TestSystemSocketWatch, PendingRead)
+{
+    WatchState state;
+    SocketWatchToken token;
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[0], &token));
+    EXPECT_SUCCESS(mLayer.SetCallback(token, HandleSocketEvents, reinterpret_cast<intptr_t>(&state)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(token));
+
+    // Nothing to read yet.
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 0);
+
+    WriteByte();
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 1);
+    EXPECT_TRUE(state.lastEvents.Has(SocketEventFlags::kRead));
+    EXPECT_FALSE(state.lastEvents.Has(SocketEventFlags::kWrite));
+
+    // Data left unread is reported again on the next iteration.
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 2);
+
+    ReadByte();
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 2);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&token));
+}
+
+TEST_F(TestSystemSocketWatch, ClearPendingRead)
+{
+    WatchState state;
+    SocketWatchToken token;
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[0], &token));
+    EXPECT_SUCCESS(mLayer.SetCallback(token, HandleSocketEvents, reinterpret_cast<intptr_t>(&state)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(token));
+    EXPECT_SUCCESS(mLayer.ClearCallbackOnPendingRead(token));
+
+    WriteByte();
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 0);
+
+    // Requesting again picks up the data that is already waiting.
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(token));
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 1);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&token));
+}
+
+TEST_F(TestSystemSocketWatch, PendingWrite)
+{
+    WatchState state;
+    SocketWatchToken token;
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[1], &token));
+    EXPECT_SUCCESS(mLayer.SetCallback(token, HandleSocketEvents, reinterpret_cast<intptr_t>(&state)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingWrite(token));
+
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 1);
+    EXPECT_TRUE(state.lastEvents.Has(SocketEventFlags::kWrite));
+    EXPECT_FALSE(state.lastEvents.Has(SocketEventFlags::kRead));
+
+    EXPECT_SUCCESS(mLayer.ClearCallbackOnPendingWrite(token));
+    ServiceEvents();
+    EXPECT_EQ(state.callbackCount, 1);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&token));
+}
+
+TEST_F(TestSystemSocketWatch, StopWatchingSocket)
+{
+    WatchState readState;
+    WatchState writeState;
+    SocketWatchToken readToken;
+    SocketWatchToken writeToken;
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[0], &readToken));
+    EXPECT_SUCCESS(mLayer.SetCallback(readToken, HandleSocketEvents, reinterpret_cast<intptr_t>(&readState)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(readToken));
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[1], &writeToken));
+    EXPECT_SUCCESS(mLayer.SetCallback(writeToken, HandleSocketEvents, reinterpret_cast<intptr_t>(&writeState)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingWrite(writeToken));
+
+    WriteByte();
+    ServiceEvents();
+    EXPECT_EQ(readState.callbackCount, 1);
+    EXPECT_EQ(writeState.callbackCount, 1);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&readToken));
+    EXPECT_EQ(readToken, mLayer.InvalidSocketWatchToken());
+
+    // Only the remaining watch is reported.
+    ServiceEvents();
+    EXPECT_EQ(readState.callbackCount, 1);
+    EXPECT_EQ(writeState.callbackCount, 2);
+
+    // A stopped watch can be started again for the same descriptor.
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[0], &readToken));
+    EXPECT_SUCCESS(mLayer.SetCallback(readToken, HandleSocketEvents, reinterpret_cast<intptr_t>(&readState)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(readToken));
+    ServiceEvents();
+    EXPECT_EQ(readState.callbackCount, 2);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&readToken));
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&writeToken));
+}
+
+TEST_F(TestSystemSocketWatch, TimerWhileWatching)
+{
+    WatchState state;
+    SocketWatchToken token;
+    int fired = 0;
+
+    EXPECT_SUCCESS(mLayer.StartWatchingSocket(mPipe[0], &token));
+    EXPECT_SUCCESS(mLayer.SetCallback(token, HandleSocketEvents, reinterpret_cast<intptr_t>(&state)));
+    EXPECT_SUCCESS(mLayer.RequestCallbackOnPendingRead(token));
+
+    // A timer must wake the loop even though the watched socket stays idle.
+    EXPECT_SUCCESS(mLayer.StartTimer(20_ms32, CountTimeout, &fired));
+
+    const Clock::Timestamp deadline = SystemClock().GetMonotonicTimestamp() + 5_s;
+    while (fired == 0 && SystemClock().GetMonotonicTimestamp() < deadline)
+    {
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+    }
+    EXPECT_EQ(fired, 1);
+    EXPECT_EQ(state.callbackCount, 0);
+
+    EXPECT_SUCCESS(mLayer.StopWatchingSocket(&token));
+}
+
+} // namespace
+
+#endif // !CHIP_SYSTEM_CONFIG_USE_DISPATCH
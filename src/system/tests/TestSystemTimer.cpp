@@ -27,6 +27,9 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+#include <vector>
+
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/ErrorStr.h>
@@ -565,6 +568,180 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+// Test TimerHeap, which must behave like TimerList.
+TEST_F(TestSystemTimer, CheckTimerHeap)
+{
+    using Timer = TimerHeap::Node;
+    struct TestState
+    {
+        static void Increment(Layer * layer, void * state) {}
+        static void Reset(Layer * layer, void * state) {}
+    };
+    int testState      = 0;
+    int otherTestState = 0;
+
+    using namespace Clock::Literals;
+    struct
+    {
+        Clock::Timestamp awakenTime;
+        TimerCompleteCallback onComplete;
+        void * appState;
+        Timer * timer;
+    } testTimer[] = {
+        { 111_ms, TestState::Increment, &testState },      // 0
+        { 100_ms, TestState::Increment, &testState },      // 1
+        { 202_ms, TestState::Reset, &testState },          // 2
+        { 303_ms, TestState::Increment, &testState },      // 3
+        { 111_ms, TestState::Increment, &otherTestState }, // 4
+    };
+
+    TimerPool<Timer> pool;
+    for (auto & timer : testTimer)
+    {
+        timer.timer = pool.Create(mLayer, timer.awakenTime, timer.onComplete, timer.appState);
+        ASSERT_NE(timer.timer, nullptr);
+    }
+
+    TimerHeap heap;
+    EXPECT_EQ(heap.Remove(nullptr), nullptr);
+    EXPECT_EQ(heap.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(heap.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(heap.Earliest(), nullptr);
+    EXPECT_TRUE(heap.Empty());
+
+    Timer * earliest = heap.Add(testTimer[0].timer); // heap: () → (0) returns: 0
+    EXPECT_EQ(earliest, testTimer[0].timer);
+    EXPECT_EQ(heap.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(heap.Earliest(), testTimer[0].timer);
+    EXPECT_FALSE(heap.Empty());
+
+    earliest = heap.Add(testTimer[1].timer); // heap: (0) → (1 0) returns: 1
+    EXPECT_EQ(earliest, testTimer[1].timer);
+
+    earliest = heap.Add(testTimer[2].timer); // heap: (1 0) → (1 0 2) returns: 1
+    EXPECT_EQ(earliest, testTimer[1].timer);
+
+    earliest = heap.Add(testTimer[3].timer); // heap: (1 0 2) → (1 0 2 3) returns: 1
+    EXPECT_EQ(earliest, testTimer[1].timer);
+
+    earliest = heap.Add(testTimer[4].timer); // heap: (1 0 2 3) → (1 0 4 2 3) returns: 1
+    EXPECT_EQ(earliest, testTimer[1].timer);
+
+    // Removing a timer that is not in the heap has no effect.
+    Timer notQueued(mLayer, 0_ms, TestState::Increment, &testState);
+    EXPECT_EQ(heap.Remove(&notQueued), testTimer[1].timer);
+
+    // Removal by callback picks the earliest matching timer.
+    earliest = heap.Remove(TestState::Increment, &testState); // heap: (1 0 4 2 3) → (0 4 2 3) returns: 1
+    EXPECT_EQ(earliest, testTimer[1].timer);
+    EXPECT_EQ(heap.Earliest(), testTimer[0].timer);
+
+    earliest = heap.Remove(TestState::Reset, &testState); // heap: (0 4 2 3) → (0 4 3) returns: 2
+    EXPECT_EQ(earliest, testTimer[2].timer);
+    EXPECT_EQ(heap.Remove(TestState::Reset, &testState), nullptr);
+
+    earliest = heap.Remove(testTimer[3].timer); // heap: (0 4 3) → (0 4) returns: 0
+    EXPECT_EQ(earliest, testTimer[0].timer);
+
+    // Timers with equal expiration times come out in insertion order.
+    earliest = heap.PopEarliest(); // heap: (0 4) → (4) returns: 0
+    EXPECT_EQ(earliest, testTimer[0].timer);
+    EXPECT_EQ(heap.PopIfEarlier(111_ms), nullptr);
+    earliest = heap.PopIfEarlier(112_ms); // heap: (4) → () returns: 4
+    EXPECT_EQ(earliest, testTimer[4].timer);
+    EXPECT_TRUE(heap.Empty());
+
+    earliest = heap.Add(testTimer[3].timer); // heap: () → (3) returns: 3
+    heap.Clear();                            // heap: (3) → ()
+    EXPECT_EQ(earliest, testTimer[3].timer);
+    EXPECT_TRUE(heap.Empty());
+
+    for (auto & timer : testTimer)
+    {
+        heap.Add(timer.timer);
+    }
+    TimerList early = heap.ExtractEarlier(200_ms); // heap: (1 0 4 2 3) → (2 3) returns: (1 0 4)
+    EXPECT_EQ(heap.PopEarliest(), testTimer[2].timer);
+    EXPECT_EQ(heap.PopEarliest(), testTimer[3].timer);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(early.PopEarliest(), testTimer[1].timer);
+    EXPECT_EQ(early.PopEarliest(), testTimer[0].timer);
+    EXPECT_EQ(early.PopEarliest(), testTimer[4].timer);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+
+    pool.ReleaseAll();
+}
+
+// Schedule and cancel a large number of timers and check TimerHeap still hands them out in order.
+TEST_F(TestSystemTimer, CheckTimerHeapOrdering)
+{
+    using Timer = TimerHeap::Node;
+    using namespace Clock::Literals;
+
+    constexpr size_t kNumTimers = 4096;
+    struct Entry
+    {
+        Timer * timer;
+        bool queued;
+    };
+    std::vector<Entry> entries;
+    std::vector<int> appStates(kNumTimers);
+    entries.reserve(kNumTimers);
+
+    TimerHeap heap;
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        // Keep the range of expiration times small so that many timers share one.
+        Clock::Timestamp awakenTime((seed >> 16) % 512);
+        Timer * timer = new Timer(mLayer, awakenTime, HandleTimerFailed, &appStates[i]);
+        heap.Add(timer);
+        entries.push_back({ timer, true });
+    }
+
+    // Cancel a third of the timers directly, and another third by callback.
+    for (size_t i = 0; i < kNumTimers; i += 3)
+    {
+        heap.Remove(entries[i].timer);
+        entries[i].queued = false;
+    }
+    for (size_t i = 1; i < kNumTimers; i += 3)
+    {
+        EXPECT_EQ(heap.Remove(HandleTimerFailed, &appStates[i]), entries[i].timer);
+        entries[i].queued = false;
+    }
+
+    // Re-adding a cancelled timer makes it the newest among timers with the same expiration time.
+    heap.Add(entries[0].timer);
+    entries[0].queued = true;
+    std::rotate(entries.begin(), entries.begin() + 1, entries.end());
+
+    // Expected order: by expiration time, then by insertion order.
+    std::vector<Timer *> expected;
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const Entry & a, const Entry & b) { return a.timer->AwakenTime() < b.timer->AwakenTime(); });
+    for (auto & entry : entries)
+    {
+        if (entry.queued)
+        {
+            expected.push_back(entry.timer);
+        }
+    }
+
+    for (Timer * timer : expected)
+    {
+        EXPECT_EQ(heap.PopEarliest(), timer);
+    }
+    EXPECT_TRUE(heap.Empty());
+
+    for (auto & entry : entries)
+    {
+        delete entry.timer;
+    }
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
@@ -55,6 +55,10 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+    // The ciphers hold copies of the keys, so they are released first.
+    mEncryptionCipher.Release();
+    mDecryptionCipher.Release();
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -83,9 +87,11 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     ReturnErrorOnFailure(keystore.DeriveSessionKeys(secret, salt, info, i2rKey, r2iKey, mAttestationChallenge));
 #endif
 
+    mKeystore = &keystore;
+    ReturnErrorOnFailure(InitCiphers());
+
     mKeyAvailable = true;
     mSessionRole  = role;
-    mKeystore     = &keystore;
 
     return CHIP_NO_ERROR;
 }
@@ -108,9 +114,11 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     ReturnErrorOnFailure(keystore.DeriveSessionKeys(hkdfKey, salt, info, i2rKey, r2iKey, mAttestationChallenge));
 #endif
 
+    mKeystore = &keystore;
+    ReturnErrorOnFailure(InitCiphers());
+
     mKeyAvailable = true;
     mSessionRole  = role;
-    mKeystore     = &keystore;
 
     return CHIP_NO_ERROR;
 }
@@ -128,6 +136,12 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(SessionKeystore & keystore, const Cryp
     return InitFromSecret(keystore, secret.Span(), salt, infoType, role);
 }
 
+CHIP_ERROR CryptoContext::InitCiphers()
+{
+    ReturnErrorOnFailure(mEncryptionCipher.Init(mEncryptionKey));
+    return mDecryptionCipher.Init(mDecryptionKey);
+}
+
 #if CHIP_CONFIG_SECURITY_TEST_MODE
 CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey,
                                        Crypto::Aes128KeyHandle & r2iKey)
@@ -220,7 +234,7 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
         ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+            mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
     }
 
     mac.SetTag(tag, taglen);
@@ -255,7 +269,7 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
         ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+            mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
     }
     return CHIP_NO_ERROR;
 }
@@ -159,6 +159,7 @@ public:
     bool IsResponder() const { return mKeyAvailable && mSessionRole == SessionRole::kResponder; }
 
 private:
+    CHIP_ERROR InitCiphers();
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
 
     SessionRole mSessionRole;
@@ -166,6 +167,9 @@ private:
     bool mKeyAvailable;
     Crypto::Aes128KeyHandle mEncryptionKey;
     Crypto::Aes128KeyHandle mDecryptionKey;
+    // Set up once the keys are available, so that each message does not have to set up the key again.
+    Crypto::Aes128CcmCipher mEncryptionCipher;
+    Crypto::Aes128CcmCipher mDecryptionCipher;
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
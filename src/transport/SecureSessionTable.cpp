@@ -51,8 +51,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AllocateSession(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId,
+                                             fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -72,7 +72,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AllocateSession(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -215,7 +215,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AllocateSession(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -338,68 +338,79 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
-        if (session->GetLocalSessionId() == localSessionId)
-        {
-            result = session;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    SecureSession * result = mSessionIdIndex.Find(localSessionId);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate != kUnsecuredSessionId && mSessionIdIndex.Find(candidate) == nullptr)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            return MakeOptional<uint16_t>(candidate);
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
-            {
-                return Loop::Break; // No bits clear means this bucket is full.
-            }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
+    }
+
+    return NullOptional;
+}
+
+bool SecureSessionTable::SessionIdIndex::Insert(SecureSession * session)
+{
+    // Always keep one slot empty so that probing for a missing ID terminates.
+    VerifyOrReturnValue(mCount < kMask, false);
+
+    size_t slot = Hash(session->GetLocalSessionId());
+    while (mSessions[slot] != nullptr)
+    {
+        slot = (slot + 1) & kMask;
+    }
+    mSessions[slot] = session;
+    mIds[slot]      = session->GetLocalSessionId();
+    mCount++;
+    return true;
+}
+
+void SecureSessionTable::SessionIdIndex::Remove(SecureSession * session)
+{
+    size_t slot = Hash(session->GetLocalSessionId());
+    while (mSessions[slot] != session)
+    {
+        VerifyOrReturn(mSessions[slot] != nullptr);
+        slot = (slot + 1) & kMask;
+    }
+
+    //
+    // Backward-shift deletion: pull every following entry of the probe run that would
+    // no longer be reachable from its home slot into the hole, so lookups can keep
+    // stopping at the first empty slot.
+    //
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & kMask; mSessions[next] != nullptr; next = (next + 1) & kMask)
+    {
+        size_t home = Hash(mIds[next]);
+        if (((next - home) & kMask) >= ((next - hole) & kMask))
         {
-            break; // Any bit clear means we have an available ID in this bucket.
+            mSessions[hole] = mSessions[next];
+            mIds[hole]      = mIds[next];
+            hole            = next;
         }
     }
-    if (candidate_mask != UINT64_MAX)
+    mSessions[hole] = nullptr;
+    mCount--;
+}
+
+SecureSession * SecureSessionTable::SessionIdIndex::Find(uint16_t localSessionId) const
+{
+    for (size_t slot = Hash(localSessionId); mSessions[slot] != nullptr; slot = (slot + 1) & kMask)
     {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+        if (mIds[slot] == localSessionId)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return mSessions[slot];
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
-
-    return NullOptional;
+    return nullptr;
 }
 
 } // namespace Transport
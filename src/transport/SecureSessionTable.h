@@ -29,6 +29,21 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+namespace detail {
+
+// Number of bits needed for a power-of-two slot count of at least `minimum`.
+constexpr unsigned SessionIdIndexCapacityBits(size_t minimum)
+{
+    unsigned bits = 1;
+    while ((static_cast<size_t>(1) << bits) < minimum)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+} // namespace detail
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +91,11 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+        mSessionIdIndex.Remove(session);
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -243,21 +262,75 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Candidate session IDs are checked in order from the starting mNextSessionId
+     * clue against the session ID index.  Since at most CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
+     * IDs can be in use, at most that many candidates are rejected before an
+     * available one is found, each at an expected O(1) cost.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Allocate a session out of mEntries and record it in mSessionIdIndex.
+     */
+    template <typename... Args>
+    SecureSession * AllocateSession(Args &&... args)
+    {
+        SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+        if (session != nullptr && !mSessionIdIndex.Insert(session))
+        {
+            mEntries.ReleaseObject(session);
+            session = nullptr;
+        }
+        return session;
+    }
+
+    /**
+     * Open-addressed hash index from local session ID to the session holding it.
+     *
+     * Slots use linear probing with backward-shift deletion, so no tombstones
+     * accumulate as sessions come and go.  The table is sized to at least twice
+     * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE, which bounds the load factor at 1/2.
+     * Local session IDs are hashed multiplicatively since they are handed out
+     * sequentially and would otherwise form long probe runs.
+     */
+    class SessionIdIndex
+    {
+    public:
+        /**
+         * Record a session in the index.  Fails only if the index is full, which can
+         * only happen with heap-backed pools that outgrow CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+         */
+        CHECK_RETURN_VALUE bool Insert(SecureSession * session);
+        void Remove(SecureSession * session);
+        SecureSession * Find(uint16_t localSessionId) const;
+
+    private:
+        static constexpr unsigned kCapacityBits = detail::SessionIdIndexCapacityBits(2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+        static constexpr size_t kCapacity       = static_cast<size_t>(1) << kCapacityBits;
+        static constexpr size_t kMask           = kCapacity - 1;
+
+        static_assert(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE < kMaxSessionID,
+                      "CHIP_CONFIG_SECURE_SESSION_POOL_SIZE must leave room for unused session IDs");
+
+        static size_t Hash(uint16_t localSessionId)
+        {
+            // Fibonacci hashing: 2654435769 is 2^32 divided by the golden ratio.
+            return static_cast<size_t>((static_cast<uint32_t>(localSessionId) * 2654435769u) >> (32 - kCapacityBits));
+        }
+
+        // mSessions[i] == nullptr marks an empty slot; mIds[i] mirrors the local session ID of
+        // mSessions[i] so that probing does not need to touch the sessions themselves.
+        SecureSession * mSessions[kCapacity] = {};
+        uint16_t mIds[kCapacity]             = {};
+        size_t mCount                        = 0;
+    };
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
+    SessionIdIndex mSessionIdIndex;
 
     size_t GetMaxSessionTableSize() const
     {
@@ -26,6 +26,7 @@
 
 #include "SessionManager.h"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <string.h>
 
@@ -33,6 +34,7 @@
 #include <app/util/basic-types.h>
 #include <credentials/GroupDataProvider.h>
 #include <inttypes.h>
+#include <lib/core/CHIPEncoding.h>
 #include <lib/core/CHIPKeyIds.h>
 #include <lib/core/Global.h>
 #include <lib/support/AutoRelease.h>
@@ -42,6 +44,7 @@
 #include <platform/CHIPDeviceLayer.h>
 #include <protocols/Protocols.h>
 #include <protocols/secure_channel/Constants.h>
+#include <system/SystemStats.h>
 #include <tracing/macros.h>
 #include <transport/GroupPeerMessageCounter.h>
 #include <transport/GroupSession.h>
@@ -73,6 +76,39 @@ void CorrectPeerAddressInterfaceID(Transport::PeerAddress & peerAddress)
     peerAddress.SetInterface(Inet::InterfaceId::Null());
 }
 
+// Makes room before the message for both of its headers and after it for its MIC, so that the headers can be encoded and the
+// message encrypted in place.  The message is moved within its buffer at most once, rather than once for each header, and is
+// only copied, into a new buffer, if it is split over a chain of buffers or does not fit in its buffer with the headers and MIC.
+CHIP_ERROR ReserveHeadersAndFooter(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                   System::PacketBufferHandle & message)
+{
+    const uint16_t headerSize = static_cast<uint16_t>(packetHeader.EncodeSizeBytes() + payloadHeader.EncodeSizeBytes());
+    const uint16_t footerSize = packetHeader.MICTagLength();
+
+    if (!message->HasChainedBuffer())
+    {
+        if (message->ReservedSize() >= headerSize && message->AvailableDataLength() >= footerSize)
+        {
+            return CHIP_NO_ERROR;
+        }
+        if (message->ReservedSize() < headerSize && headerSize + message->DataLength() + footerSize <= message->AllocSize())
+        {
+            VerifyOrReturnError(message->EnsureReservedSize(headerSize), CHIP_ERROR_INTERNAL);
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    const size_t length          = message->TotalLength();
+    const uint16_t reservedSize  = std::max(headerSize, System::PacketBuffer::kDefaultHeaderReserve);
+    PacketBufferHandle flattened = PacketBufferHandle::New(length + footerSize, reservedSize);
+    VerifyOrReturnError(!flattened.IsNull(), CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(message->Read(flattened->Start(), length));
+    SYSTEM_STATS_ADD_TO_TOTAL(System::Stats::kPacketBuffer_BytesCopied, length);
+    flattened->SetDataLength(length);
+    message = std::move(flattened);
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
 uint32_t EncryptedPacketBufferHandle::GetMessageCounter() const
@@ -248,7 +284,11 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         CryptoContext::NonceStorage nonce;
         ReturnErrorOnFailure(
             CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(), sourceNodeId));
-        CHIP_ERROR err = SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message);
+        CHIP_ERROR err = ReserveHeadersAndFooter(packetHeader, payloadHeader, message);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message);
+        }
         keyContext->Release();
         ReturnErrorOnFailure(err);
 
@@ -288,6 +328,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         sourceNodeId = session->GetLocalScopedNodeId().GetNodeId();
         ReturnErrorOnFailure(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, sourceNodeId));
 
+        ReturnErrorOnFailure(ReserveHeadersAndFooter(packetHeader, payloadHeader, message));
         ReturnErrorOnFailure(SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message));
 
 #if CHIP_PROGRESS_LOGGING
@@ -322,6 +363,7 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
                                     message->TotalLength());
         CHIP_TRACE_MESSAGE_SENT(payloadHeader, packetHeader, destination_address, message->Start(), message->TotalLength());
 
+        ReturnErrorOnFailure(ReserveHeadersAndFooter(packetHeader, payloadHeader, message));
         ReturnErrorOnFailure(payloadHeader.EncodeBeforeData(message));
 
 #if CHIP_PROGRESS_LOGGING
@@ -654,6 +696,18 @@ CHIP_ERROR SessionManager::InjectCaseSessionWithTestKey(SessionHolder & sessionH
     return CHIP_NO_ERROR;
 }
 
+void SessionManager::OnMessageSendFailed(const PeerAddress & destination, const System::PacketBufferHandle & msg, CHIP_ERROR err)
+{
+    char addressStr[Transport::PeerAddress::kMaxToStringSize];
+    destination.ToString(addressStr);
+    ChipLogError(Inet, "Failed to send message to %s: %" CHIP_ERROR_FORMAT, addressStr, err.Format());
+
+    if (mCB != nullptr)
+    {
+        mCB->OnMessageSendFailed(msg, err);
+    }
+}
+
 void SessionManager::OnMessageReceived(const PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        Transport::MessageTransportContext * ctxt)
 {
@@ -1029,6 +1083,35 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 }
 
+/**
+ * Checks whether the destination group of an incoming group message matches the group of the given candidate key,
+ * without modifying or copying the message. When privacy is applied, only the privacy header is deobfuscated,
+ * into a scratch buffer. This lets the dispatcher skip the message copy and the AES-CCM attempt for candidate
+ * keys that share a session ID with the actual key but belong to a different group.
+ */
+static bool GroupKeyMatchesDestination(const PacketHeader & partialPacketHeader, bool applyPrivacy,
+                                       const System::PacketBufferHandle & msg, const MessageAuthenticationCode & mac,
+                                       const Credentials::GroupDataProvider::GroupSession & groupContext)
+{
+    // The privacy header holds the message counter, the source node ID and the destination group ID.
+    uint8_t privacyHeader[PacketHeader::kPrivacyHeaderMinLength + sizeof(NodeId) + sizeof(GroupId)];
+    size_t privacyLength = partialPacketHeader.PrivacyHeaderLength();
+    VerifyOrReturnValue(privacyLength <= sizeof(privacyHeader), false);
+    VerifyOrReturnValue(PacketHeader::kPrivacyHeaderOffset + privacyLength <= msg->DataLength(), false);
+
+    const uint8_t * header = partialPacketHeader.PrivacyHeader(msg->Start());
+    if (applyPrivacy)
+    {
+        CryptoContext context(groupContext.keyContext);
+        VerifyOrReturnValue(CHIP_NO_ERROR == context.PrivacyDecrypt(header, privacyLength, privacyHeader, partialPacketHeader, mac),
+                            false);
+        header = privacyHeader;
+    }
+
+    // The destination group ID is the last field of the privacy header.
+    return Encoding::LittleEndian::Get16(&header[privacyLength - sizeof(GroupId)]) == groupContext.group_id;
+}
+
 /**
  * Helper function to implement a single attempt to decrypt a groupcast message
  * using the given group key and privacy setting.
@@ -1139,20 +1222,33 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     bool decrypted = false;
     while (!decrypted && iter->Next(groupContext))
     {
-        CryptoContext context(groupContext.keyContext);
-        msgCopy = msg.CloneData();
-        if (msgCopy.IsNull())
+        bool privacy = partialPacketHeader.HasPrivacyFlag();
+        bool matches = GroupKeyMatchesDestination(partialPacketHeader, privacy, msg, mac, groupContext);
+#if CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
+        bool matchesWithoutPrivacy = privacy && GroupKeyMatchesDestination(partialPacketHeader, false, msg, mac, groupContext);
+#else
+        bool matchesWithoutPrivacy = false;
+#endif // CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
+
+        if (!matches && !matchesWithoutPrivacy)
         {
-            ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
-            return;
+            // Not the destination group of this key, skip the copy and decryption attempt.
+            continue;
         }
 
-        bool privacy = partialPacketHeader.HasPrivacyFlag();
-        decrypted =
-            GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
+        if (matches)
+        {
+            msgCopy = msg.CloneData();
+            if (msgCopy.IsNull())
+            {
+                ChipLogError(Inet, "Failed to clone Groupcast message buffer. Discarding.");
+                return;
+            }
+            decrypted =
+                GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
+        }
 
-#if CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
-        if (privacy && !decrypted)
+        if (matchesWithoutPrivacy && !decrypted)
         {
             // Try processing the P=1 message again without privacy as a work-around for invalid early-SVE2 nodes.
             msgCopy = msg.CloneData();
@@ -1164,14 +1260,17 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
             decrypted =
                 GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, false, msgCopy, mac, groupContext);
         }
-#endif // CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
     }
     iter.Release();
     // Groupcast Testing
     auto & testing = chip::Groupcast::GetTesting();
     if (testing.IsEnabled() && testing.IsFabricUnderTest(groupContext.fabric_index))
     {
-        testing.SetGroupID(packetHeaderCopy.GetDestinationGroupId().Value());
+        // Candidate keys whose group did not match are skipped without decoding the header
+        if (packetHeaderCopy.GetDestinationGroupId().HasValue())
+        {
+            testing.SetGroupID(packetHeaderCopy.GetDestinationGroupId().Value());
+        }
         if (!decrypted)
         {
             testing.SetTestResult(chip::Groupcast::Testing::Result::kNoAvailableKey);
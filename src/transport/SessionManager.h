@@ -93,6 +93,12 @@ public:
     void operator=(EncryptedPacketBufferHandle && aBuffer) { PacketBufferHandle::operator=(std::move(aBuffer)); }
 
     using System::PacketBufferHandle::IsNull;
+
+    // Whether the given handle refers to the same buffer as this one, as the handles that were sent from it do.
+    bool SharesBufferWith(const System::PacketBufferHandle & aOther) const
+    {
+        return !IsNull() && PacketBufferHandle::operator->() == aOther.operator->();
+    }
     // Pass-through to HasChainedBuffer on our underlying buffer without
     // exposing operator->
     bool HasChainedBuffer() const { return (*this)->HasChainedBuffer(); }
@@ -473,6 +479,13 @@ public:
     void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
                            Transport::MessageTransportContext * ctxt = nullptr) override;
 
+    /**
+     * @brief
+     *   Handle the failure to send a message the transport had queued. Implements TransportMgrDelegate
+     */
+    void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                             CHIP_ERROR err) override;
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     CHIP_ERROR TCPConnect(const Transport::PeerAddress & peerAddress, Transport::AppTCPConnectionCallbackCtxt * appState,
                           Transport::ActiveTCPConnectionHandle & peerConnState);
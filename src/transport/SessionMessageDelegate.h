@@ -53,6 +53,16 @@ public:
     virtual void OnMessageReceived(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
                                    const SessionHandle & session, DuplicateMessage isDuplicate,
                                    System::PacketBufferHandle && msgBuf) = 0;
+
+    /**
+     * @brief
+     *   Called when a message that was handed to the transport could only be sent after SendPreparedMessage returned,
+     *   and failed to be sent.
+     *
+     * @param msgBuf        The buffer that was sent, which is shared with the EncryptedPacketBufferHandle it was sent from
+     * @param err           The reason why the message could not be sent
+     */
+    virtual void OnMessageSendFailed(const System::PacketBufferHandle & msgBuf, CHIP_ERROR err) {}
 };
 
 } // namespace chip
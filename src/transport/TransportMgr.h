@@ -58,6 +58,17 @@ public:
     virtual void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
                                    Transport::MessageTransportContext * ctxt = nullptr) = 0;
 
+    /**
+     * @brief
+     *   Handle the failure to send a message that the transport had accepted to send later.
+     *
+     * @param destination   the destination of the message
+     * @param msgBuf        the buffer that was handed to the transport
+     * @param err           the reason why the message could not be sent
+     */
+    virtual void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                                     CHIP_ERROR err){};
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     /**
      * @brief
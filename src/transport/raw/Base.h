@@ -51,6 +51,11 @@ public:
     virtual void HandleMessageReceived(const Transport::PeerAddress & peerAddress, System::PacketBufferHandle && msg,
                                        MessageTransportContext * ctxt = nullptr) = 0;
 
+    // Called when a message that SendMessage accepted to send later could not be sent.  msg is the buffer that was
+    // handed to SendMessage.
+    virtual void HandleMessageSendFailed(const Transport::PeerAddress & peerAddress, const System::PacketBufferHandle & msg,
+                                         CHIP_ERROR err){};
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     virtual void HandleConnectionReceived(ActiveTCPConnectionState & conn){};
     virtual void HandleConnectionAttemptComplete(ActiveTCPConnectionHandle & conn, CHIP_ERROR conErr){};
@@ -127,6 +132,14 @@ protected:
         mDelegate->HandleMessageReceived(source, std::move(buffer), ctxt);
     }
 
+    /**
+     * Method used by subclasses that defer sending to notify that a message could not be sent.
+     */
+    void HandleMessageSendFailed(const PeerAddress & destination, const System::PacketBufferHandle & buffer, CHIP_ERROR err)
+    {
+        mDelegate->HandleMessageSendFailed(destination, buffer, err);
+    }
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     // Handle an incoming connection request from a peer.
     void HandleConnectionReceived(ActiveTCPConnectionState & conn) { mDelegate->HandleConnectionReceived(conn); }
@@ -53,11 +53,20 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     err = mUDPEndPoint->Bind(params.GetAddressType(), Inet::IPAddress::Any, params.GetListenPort(), params.GetInterfaceId());
     SuccessOrExit(err);
 
+    mUDPEndPoint->SetOnMessagesReceived(OnUdpReceiveBatch);
     err = mUDPEndPoint->Listen(OnUdpReceive, OnUdpError, this);
     SuccessOrExit(err);
 
     mUDPEndpointType = params.GetAddressType();
 
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+    // Messages are only queued on event loops that can send them at the end of their iterations.
+    if (System::LayerSelectLoop * loop = mUDPEndPoint->GetSystemLayer().AsSelectLoop())
+    {
+        mSendQueue.Start(*loop);
+    }
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+
     mState = State::kInitialized;
 
     ChipLogDetail(Inet, "UDP::Init bound to port=%d", mUDPEndPoint->GetBoundPort());
@@ -80,6 +89,12 @@ uint16_t UDP::GetBoundPort()
 
 void UDP::Close()
 {
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+    // Send what was queued before the endpoint goes away.
+    mSendQueue.Flush();
+    mSendQueue.Stop();
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+
     mUDPEndPoint.Release();
     mState = State::kNotReady;
 }
@@ -100,6 +115,15 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     // Drop the message and return. Free the buffer.
     CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, msgBuf = nullptr; return CHIP_ERROR_CONNECTION_ABORTED;);
 
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+    if (mSendQueue.IsStarted())
+    {
+        VerifyOrReturnError(!msgBuf.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+        mSendQueue.Push(addrInfo, std::move(msgBuf));
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
@@ -127,11 +151,128 @@ void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle
     }
 }
 
+void UDP::OnUdpReceiveBatch(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle * buffers,
+                            const Inet::IPPacketInfo * pktInfos, size_t count)
+{
+    UDP * udp = reinterpret_cast<UDP *>(endPoint->mAppState);
+
+    // Handling a message may close the transport, in which case the rest of the batch is dropped.
+    for (size_t i = 0; i < count && udp->mState == State::kInitialized; i++)
+    {
+        OnUdpReceive(endPoint, std::move(buffers[i]), &pktInfos[i]);
+    }
+}
+
 void UDP::OnUdpError(Inet::UDPEndPoint * endPoint, CHIP_ERROR err, const Inet::IPPacketInfo * pktInfo)
 {
     ChipLogError(Inet, "Failed to receive UDP message: %" CHIP_ERROR_FORMAT, err.Format());
 }
 
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+void UDP::SendQueue::Start(System::LayerSelectLoop & layer)
+{
+    VerifyOrReturn(mLayer == nullptr);
+    mLayer = &layer;
+    mLayer->AddLoopHandler(*this);
+}
+
+void UDP::SendQueue::Stop()
+{
+    VerifyOrReturn(mLayer != nullptr);
+    mLayer->RemoveLoopHandler(*this);
+    mLayer = nullptr;
+}
+
+void UDP::SendQueue::Push(const Inet::IPPacketInfo & pktInfo, System::PacketBufferHandle && msg)
+{
+    if (mLength == kCapacity)
+    {
+        // The caller of SendMessage is still running, so the failures are only reported by HandleEvents.
+        Send();
+    }
+    if (mLength == 0)
+    {
+        // Wake the event loop when the message is sent from another thread while it waits for events.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+        if (!pthread_equal(mLoopThread, pthread_self()))
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+        {
+            mLayer->Signal();
+        }
+    }
+
+    mPktInfos[mLength] = pktInfo;
+    mMsgs[mLength]     = std::move(msg);
+    mLength++;
+}
+
+void UDP::SendQueue::Flush()
+{
+    // Report the failures of the queues that were sent when full before those of this one.
+    ReportFailures();
+    Send();
+    ReportFailures();
+}
+
+void UDP::SendQueue::Send()
+{
+    VerifyOrReturn(mLength > 0);
+
+    CHIP_ERROR errors[kCapacity];
+    mUDP.mUDPEndPoint->SendMsgs(mPktInfos, mMsgs, errors, mLength);
+#if CHIP_CONFIG_TEST
+    mNumBatches++;
+#endif
+
+    for (size_t i = 0; i < mLength; i++)
+    {
+        if (errors[i] == CHIP_NO_ERROR)
+        {
+            mMsgs[i] = nullptr;
+        }
+        else if (mNumFailures < kCapacity)
+        {
+            mFailures[mNumFailures++] = { mPktInfos[i], std::move(mMsgs[i]), errors[i] };
+        }
+        else
+        {
+            ChipLogError(Inet, "Failed to send UDP message: %" CHIP_ERROR_FORMAT, errors[i].Format());
+            mMsgs[i] = nullptr;
+        }
+    }
+    mLength = 0;
+}
+
+void UDP::SendQueue::ReportFailures()
+{
+    // Take the failures out of the queue, since the delegates that handle them may send other messages.
+    Failure failures[kCapacity];
+    const size_t numFailures = mNumFailures;
+    for (size_t i = 0; i < numFailures; i++)
+    {
+        failures[i] = std::move(mFailures[i]);
+    }
+    mNumFailures = 0;
+
+    for (size_t i = 0; i < numFailures; i++)
+    {
+        const Inet::IPPacketInfo & pktInfo = failures[i].mPktInfo;
+        mUDP.HandleMessageSendFailed(PeerAddress::UDP(pktInfo.DestAddress, pktInfo.DestPort, pktInfo.Interface),
+                                     failures[i].mMsg, failures[i].mError);
+    }
+}
+
+System::Clock::Timestamp UDP::SendQueue::PrepareEvents(System::Clock::Timestamp now)
+{
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mLoopThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    // Do not wait for other events while there are messages to send or failures to report.
+    return (mLength > 0 || mNumFailures > 0) ? now : System::Clock::Timestamp::max();
+}
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+
 CHIP_ERROR UDP::MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join)
 {
     char addressStr[Transport::PeerAddress::kMaxToStringSize];
@@ -32,8 +32,21 @@
 #include <inet/InetInterface.h>
 #include <inet/UDPEndPoint.h>
 #include <lib/core/CHIPCore.h>
+#include <system/SystemLayer.h>
 #include <transport/raw/Base.h>
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+/**
+ * Whether the UDP transport queues the messages sent during an iteration of the event loop and sends them together, see
+ * INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE.
+ */
+#define CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE                                                                                          \
+    (CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV && HAVE_SENDMMSG &&       \
+     INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE > 1)
+
 #if CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
 struct otInstance;
 #endif // CHIP_SYSTEM_CONFIG_USE_OPENTHREAD_ENDPOINT
@@ -142,13 +155,79 @@ public:
             (address.GetIPAddress().Type() == mUDPEndpointType);
     }
 
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE && CHIP_CONFIG_TEST
+    // Number of times queued messages were handed to the endpoint together.
+    size_t TestGetNumSendBatches() const { return mSendQueue.mNumBatches; }
+#endif
+
 private:
     // UDP message receive handler.
     static void OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer,
                              const Inet::IPPacketInfo * pktInfo);
 
+    // UDP batch receive handler, for the messages read for one reception event.
+    static void OnUdpReceiveBatch(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle * buffers,
+                                  const Inet::IPPacketInfo * pktInfos, size_t count);
+
     static void OnUdpError(Inet::UDPEndPoint * endPoint, CHIP_ERROR err, const Inet::IPPacketInfo * pktInfo);
 
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+    /**
+     * Holds the messages sent during an iteration of the event loop, and sends them with a single call to
+     * UDPEndPoint::SendMsgs once the event loop has handled its events, or as soon as it is full.  Since SendMessage has
+     * already returned, the messages that cannot be sent are reported through HandleMessageSendFailed, always from the event
+     * loop and never from within SendMessage.
+     */
+    class SendQueue : public System::EventLoopHandler
+    {
+    public:
+        explicit SendQueue(UDP & udp) : mUDP(udp) {}
+        ~SendQueue() override { Stop(); }
+
+        void Start(System::LayerSelectLoop & layer);
+        void Stop();
+        bool IsStarted() const { return mLayer != nullptr; }
+
+        void Push(const Inet::IPPacketInfo & pktInfo, System::PacketBufferHandle && msg);
+        void Flush();
+
+        // System::EventLoopHandler overrides.
+        System::Clock::Timestamp PrepareEvents(System::Clock::Timestamp now) override;
+        void HandleEvents() override { Flush(); }
+
+    private:
+        static constexpr size_t kCapacity = INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE;
+
+        struct Failure
+        {
+            Inet::IPPacketInfo mPktInfo;
+            System::PacketBufferHandle mMsg;
+            CHIP_ERROR mError;
+        };
+
+        // Sends the queued messages, and keeps the failures until ReportFailures is called.
+        void Send();
+        void ReportFailures();
+
+        UDP & mUDP;
+        System::LayerSelectLoop * mLayer = nullptr;
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+        pthread_t mLoopThread = {}; // The thread that last prepared an iteration of the event loop
+#endif
+        Inet::IPPacketInfo mPktInfos[kCapacity];
+        System::PacketBufferHandle mMsgs[kCapacity];
+        size_t mLength = 0;
+        Failure mFailures[kCapacity];
+        size_t mNumFailures = 0;
+#if CHIP_CONFIG_TEST
+        size_t mNumBatches = 0;
+        friend class UDP;
+#endif
+    };
+
+    SendQueue mSendQueue{ *this };
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+
     Inet::UDPEndPointHandle mUDPEndPoint;                                 ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                         = State::kNotReady;              ///< State of the UDP transport
@@ -72,6 +72,27 @@ public:
     }
 };
 
+class CountingTransportMgrDelegate : public TransportMgrDelegate
+{
+public:
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
+                           Transport::MessageTransportContext * transCtxt = nullptr) override
+    {
+        mReceivedCount++;
+    }
+
+    void OnMessageSendFailed(const Transport::PeerAddress & destination, const System::PacketBufferHandle & msgBuf,
+                             CHIP_ERROR err) override
+    {
+        mSendFailures++;
+        mLastSendError = err;
+    }
+
+    size_t mReceivedCount     = 0;
+    size_t mSendFailures      = 0;
+    CHIP_ERROR mLastSendError = CHIP_NO_ERROR;
+};
+
 } // namespace
 
 class TestUDP : public ::testing::Test
@@ -177,3 +198,128 @@ TEST_F(TestUDP, CheckMessageTest6)
     IPAddress::FromString("::1", addr);
     CheckMessageTest(addr);
 }
+
+// Sends as many messages at once as the reporting engine does when a burst of reports is due.
+TEST_F(TestUDP, CheckMessageBurstTest6)
+{
+    constexpr size_t kNumMessages = 100;
+    uint8_t payload[400]          = {};
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    Transport::UDP udp;
+    EXPECT_EQ(udp.Init(Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager())
+                           .SetAddressType(addr.Type())
+                           .SetListenPort(0)),
+              CHIP_NO_ERROR);
+
+    CountingTransportMgrDelegate delegate;
+    TransportMgrBase transportMgr;
+    transportMgr.SetSessionManager(&delegate);
+    EXPECT_SUCCESS(transportMgr.Init(&udp));
+
+    // The same buffer is sent every time, so that a small packet buffer pool is enough.
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(payload, sizeof(payload));
+    ASSERT_FALSE(buffer.IsNull());
+
+    const auto peer = Transport::PeerAddress::UDP(addr, udp.GetBoundPort());
+    for (size_t i = 0; i < kNumMessages; i++)
+    {
+        EXPECT_EQ(udp.SendMessage(peer, buffer.Retain()), CHIP_NO_ERROR);
+    }
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), [&]() { return delegate.mReceivedCount == kNumMessages; });
+
+    EXPECT_EQ(delegate.mReceivedCount, kNumMessages);
+    EXPECT_EQ(delegate.mSendFailures, 0u);
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE && CHIP_CONFIG_TEST
+    // The burst goes out in as few batches as the queue allows.
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE;
+    EXPECT_EQ(udp.TestGetNumSendBatches(), (kNumMessages + kBatchSize - 1) / kBatchSize);
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE && CHIP_CONFIG_TEST
+}
+
+#if CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
+// A message that is queued is only sent once SendMessage has returned, so its failure is reported to the delegate.
+TEST_F(TestUDP, CheckQueuedSendFailureTest)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+#if INET_CONFIG_ENABLE_IPV4
+    IPAddress otherAddr;
+    IPAddress::FromString("127.0.0.1", otherAddr);
+#endif // INET_CONFIG_ENABLE_IPV4
+
+    Transport::UDP udp;
+    EXPECT_EQ(udp.Init(Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager())
+                           .SetAddressType(addr.Type())
+                           .SetListenPort(0)),
+              CHIP_NO_ERROR);
+
+    CountingTransportMgrDelegate delegate;
+    TransportMgrBase transportMgr;
+    transportMgr.SetSessionManager(&delegate);
+    EXPECT_SUCCESS(transportMgr.Init(&udp));
+
+    EXPECT_EQ(udp.SendMessage(Transport::PeerAddress::UDP(addr, udp.GetBoundPort()),
+                              System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD))),
+              CHIP_NO_ERROR);
+#if INET_CONFIG_ENABLE_IPV4
+    // The endpoint only sends to IPv6 addresses.
+    EXPECT_EQ(udp.SendMessage(Transport::PeerAddress::UDP(otherAddr, udp.GetBoundPort()),
+                              System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD))),
+              CHIP_NO_ERROR);
+#endif // INET_CONFIG_ENABLE_IPV4
+    EXPECT_EQ(delegate.mReceivedCount, 0u);
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), [&]() { return delegate.mReceivedCount != 0; });
+
+    EXPECT_EQ(delegate.mReceivedCount, 1u);
+#if INET_CONFIG_ENABLE_IPV4
+    EXPECT_EQ(delegate.mSendFailures, 1u);
+    EXPECT_NE(delegate.mLastSendError, CHIP_NO_ERROR);
+#endif // INET_CONFIG_ENABLE_IPV4
+}
+
+#if INET_CONFIG_ENABLE_IPV4
+// A full queue is sent right away, but its failures are only reported by the event loop, once SendMessage has returned.
+TEST_F(TestUDP, CheckFullQueueSendFailureTest)
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_SEND_BATCH_SIZE;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    IPAddress otherAddr;
+    IPAddress::FromString("127.0.0.1", otherAddr);
+
+    Transport::UDP udp;
+    EXPECT_EQ(udp.Init(Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager())
+                           .SetAddressType(addr.Type())
+                           .SetListenPort(0)),
+              CHIP_NO_ERROR);
+
+    CountingTransportMgrDelegate delegate;
+    TransportMgrBase transportMgr;
+    transportMgr.SetSessionManager(&delegate);
+    EXPECT_SUCCESS(transportMgr.Init(&udp));
+
+    // The endpoint only sends to IPv6 addresses.
+    for (size_t i = 0; i <= kBatchSize; i++)
+    {
+        EXPECT_EQ(udp.SendMessage(Transport::PeerAddress::UDP(otherAddr, udp.GetBoundPort()),
+                                  System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD))),
+                  CHIP_NO_ERROR);
+    }
+#if CHIP_CONFIG_TEST
+    EXPECT_EQ(udp.TestGetNumSendBatches(), 1u);
+#endif // CHIP_CONFIG_TEST
+    EXPECT_EQ(delegate.mSendFailures, 0u);
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1), [&]() { return delegate.mSendFailures == kBatchSize + 1; });
+
+    EXPECT_EQ(delegate.mSendFailures, kBatchSize + 1);
+    EXPECT_NE(delegate.mLastSendError, CHIP_NO_ERROR);
+}
+#endif // INET_CONFIG_ENABLE_IPV4
+#endif // CHIP_TRANSPORT_UDP_HAS_SEND_QUEUE
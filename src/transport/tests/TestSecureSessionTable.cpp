@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionIdIndex();
 
 private:
     struct SessionParameters
@@ -452,6 +453,79 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateSessionIdIndex()
+{
+    constexpr size_t kNumSessions = CHIP_CONFIG_SECURE_SESSION_POOL_SIZE;
+    Optional<SessionHandle> sessions[kNumSessions];
+    uint16_t sessionIds[kNumSessions];
+
+    mSessionTable = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(mSessionTable.get(), nullptr);
+    mSessionTable->Init();
+
+    //
+    // Start just below the top of the session ID space so allocation has to wrap around
+    // and skip kUnsecuredSessionId.
+    //
+    mSessionTable->mNextSessionId = kMaxSessionID - 2;
+
+    uint16_t expectedId = kMaxSessionID - 2;
+    for (size_t i = 0; i < kNumSessions; i++)
+    {
+        sessions[i] = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(sessions[i].HasValue());
+
+        sessionIds[i] = sessions[i].Value()->AsSecureSession()->GetLocalSessionId();
+        EXPECT_EQ(sessionIds[i], expectedId);
+        expectedId = (expectedId == kMaxSessionID) ? static_cast<uint16_t>(kUnsecuredSessionId + 1)
+                                                   : static_cast<uint16_t>(expectedId + 1);
+    }
+
+    for (size_t i = 0; i < kNumSessions; i++)
+    {
+        auto found = mSessionTable->FindSecureSessionByLocalKey(sessionIds[i]);
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), sessions[i].Value()->AsSecureSession());
+    }
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(expectedId).HasValue());
+
+    //
+    // Dropping the last handle to an establishing session releases it; every other session
+    // goes away and the remaining ones must still be reachable.
+    //
+    for (size_t i = 0; i < kNumSessions; i += 2)
+    {
+        sessions[i].ClearValue();
+    }
+
+    for (size_t i = 0; i < kNumSessions; i++)
+    {
+        auto found = mSessionTable->FindSecureSessionByLocalKey(sessionIds[i]);
+        EXPECT_EQ(found.HasValue(), (i % 2) != 0);
+        if (found.HasValue())
+        {
+            EXPECT_EQ(found.Value()->AsSecureSession(), sessions[i].Value()->AsSecureSession());
+        }
+    }
+
+    //
+    // Released IDs become available again, while IDs still in use are skipped.
+    //
+    mSessionTable->mNextSessionId = sessionIds[1];
+    auto session                  = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(session.HasValue());
+    EXPECT_EQ(session.Value()->AsSecureSession()->GetLocalSessionId(), sessionIds[2]);
+    EXPECT_TRUE(mSessionTable->FindSecureSessionByLocalKey(sessionIds[2]).HasValue());
+
+    session.ClearValue();
+    for (auto & entry : sessions)
+    {
+        entry.ClearValue();
+    }
+    mSessionTable = nullptr;
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the
@@ -461,5 +535,10 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, ValidateSessionIdIndex)
+{
+    ValidateSessionIdIndex();
+}
+
 } // namespace Transport
 } // namespace chip
@@ -41,6 +41,7 @@
 #include <protocols/echo/Echo.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
 #include <protocols/secure_channel/PASESession.h>
+#include <system/SystemStats.h>
 #include <transport/MessageStats.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
@@ -341,6 +342,104 @@ TEST_F(TestSessionManager, SendEncryptedPacketTest)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManager, PrepareMessageCopiesPayloadAtMostOnceTest)
+{
+    constexpr size_t payload_len = sizeof(PAYLOAD);
+
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = false;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    SessionHolder aliceToBobSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobSession, 2,
+                                                      fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId(), 1,
+                                                      aliceFabricIndex, peer, CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1,
+                                                      fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId(), 2,
+                                                      bobFabricIndex, peer, CryptoContext::SessionRole::kResponder);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    callback.ReceiveHandlerCallCount = 0;
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+    payloadHeader.SetInitiator(true);
+
+    // A message allocated with room for the headers and MIC is encoded and encrypted in place.
+    SYSTEM_STATS_RESET_TOTAL(System::Stats::kPacketBuffer_BytesCopied);
+    System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, payload_len);
+    ASSERT_FALSE(buffer.IsNull());
+
+    EncryptedPacketBufferHandle preparedMessage;
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(buffer), preparedMessage));
+    EXPECT_TRUE(SYSTEM_STATS_TEST_TOTAL(System::Stats::kPacketBuffer_BytesCopied, 0));
+    EXPECT_EQ(CHIP_NO_ERROR, sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage));
+
+    // A message without room for its headers is moved once within its buffer, rather than once for each header.
+    SYSTEM_STATS_RESET_TOTAL(System::Stats::kPacketBuffer_BytesCopied);
+    buffer = System::PacketBufferHandle::NewWithData(PAYLOAD, payload_len, /* aAdditionalSize = */ 128, /* aReservedSize = */ 0);
+    ASSERT_FALSE(buffer.IsNull());
+
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(buffer), preparedMessage));
+    EXPECT_TRUE(SYSTEM_STATS_TEST_TOTAL(System::Stats::kPacketBuffer_BytesCopied, payload_len));
+    EXPECT_EQ(CHIP_NO_ERROR, sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage));
+
+    // A message split over a chain of buffers is copied once into a single buffer.
+    SYSTEM_STATS_RESET_TOTAL(System::Stats::kPacketBuffer_BytesCopied);
+    constexpr size_t head_len = payload_len / 2;
+    buffer                    = MessagePacketBuffer::NewWithData(PAYLOAD, head_len);
+    ASSERT_FALSE(buffer.IsNull());
+    System::PacketBufferHandle tail = MessagePacketBuffer::NewWithData(PAYLOAD + head_len, payload_len - head_len);
+    ASSERT_FALSE(tail.IsNull());
+    buffer->AddToEnd(std::move(tail));
+
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.PrepareMessage(aliceToBobSession.Get().Value(), payloadHeader, std::move(buffer), preparedMessage));
+    EXPECT_TRUE(SYSTEM_STATS_TEST_TOTAL(System::Stats::kPacketBuffer_BytesCopied, payload_len));
+    EXPECT_EQ(CHIP_NO_ERROR, sessionManager.SendPreparedMessage(aliceToBobSession.Get().Value(), preparedMessage));
+
+    mContext.DrainAndServiceIO();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, 3);
+
+    sessionManager.Shutdown();
+}
+
 TEST_F(TestSessionManager, SendBadEncryptedPacketTest)
 {
     uint16_t payload_len = sizeof(PAYLOAD);